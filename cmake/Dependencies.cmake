@@ -163,10 +163,26 @@ endif ()
 if (UNIX)
   if (NOT APPLE AND NOT ANDROID)
     find_package(Threads QUIET)
-    if (CMAKE_THREAD_LIBS_INIT)
+    if (Threads_FOUND)
       list(APPEND Shadow_LINKER_LIBS ${CMAKE_THREAD_LIBS_INIT})
     else ()
       message(FATAL_ERROR "Could not find threads")
     endif ()
   endif ()
 endif ()
+
+# Hot CPU kernels are cloned for the x86-64 ISA levels and picked at run time
+# if the compiler and the platform support function multiversioning
+if (NOT ${USE_CUDA})
+  include(CheckCXXSourceCompiles)
+  check_cxx_source_compiles("
+    __attribute__((target_clones(\"arch=x86-64-v4\", \"arch=x86-64-v3\",
+                                 \"default\"), flatten))
+    int add_one(int x) { return x + 1; }
+    int main() { return add_one(-1); }" HAVE_TARGET_CLONES)
+  if (HAVE_TARGET_CLONES)
+    add_definitions(-DHAVE_TARGET_CLONES)
+  else ()
+    message(STATUS "Compiler does not support target_clones for x86-64 ISA levels, CPU kernels are built for the default target only")
+  endif ()
+endif ()
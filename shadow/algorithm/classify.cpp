@@ -1,23 +1,12 @@
 #include "classify.hpp"
 
-#include "util/io.hpp"
-
 namespace Shadow {
 
 void Classify::Setup(const std::string &model_file) {
-#if defined(USE_Protobuf)
-  shadow::MetaNetParam meta_net_param;
-  CHECK(IO::ReadProtoFromBinaryFile(model_file, &meta_net_param))
-      << "Error when loading proto binary file: " << model_file;
-
   ArgumentHelper arguments;
   arguments.AddSingleArgument<std::string>("backend_type", "Native");
 
-  net_.LoadXModel(meta_net_param.network(0), arguments);
-
-#else
-  LOG(FATAL) << "Unsupported load binary model, recompiled with USE_Protobuf";
-#endif
+  net_.LoadXModel(model_file, 0, arguments);
 
   const auto &in_blob = net_.in_blob();
   CHECK_EQ(in_blob.size(), 1);
@@ -1,7 +1,5 @@
 #include "detect_mtcnn.hpp"
 
-#include "util/io.hpp"
-
 namespace Shadow {
 
 inline bool SortBoxesDescend(const BoxInfo &box_a, const BoxInfo &box_b) {
@@ -45,21 +43,12 @@ inline VecBoxInfo NMS(const VecBoxInfo &boxes, float threshold,
 }
 
 void DetectMTCNN::Setup(const std::string &model_file) {
-#if defined(USE_Protobuf)
-  shadow::MetaNetParam meta_net_param;
-  CHECK(IO::ReadProtoFromBinaryFile(model_file, &meta_net_param))
-      << "Error when loading proto binary file: " << model_file;
-
   ArgumentHelper arguments;
   arguments.AddSingleArgument<std::string>("backend_type", "Native");
 
-  net_p_.LoadXModel(meta_net_param.network(0), arguments);
-  net_r_.LoadXModel(meta_net_param.network(1), arguments);
-  net_o_.LoadXModel(meta_net_param.network(2), arguments);
-
-#else
-  LOG(FATAL) << "Unsupported load binary model, recompiled with USE_Protobuf";
-#endif
+  net_p_.LoadXModel(model_file, 0, arguments);
+  net_r_.LoadXModel(model_file, 1, arguments);
+  net_o_.LoadXModel(model_file, 2, arguments);
 
   in_p_str_ = net_p_.in_blob()[0];
   in_r_str_ = net_r_.in_blob()[0];
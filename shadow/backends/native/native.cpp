@@ -1,14 +1,154 @@
 #include "native.hpp"
 
+#include "core/helper.hpp"
+
 #include "util/io.hpp"
 
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <set>
+
 namespace Shadow {
 
+// The mapped model container, all fields are little endian. A header is
+// followed by the MetaNetParam without blob data and then by the blob data
+// of all networks in blob order, each blob starts at a multiple of
+// ModelAlignment from the weight offset so that blobs can share the pages
+const char ModelMagic[8] = {'S', 'H', 'A', 'D', 'O', 'W', 'M', 'F'};
+const uint32_t ModelVersion = 1;
+const size_t ModelAlignment = 64;
+
+struct ModelHeader {
+  char magic[8];
+  uint32_t version, header_size;
+  uint64_t graph_offset, graph_size, weight_offset, weight_size;
+  char reserved[16];
+};
+
+static_assert(sizeof(ModelHeader) == 64, "Unexpected model header size");
+
+inline size_t align_model_size(size_t size) {
+  return (size + ModelAlignment - 1) / ModelAlignment * ModelAlignment;
+}
+
+inline size_t get_blob_raw_size(const shadow::Blob &blob) {
+  if (blob.shape_size() == 0) return 0;
+  size_t count = 1;
+  for (auto dim : blob.shape()) {
+    count *= dim;
+  }
+  const auto blob_type = blob.has_type() ? blob.type() : std::string("float");
+  if (blob_type == "int" || blob_type == "float") {
+    return count * 4;
+  } else if (blob_type == "unsigned char" || blob_type == "signed char") {
+    return count;
+  } else if (blob_type == "half" || blob_type == "bfloat16") {
+    return count * 2;
+  } else {
+    LOG(FATAL) << "Blob " << blob.name() << " has unsupported type "
+               << blob_type;
+  }
+  return 0;
+}
+
+// Returns the offsets of the blob data of net_param and moves offset past it
+inline std::vector<size_t> get_blob_offsets(const shadow::NetParam &net_param,
+                                            size_t *offset) {
+  std::vector<size_t> offsets;
+  for (const auto &blob : net_param.blob()) {
+    *offset = align_model_size(*offset);
+    offsets.push_back(*offset);
+    *offset += get_blob_raw_size(blob);
+  }
+  return offsets;
+}
+
+// Operators whose tops may share the data of their first bottom
+inline bool is_view_op(const std::string &op_type) {
+  return op_type == "Reshape" || op_type == "Flatten" ||
+         op_type == "Squeeze" || op_type == "Unsqueeze" || op_type == "Slice";
+}
+
+// The tops of a Slice may view its bottom only if nothing accesses the bottom,
+// or the blobs it views, after the Slice and no operator writes a top, or a
+// view of a top, in place later on
+inline bool slice_can_view(const shadow::NetParam &net_param, int op_index,
+                           const std::vector<std::string> &out_blob) {
+  const auto &slice_param = net_param.op(op_index);
+  std::set<std::string> bottoms{slice_param.bottom(0)};
+  for (int n = op_index - 1; n >= 0; --n) {
+    const auto &op_param = net_param.op(n);
+    if (!is_view_op(op_param.type())) continue;
+    for (const auto &top : op_param.top()) {
+      if (bottoms.count(top)) {
+        bottoms.insert(op_param.bottom(0));
+        break;
+      }
+    }
+  }
+  for (const auto &blob_name : out_blob) {
+    if (bottoms.count(blob_name)) return false;
+  }
+  std::set<std::string> tops(slice_param.top().begin(),
+                             slice_param.top().end());
+  for (int n = op_index + 1; n < net_param.op_size(); ++n) {
+    const auto &op_param = net_param.op(n);
+    for (const auto &bottom : op_param.bottom()) {
+      if (bottoms.count(bottom)) return false;
+    }
+    bool views_top =
+        is_view_op(op_param.type()) && tops.count(op_param.bottom(0));
+    for (const auto &top : op_param.top()) {
+      if (bottoms.count(top)) return false;
+      if (views_top) {
+        tops.insert(top);
+      } else if (tops.count(top)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
 void Native::LoadModel(const shadow::NetParam &net_param) {
   Initial(net_param);
 }
 
+void Native::LoadModel(const std::string &model_file, int network_index) {
+  auto mapped_file = std::make_shared<IO::MappedFile>(model_file);
+  const auto *model_data = mapped_file->data();
+  size_t model_size = mapped_file->size();
+
+  // Weights are used in place on host, devices get their own copy
+#if defined(USE_CUDA)
+  bool share_weight = false;
+#else
+  bool share_weight = true;
+#endif
+  if (LoadContainer(model_data, model_size, network_index, share_weight)) {
+    mapped_file_ = share_weight ? mapped_file : nullptr;
+    return;
+  }
+
+#if defined(USE_Protobuf)
+  shadow::MetaNetParam meta_net_param;
+  CHECK_LE(model_size, std::numeric_limits<int>::max());
+  CHECK(IO::ReadProtoFromArray(model_data, static_cast<int>(model_size),
+                               &meta_net_param))
+      << "Error when loading model file: " << model_file;
+  CHECK_GE(network_index, 0);
+  CHECK_LT(network_index, meta_net_param.network_size());
+  Initial(meta_net_param.network(network_index));
+
+#else
+  LOG(FATAL) << "Unsupported load model file, recompiled with USE_Protobuf";
+#endif
+}
+
 void Native::LoadModel(const void *proto_data, int proto_size) {
+  if (LoadContainer(proto_data, proto_size, 0, false)) return;
   shadow::NetParam net_param;
   LoadProtoData(proto_data, proto_size, &net_param);
   Initial(net_param);
@@ -24,15 +164,23 @@ void Native::LoadModel(const std::string &proto_str,
                        const std::vector<const void *> &weights) {
   shadow::NetParam net_param;
   LoadProtoStrOrText(proto_str, &net_param);
-  Initial(net_param);
-  CopyWeights(net_param, weights);
+  bool share_weight = ArgumentHelper(net_param).GetSingleArgument<bool>(
+      "share_weight", false);
+  Initial(net_param, weights, share_weight);
 }
 
 void Native::LoadModel(const std::string &proto_str, const void *weights_data) {
   shadow::NetParam net_param;
   LoadProtoStrOrText(proto_str, &net_param);
-  Initial(net_param);
-  CopyWeights(net_param, weights_data);
+  bool share_weight = ArgumentHelper(net_param).GetSingleArgument<bool>(
+      "share_weight", false);
+  std::vector<const void *> weights;
+  const auto *data = static_cast<const unsigned char *>(weights_data);
+  for (const auto &blob : net_param.blob()) {
+    weights.push_back(data);
+    data += get_blob_raw_size(blob);
+  }
+  Initial(net_param, weights, share_weight);
 }
 
 void Native::Forward(const std::map<std::string, void *> &data_map,
@@ -56,21 +204,257 @@ void Native::Forward(const std::map<std::string, void *> &data_map,
       SetInputData<float>(blob_name, blob_shape, blob_data);
     } else if (blob_type == DataType::kU8) {
       SetInputData<unsigned char>(blob_name, blob_shape, blob_data);
+    } else if (blob_type == DataType::kI8) {
+      SetInputData<signed char>(blob_name, blob_shape, blob_data);
+    } else if (blob_type == DataType::kF16) {
+      SetInputData<Half>(blob_name, blob_shape, blob_data);
+    } else if (blob_type == DataType::kBF16) {
+      SetInputData<BFloat16>(blob_name, blob_shape, blob_data);
     } else {
       LOG(FATAL) << "Blob " << blob_name << " has unsupported type";
     }
   }
 
-  for (auto &op : ops_) {
-    op->Forward();
-    DLOG(INFO) << op->debug_log();
+  std::vector<std::vector<int>> in_shapes;
+  for (const auto &blob_name : in_blob_) {
+    in_shapes.push_back(ws_->GetBlobShape(blob_name));
+  }
+
+  // The first forward with new input shapes records the blob sizes, then the
+  // planner packs the blobs into one arena for the following forwards, input
+  // shapes seen before reuse their cached plan. A restored plan is not built
+  // for concurrent operators, the scheduler needs one sizing forward anyway
+  bool need_plan =
+      planner_ != nullptr &&
+      ((inter_op_threads_ > 1 && scheduler_ == nullptr) ||
+       !planner_->Restore(in_shapes));
+  if (need_plan) {
+    planner_->Reset();
+  }
+
+  if (scheduler_ != nullptr && !need_plan && quantizer_ == nullptr) {
+    scheduler_->Run();
+  } else {
+    for (int n = 0; n < static_cast<int>(ops_.size()); ++n) {
+      const auto &op = ops_[n];
+      if (profiler_ != nullptr) {
+        profiler_->Begin(n);
+      }
+      op->Forward();
+      if (profiler_ != nullptr) {
+        profiler_->End(n);
+      }
+      if (quantizer_ != nullptr) {
+        quantizer_->Observe(*op);
+      }
+      DLOG(INFO) << op->debug_log();
+    }
+  }
+
+  // Forwards planning memory also allocate the blobs, they are not timed
+  if (profiler_ != nullptr) {
+    profiler_->EndForward(!need_plan);
+    if (profiler_->num_forwards() >= profile_runs_) {
+      LOG(INFO) << profiler_->Summary();
+      if (!profile_trace_.empty()) {
+        profiler_->SaveTrace(profile_trace_);
+      }
+      if (scheduler_ != nullptr) {
+        scheduler_->set_profiler(nullptr);
+      }
+      profiler_ = nullptr;
+    }
+  }
+
+  // The scheduler resolves the views after one forward, the planner must then
+  // keep apart the blobs used by operators which may run concurrently
+  if (inter_op_threads_ > 1 && scheduler_ == nullptr) {
+    scheduler_ = std::make_shared<Scheduler>(ops_, inter_op_threads_);
+    scheduler_->set_profiler(profiler_.get());
+    if (planner_ != nullptr) {
+      auto *scheduler = scheduler_.get();
+      planner_->set_precedes(
+          [scheduler](int a, int b) { return scheduler->precedes(a, b); });
+    }
+  }
+
+  if (need_plan) {
+    planner_->Plan(in_shapes);
   }
 
   DLOG(INFO) << "Forward Network!";
 }
 
 void Native::SaveEngine(const std::string &save_path,
-                        std::vector<char> *save_data) {}
+                        std::vector<char> *save_data) {
+#if defined(USE_Protobuf)
+  shadow::MetaNetParam meta_net_param;
+  meta_net_param.set_name(net_param_.name());
+  auto *net_param = meta_net_param.add_network();
+  net_param->CopyFrom(net_param_);
+  net_param->clear_arg();
+  for (const auto &arg : net_param_.arg()) {
+    if (arg.name().compare(0, 5, "plan_") != 0 && arg.name() != "optimized") {
+      net_param->add_arg()->CopyFrom(arg);
+    }
+  }
+  // The graph is saved optimized, reduced and laid out, loading it must not
+  // run the passes again. Weights derived by the operators, e.g. packed or
+  // Winograd convolution weights, are not saved, they depend on the kernels
+  // of the loading build and are derived once per weight when loading
+  add_s_i(net_param, "optimized", true);
+  // A calibrated network is saved quantized, the plan of the float network no
+  // longer applies
+  if (quantizer_ != nullptr) {
+    quantizer_->Quantize(net_param);
+  } else if (planner_ != nullptr) {
+    planner_->SavePlan(net_param);
+  }
+
+  // Blobs are saved as they are after loading, including transformed weights
+  std::vector<std::shared_ptr<Blob>> blobs;
+  for (int n = 0; n < net_param->blob_size(); ++n) {
+    auto *blob_param = net_param->mutable_blob(n);
+    auto blob = ws_->GetBlob(blob_param->name());
+    CHECK_NOTNULL(blob) << "Can not find blob " << blob_param->name();
+    const auto &data_type = blob->data_type();
+    if (data_type == DataType::kI32) {
+      blob_param->set_type("int");
+    } else if (data_type == DataType::kF32) {
+      blob_param->set_type("float");
+    } else if (data_type == DataType::kU8) {
+      blob_param->set_type("unsigned char");
+    } else if (data_type == DataType::kI8) {
+      blob_param->set_type("signed char");
+    } else if (data_type == DataType::kF16) {
+      blob_param->set_type("half");
+    } else if (data_type == DataType::kBF16) {
+      blob_param->set_type("bfloat16");
+    } else {
+      LOG(FATAL) << "Blob " << blob_param->name() << " has unsupported type";
+    }
+    blob_param->clear_shape();
+    if (blob->data<void>() != nullptr) {
+      for (auto dim : blob->shape()) {
+        blob_param->add_shape(dim);
+      }
+    }
+    blobs.push_back(blob);
+  }
+
+  std::string graph;
+  CHECK(meta_net_param.SerializeToString(&graph))
+      << "Error when serializing engine graph";
+  size_t offset = 0;
+  const auto &offsets = get_blob_offsets(*net_param, &offset);
+
+  ModelHeader header{};
+  memcpy(header.magic, ModelMagic, sizeof(ModelMagic));
+  header.version = ModelVersion;
+  header.header_size = sizeof(ModelHeader);
+  header.graph_offset = sizeof(ModelHeader);
+  header.graph_size = graph.size();
+  header.weight_offset = align_model_size(sizeof(ModelHeader) + graph.size());
+  header.weight_size = offset;
+
+  std::vector<char> engine_data(header.weight_offset + header.weight_size, 0);
+  memcpy(engine_data.data(), &header, sizeof(ModelHeader));
+  memcpy(engine_data.data() + header.graph_offset, graph.data(), graph.size());
+  auto *weight_data = engine_data.data() + header.weight_offset;
+  for (int n = 0; n < static_cast<int>(blobs.size()); ++n) {
+    const auto &blob = blobs[n];
+    if (get_blob_raw_size(net_param->blob(n)) == 0) continue;
+    ws_->Ctx()->allocator()->read(blob->raw_size(), blob->data<void>(),
+                                  weight_data + offsets[n]);
+  }
+
+  if (!save_path.empty()) {
+    std::ofstream file(save_path,
+                       std::ios::out | std::ios::trunc | std::ios::binary);
+    CHECK(file.is_open()) << "Failed to open file: " << save_path;
+    file.write(engine_data.data(), engine_data.size());
+    CHECK(file.good()) << "Error when saving engine: " << save_path;
+  }
+  if (save_data != nullptr) {
+    *save_data = std::move(engine_data);
+  }
+
+#else
+  LOG(FATAL) << "Unsupported save engine, recompiled with USE_Protobuf";
+#endif
+}
+
+Backend *Native::Clone(Workspace *ws) const {
+  auto *native = new Native(ArgumentHelper(), ws);
+  native->device_input_ = device_input_;
+  native->memory_plan_ = memory_plan_;
+  native->plan_cache_size_ = plan_cache_size_;
+  native->inter_op_threads_ = inter_op_threads_;
+  // The graph is already optimized and laid out, its weights are shared as
+  // they are
+  native->graph_optimize_ = false;
+  native->blocked_layout_ = 0;
+
+  // A clone of a clone holds the blobs the weights were first shared from
+  native->shared_weights_ = shared_weights_;
+  std::vector<const void *> weights;
+  for (const auto &blob : net_param_.blob()) {
+    const auto blob_ptr = ws_->GetBlob(blob.name());
+    CHECK_NOTNULL(blob_ptr) << "Can not find blob " << blob.name();
+    weights.push_back(blob_ptr->data<void>());
+    if (shared_weights_.empty()) {
+      native->shared_weights_.push_back(blob_ptr);
+    }
+  }
+  native->Initial(net_param_, weights, true);
+  native->mapped_file_ = mapped_file_;
+  return native;
+}
+
+bool Native::LoadContainer(const void *model_data, size_t model_size,
+                           int network_index, bool share_weight) {
+  ModelHeader header{};
+  if (model_size < sizeof(ModelHeader)) return false;
+  memcpy(&header, model_data, sizeof(ModelHeader));
+  if (memcmp(header.magic, ModelMagic, sizeof(ModelMagic)) != 0) return false;
+
+#if defined(USE_Protobuf)
+  CHECK_EQ(header.version, ModelVersion)
+      << "Unsupported model version " << header.version;
+  CHECK_LE(header.graph_offset + header.graph_size, model_size);
+  CHECK_LE(header.weight_offset + header.weight_size, model_size);
+  CHECK_LE(header.graph_size, std::numeric_limits<int>::max());
+  const auto *data = static_cast<const unsigned char *>(model_data);
+  shadow::MetaNetParam meta_net_param;
+  CHECK(IO::ReadProtoFromArray(data + header.graph_offset,
+                               static_cast<int>(header.graph_size),
+                               &meta_net_param))
+      << "Error when loading model graph";
+  CHECK_GE(network_index, 0);
+  CHECK_LT(network_index, meta_net_param.network_size());
+
+  size_t offset = 0;
+  for (int n = 0; n < network_index; ++n) {
+    get_blob_offsets(meta_net_param.network(n), &offset);
+  }
+  const auto &net_param = meta_net_param.network(network_index);
+  const auto &offsets = get_blob_offsets(net_param, &offset);
+  CHECK_LE(offset, header.weight_size);
+
+  const auto *weight_data = data + header.weight_offset;
+  std::vector<const void *> weights;
+  for (int n = 0; n < net_param.blob_size(); ++n) {
+    bool has_data = get_blob_raw_size(net_param.blob(n)) > 0;
+    weights.push_back(has_data ? weight_data + offsets[n] : nullptr);
+  }
+  Initial(net_param, weights, share_weight);
+
+#else
+  LOG(FATAL) << "Unsupported load model container, recompiled with "
+                "USE_Protobuf";
+#endif
+  return true;
+}
 
 void Native::LoadProtoData(const void *proto_data, int proto_size,
                            shadow::NetParam *net_param) {
@@ -109,7 +493,9 @@ void Native::LoadProtoStrOrText(const std::string &proto_str_or_text,
       << "Error when loading proto: " << proto_str_or_text;
 }
 
-void Native::Initial(const shadow::NetParam &net_param) {
+void Native::Initial(const shadow::NetParam &net_param,
+                     const std::vector<const void *> &weights,
+                     bool share_weight) {
   for (const auto &blob : net_param.blob()) {
     std::vector<int> shape;
     int cc = 1;
@@ -137,20 +523,27 @@ void Native::Initial(const shadow::NetParam &net_param) {
         blob_ptr->reshape(shape);
         blob_ptr->set_data<float>(blob.data_f().data(), data_f_size);
       }
-    } else if (blob_type == "unsigned char") {
-      auto blob_ptr = ws_->CreateBlob(blob_name, DataType::kU8);
+    } else if (blob_type == "unsigned char" || blob_type == "signed char" ||
+               blob_type == "half" || blob_type == "bfloat16") {
+      // Blobs of other types keep their raw bytes in data_b
+      DataType data_type = DataType::kU8;
+      if (blob_type == "signed char") {
+        data_type = DataType::kI8;
+      } else if (blob_type == "half") {
+        data_type = DataType::kF16;
+      } else if (blob_type == "bfloat16") {
+        data_type = DataType::kBF16;
+      }
+      ws_->CreateBlob(blob_name, data_type);
       int data_b_size = 0;
       if (blob.data_b_size() > 0) {
         CHECK_EQ(blob.data_b_size(), 1);
         data_b_size = static_cast<int>(blob.data_b(0).size());
       }
       if (data_b_size > 0) {
-        CHECK_EQ(data_b_size, cc)
-            << "Blob unsigned char data size and blob shape are mismatch";
-        auto uc_data_ptr = static_cast<unsigned char *>(
-            static_cast<void *>(const_cast<char *>(blob.data_b(0).data())));
-        blob_ptr->reshape(shape);
-        blob_ptr->set_data<unsigned char>(uc_data_ptr, data_b_size);
+        CHECK_EQ(data_b_size, static_cast<int>(get_blob_raw_size(blob)))
+            << "Blob " << blob_type << " data size and blob shape are mismatch";
+        SetWeightData(blob_name, shape, blob.data_b(0).data(), false);
       }
     } else {
       LOG(FATAL) << "Failed to create blob " << blob_name << ", asked for type "
@@ -158,16 +551,63 @@ void Native::Initial(const shadow::NetParam &net_param) {
     }
   }
 
+  if (!weights.empty()) {
+    CopyWeights(net_param, weights, share_weight);
+  }
+
+  // Keep the graph without blob data for saving the engine
+  net_param_ = shadow::NetParam();
+  net_param_.set_name(net_param.name());
+  for (const auto &blob : net_param.blob()) {
+    auto *blob_param = net_param_.add_blob();
+    blob_param->set_name(blob.name());
+    if (blob.has_type()) {
+      blob_param->set_type(blob.type());
+    }
+    for (auto dim : blob.shape()) {
+      blob_param->add_shape(dim);
+    }
+  }
+  *net_param_.mutable_op() = net_param.op();
+  *net_param_.mutable_arg() = net_param.arg();
+
+  // Saved engines are optimized already
+  bool optimized =
+      ArgumentHelper(net_param_).GetSingleArgument<bool>("optimized", false);
+  if (graph_optimize_ && !optimized) {
+    GraphOptimizer(ws_).Optimize(&net_param_);
+    // Calibration keeps the elementwise operators for the quantizer
+    if (!calibrate_) {
+      GraphOptimizer(ws_).FuseElementwise(&net_param_);
+    }
+  }
+  if (weight_type_ != "float" && !optimized) {
+    GraphOptimizer(ws_).ReduceWeights(&net_param_, weight_type_);
+  }
+  if (blocked_layout_ > 0 && !optimized) {
+    GraphOptimizer(ws_).PropagateLayout(&net_param_, blocked_layout_);
+  }
+
+  arg_helper_ = ArgumentHelper(net_param_);
+
+  CHECK(arg_helper_.HasArgument("out_blob"))
+      << "Network must have out_blob argument";
+  out_blob_ = arg_helper_.GetRepeatedArgument<std::string>("out_blob");
+
   ops_.clear();
-  for (const auto &op_param : net_param.op()) {
+  for (int n = 0; n < net_param_.op_size(); ++n) {
+    auto op_param = net_param_.op(n);
+    // Decided for this graph only, the saved engine keeps the Slice as given
+    if (op_param.type() == "Slice" &&
+        !ArgumentHelper(op_param).HasArgument("view")) {
+      add_s_i(&op_param, "view", slice_can_view(net_param_, n, out_blob_));
+    }
     std::shared_ptr<Operator> op(CreateOperator(op_param, ws_));
     ops_.push_back(op);
   }
 
-  arg_helper_ = ArgumentHelper(net_param);
-
   in_blob_.clear();
-  for (const auto &op_param : net_param.op()) {
+  for (const auto &op_param : net_param_.op()) {
     if (op_param.type() == "Input") {
       for (const auto &blob_name : op_param.top()) {
         in_blob_.push_back(blob_name);
@@ -176,9 +616,23 @@ void Native::Initial(const shadow::NetParam &net_param) {
     }
   }
 
-  CHECK(arg_helper_.HasArgument("out_blob"))
-      << "Network must have out_blob argument";
-  out_blob_ = arg_helper_.GetRepeatedArgument<std::string>("out_blob");
+  scheduler_ = nullptr;
+  ws_->ClearTemp();
+  quantizer_ = calibrate_ ? std::make_shared<Quantizer>(ws_) : nullptr;
+  profiler_ = profile_runs_ > 0 ? std::make_shared<OpProfiler>(ops_, ws_)
+                                : nullptr;
+  if (planner_ != nullptr) {
+    planner_->Clear();
+    planner_ = nullptr;
+  }
+  if (memory_plan_) {
+    auto persistent_blobs = in_blob_;
+    persistent_blobs.insert(persistent_blobs.end(), out_blob_.begin(),
+                            out_blob_.end());
+    planner_ = std::make_shared<MemoryPlanner>(ws_, plan_cache_size_);
+    planner_->Setup(ops_, persistent_blobs);
+    planner_->LoadPlan(arg_helper_);
+  }
 
   DLOG(INFO) << "Initial Network!";
 }
@@ -220,6 +674,12 @@ size_t Native::SetWeightData(const std::string &blob_name,
       blob->set_data<float>(blob_data, blob->count());
     } else if (data_type == DataType::kU8) {
       blob->set_data<unsigned char>(blob_data, blob->count());
+    } else if (data_type == DataType::kI8) {
+      blob->set_data<signed char>(blob_data, blob->count());
+    } else if (data_type == DataType::kF16) {
+      blob->set_data<Half>(blob_data, blob->count());
+    } else if (data_type == DataType::kBF16) {
+      blob->set_data<BFloat16>(blob_data, blob->count());
     } else {
       LOG(FATAL) << "Invalid data type";
     }
@@ -228,11 +688,11 @@ size_t Native::SetWeightData(const std::string &blob_name,
 }
 
 void Native::CopyWeights(const shadow::NetParam &net_param,
-                         const std::vector<const void *> &weights) {
-  bool share_weight =
-      arg_helper_.GetSingleArgument<bool>("share_weight", false);
+                         const std::vector<const void *> &weights,
+                         bool share_weight) {
   CHECK_EQ(net_param.blob_size(), weights.size());
   for (int n = 0; n < net_param.blob_size(); ++n) {
+    if (weights[n] == nullptr) continue;
     const auto &blob = net_param.blob(n);
     std::vector<int> blob_shape;
     for (auto dim : blob.shape()) {
@@ -242,21 +702,6 @@ void Native::CopyWeights(const shadow::NetParam &net_param,
   }
 }
 
-void Native::CopyWeights(const shadow::NetParam &net_param,
-                         const void *weights_data) {
-  bool share_weight =
-      arg_helper_.GetSingleArgument<bool>("share_weight", false);
-  for (const auto &blob : net_param.blob()) {
-    std::vector<int> blob_shape;
-    for (auto dim : blob.shape()) {
-      blob_shape.push_back(dim);
-    }
-    auto offset =
-        SetWeightData(blob.name(), blob_shape, weights_data, share_weight);
-    weights_data = static_cast<const unsigned char *>(weights_data) + offset;
-  }
-}
-
 REGISTER_BACKEND(Native, Native);
 
 }  // namespace Shadow
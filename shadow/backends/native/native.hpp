@@ -2,7 +2,14 @@
 #define SHADOW_BACKENDS_NATIVE_NATIVE_HPP
 
 #include "core/backend.hpp"
+#include "core/graph_optimizer.hpp"
+#include "core/memory_planner.hpp"
+#include "core/op_profiler.hpp"
 #include "core/operator.hpp"
+#include "core/quantizer.hpp"
+#include "core/scheduler.hpp"
+
+#include "util/io.hpp"
 
 namespace Shadow {
 
@@ -10,9 +17,32 @@ class Native : public Backend {
  public:
   Native(const ArgumentHelper &arguments, Workspace *ws) : Backend(ws) {
     device_input_ = arguments.GetSingleArgument<bool>("device_input", false);
+    memory_plan_ = arguments.GetSingleArgument<bool>("memory_plan", true);
+    plan_cache_size_ = arguments.GetSingleArgument<int>("plan_cache_size", 8);
+    graph_optimize_ =
+        arguments.GetSingleArgument<bool>("graph_optimize", true);
+    // Times the operators of the first profile_runs forwards which do not
+    // plan memory, then logs the statistics and saves the trace
+    profile_runs_ = arguments.GetSingleArgument<int>("profile_runs", 0);
+    profile_trace_ =
+        arguments.GetSingleArgument<std::string>("profile_trace", "");
+#if !defined(USE_CUDA)
+    inter_op_threads_ =
+        arguments.GetSingleArgument<int>("inter_op_threads", 1);
+    blocked_layout_ = arguments.GetSingleArgument<int>("blocked_layout", 0);
+    calibrate_ = arguments.GetSingleArgument<bool>("calibrate", false);
+    weight_type_ =
+        arguments.GetSingleArgument<std::string>("weight_type", "float");
+    CHECK(weight_type_ == "float" || weight_type_ == "half" ||
+          weight_type_ == "bfloat16")
+        << "Unsupported weight type " << weight_type_;
+    CHECK(!(calibrate_ && blocked_layout_ > 0))
+        << "Calibration only supports NCHW layout";
+#endif
   }
 
   void LoadModel(const shadow::NetParam &net_param) override;
+  void LoadModel(const std::string &model_file, int network_index) override;
 
   void LoadModel(const void *proto_data, int proto_size);
   void LoadModel(const std::string &proto_bin);
@@ -27,6 +57,8 @@ class Native : public Backend {
   void SaveEngine(const std::string &save_path,
                   std::vector<char> *save_data) override;
 
+  Backend *Clone(Workspace *ws) const override;
+
  private:
   static void LoadProtoData(const void *proto_data, int proto_size,
                             shadow::NetParam *net_param);
@@ -35,7 +67,13 @@ class Native : public Backend {
   static void LoadProtoStrOrText(const std::string &proto_str_or_text,
                                  shadow::NetParam *net_param);
 
-  void Initial(const shadow::NetParam &net_param);
+  // Loads a model container, returns false if model_data is not one
+  bool LoadContainer(const void *model_data, size_t model_size,
+                     int network_index, bool share_weight);
+
+  void Initial(const shadow::NetParam &net_param,
+               const std::vector<const void *> &weights = {},
+               bool share_weight = false);
 
   template <typename T>
   void SetInputData(const std::string &blob_name,
@@ -46,12 +84,26 @@ class Native : public Backend {
                        const void *blob_data, bool share_data);
 
   void CopyWeights(const shadow::NetParam &net_param,
-                   const std::vector<const void *> &weights);
-  void CopyWeights(const shadow::NetParam &net_param, const void *weights_data);
+                   const std::vector<const void *> &weights,
+                   bool share_weight);
+
+  bool device_input_ = false, memory_plan_ = true, graph_optimize_ = true,
+       calibrate_ = false;
+  int plan_cache_size_ = 8, inter_op_threads_ = 1, blocked_layout_ = 0,
+      profile_runs_ = 0;
+  std::string weight_type_ = "float", profile_trace_;
+
+  shadow::NetParam net_param_;
+  // The weight blobs a clone shares the data of, they outlive the operators
+  std::vector<std::shared_ptr<Blob>> shared_weights_;
+  std::vector<std::shared_ptr<Operator>> ops_;
 
-  bool device_input_ = false;
+  std::shared_ptr<IO::MappedFile> mapped_file_ = nullptr;
 
-  std::vector<std::shared_ptr<Operator>> ops_;
+  std::shared_ptr<MemoryPlanner> planner_ = nullptr;
+  std::shared_ptr<Scheduler> scheduler_ = nullptr;
+  std::shared_ptr<Quantizer> quantizer_ = nullptr;
+  std::shared_ptr<OpProfiler> profiler_ = nullptr;
 };
 
 }  // namespace Shadow
@@ -16,6 +16,10 @@ class Backend {
 
   virtual void LoadModel(const shadow::NetParam &net_param) = 0;
 
+  // Loads network network_index of a model file, either a serialized
+  // MetaNetParam or a mapped model container
+  virtual void LoadModel(const std::string &model_file, int network_index) = 0;
+
   virtual void Forward(
       const std::map<std::string, void *> &data_map,
       const std::map<std::string, std::vector<int>> &shape_map) = 0;
@@ -23,6 +27,10 @@ class Backend {
   virtual void SaveEngine(const std::string &save_path,
                           std::vector<char> *save_data) = 0;
 
+  // Creates a backend in ws running the same network, the weights are shared
+  // read only and must outlive the clone
+  virtual Backend *Clone(Workspace *ws) const = 0;
+
   const ArgumentHelper &arg_helper() const { return arg_helper_; }
 
   const std::vector<std::string> &in_blob() const { return in_blob_; }
@@ -0,0 +1,220 @@
+#include "batch_server.hpp"
+
+#include "util/log.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+
+namespace Shadow {
+
+inline int get_count(const std::vector<int> &shape) {
+  return std::accumulate(shape.begin(), shape.end(), 1,
+                         std::multiplies<int>());
+}
+
+BatchServer::BatchServer(const Network &network, int max_batch,
+                         int timeout_us, int num_workers, int max_queue_size,
+                         const std::map<std::string, int> &batch_axes)
+    : max_batch_(max_batch),
+      timeout_us_(timeout_us),
+      batch_axes_(batch_axes),
+      queue_(static_cast<unsigned int>(max_queue_size)) {
+  CHECK_GT(max_batch, 0);
+  CHECK_GE(timeout_us, 0);
+  CHECK_GT(num_workers, 0);
+  CHECK_GE(max_queue_size, 0);
+  const auto &out_blob = network.out_blob();
+  for (const auto &axis_it : batch_axes_) {
+    CHECK(std::find(out_blob.begin(), out_blob.end(), axis_it.first) !=
+          out_blob.end())
+        << "Can not find output " << axis_it.first;
+    CHECK_GE(axis_it.second, -1);
+  }
+  for (int n = 0; n < num_workers; ++n) {
+    networks_.push_back(network.Clone());
+  }
+  for (int n = 0; n < num_workers; ++n) {
+    workers_.emplace_back(&BatchServer::Worker, this, n);
+  }
+}
+
+BatchServer::~BatchServer() { Stop(); }
+
+void BatchServer::Stop() {
+  {
+    std::lock_guard<std::mutex> lock(stop_mutex_);
+    if (stopped_) return;
+    stopped_ = true;
+  }
+  // One empty request per worker after the submitted ones, each worker stops
+  // at the first it pops
+  for (int n = 0; n < static_cast<int>(workers_.size()); ++n) {
+    queue_.push(nullptr);
+  }
+  for (auto &worker : workers_) {
+    worker.join();
+  }
+}
+
+std::future<BatchServer::Result> BatchServer::Submit(
+    const std::map<std::string, std::vector<float>> &data_map,
+    const std::map<std::string, std::vector<int>> &shape_map) {
+  const auto &in_blob = networks_.front().in_blob();
+  CHECK_EQ(data_map.size(), in_blob.size());
+  CHECK_EQ(shape_map.size(), in_blob.size());
+
+  auto request = std::make_shared<Request>();
+  for (const auto &blob_name : in_blob) {
+    CHECK(data_map.count(blob_name)) << "Can not find input " << blob_name;
+    CHECK(shape_map.count(blob_name)) << "Can not find shape " << blob_name;
+    const auto &data = data_map.at(blob_name);
+    const auto &shape = shape_map.at(blob_name);
+    CHECK(!shape.empty() && shape[0] > 0);
+    CHECK_EQ(static_cast<int>(data.size()), get_count(shape));
+    if (request->num == 0) {
+      request->num = shape[0];
+    }
+    CHECK_EQ(shape[0], request->num)
+        << "Inputs must have the same number of samples";
+  }
+  request->data_map = data_map;
+  request->shape_map = shape_map;
+  request->time = std::chrono::steady_clock::now();
+
+  auto result = request->promise.get_future();
+  std::lock_guard<std::mutex> lock(stop_mutex_);
+  if (stopped_) {
+    request->promise.set_exception(std::make_exception_ptr(
+        std::runtime_error("BatchServer is stopped")));
+  } else {
+    queue_.push(request);
+  }
+  return result;
+}
+
+void BatchServer::Worker(int index) {
+  auto *network = &networks_[index];
+  RequestPtr pending = nullptr;
+  bool stop = false;
+  while (!stop) {
+    auto first = pending != nullptr ? pending : queue_.pop();
+    pending = nullptr;
+    if (first == nullptr) break;
+
+    std::vector<RequestPtr> requests{first};
+    int num = first->num;
+    const auto deadline =
+        first->time + std::chrono::microseconds(timeout_us_);
+    while (num < max_batch_) {
+      RequestPtr request = nullptr;
+      if (!queue_.pop_until(&request, deadline)) break;
+      if (request == nullptr) {
+        stop = true;
+        break;
+      }
+      if (!Batchable(*first, *request) || num + request->num > max_batch_) {
+        pending = request;
+        break;
+      }
+      requests.push_back(request);
+      num += request->num;
+    }
+
+    RunBatch(network, requests);
+  }
+}
+
+void BatchServer::RunBatch(Network *network,
+                           const std::vector<RequestPtr> &requests) {
+  int num = 0;
+  for (const auto &request : requests) {
+    num += request->num;
+  }
+
+  std::map<std::string, std::vector<float>> batch_data;
+  std::map<std::string, void *> data_map;
+  std::map<std::string, std::vector<int>> shape_map;
+  for (const auto &in_it : requests.front()->shape_map) {
+    const auto &blob_name = in_it.first;
+    auto shape = in_it.second;
+    shape[0] = num;
+    if (requests.size() == 1) {
+      data_map[blob_name] = requests.front()->data_map.at(blob_name).data();
+    } else {
+      auto &data = batch_data[blob_name];
+      data.reserve(get_count(shape));
+      for (const auto &request : requests) {
+        const auto &request_data = request->data_map.at(blob_name);
+        data.insert(data.end(), request_data.begin(), request_data.end());
+      }
+      data_map[blob_name] = data.data();
+    }
+    shape_map[blob_name] = shape;
+  }
+
+  try {
+    network->Forward(data_map, shape_map);
+
+    std::vector<Result> results(requests.size());
+    for (const auto &blob_name : network->out_blob()) {
+      const auto &shape = network->GetBlobShapeByName<float>(blob_name);
+      const auto *data = network->GetBlobDataByName<float>(blob_name);
+      int axis = batch_axes_.count(blob_name) ? batch_axes_.at(blob_name) : 0;
+      if (axis < 0) {
+        for (auto &result : results) {
+          result.data_map[blob_name].assign(data, data + get_count(shape));
+          result.shape_map[blob_name] = shape;
+        }
+        continue;
+      }
+      CHECK_LT(axis, static_cast<int>(shape.size()))
+          << "Output " << blob_name << " has no batch axis " << axis;
+      CHECK_EQ(shape[axis], num)
+          << "Batch axis " << axis << " of output " << blob_name
+          << " does not have the batch size";
+      int outer_num =
+          get_count(std::vector<int>(shape.begin(), shape.begin() + axis));
+      int inner_num =
+          get_count(std::vector<int>(shape.begin() + axis + 1, shape.end()));
+      int offset = 0;
+      for (int n = 0; n < static_cast<int>(requests.size()); ++n) {
+        auto out_shape = shape;
+        out_shape[axis] = requests[n]->num;
+        int out_inner_num = requests[n]->num * inner_num;
+        auto &out_data = results[n].data_map[blob_name];
+        out_data.reserve(outer_num * out_inner_num);
+        for (int o = 0; o < outer_num; ++o) {
+          const auto *src = data + o * num * inner_num + offset;
+          out_data.insert(out_data.end(), src, src + out_inner_num);
+        }
+        results[n].shape_map[blob_name] = out_shape;
+        offset += out_inner_num;
+      }
+    }
+
+    for (int n = 0; n < static_cast<int>(requests.size()); ++n) {
+      requests[n]->promise.set_value(std::move(results[n]));
+    }
+  } catch (...) {
+    for (const auto &request : requests) {
+      request->promise.set_exception(std::current_exception());
+    }
+  }
+}
+
+bool BatchServer::Batchable(const Request &a, const Request &b) {
+  if (a.shape_map.size() != b.shape_map.size()) return false;
+  for (const auto &a_it : a.shape_map) {
+    if (!b.shape_map.count(a_it.first)) return false;
+    const auto &a_shape = a_it.second, &b_shape = b.shape_map.at(a_it.first);
+    if (a_shape.size() != b_shape.size() ||
+        !std::equal(a_shape.begin() + 1, a_shape.end(), b_shape.begin() + 1)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace Shadow
@@ -0,0 +1,84 @@
+#ifndef SHADOW_CORE_BATCH_SERVER_HPP
+#define SHADOW_CORE_BATCH_SERVER_HPP
+
+#include "common.hpp"
+#include "network.hpp"
+
+#include "util/queue.hpp"
+
+#include <chrono>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Shadow {
+
+// Serves requests from many threads with one network. Each worker pops
+// requests until max_batch samples are collected or timeout_us passes since
+// the first one, concatenates their inputs along the first axis, runs one
+// forward and splits the outputs back along their batch axes. Every worker
+// owns a clone of the network, the weights are shared between the workers.
+class BatchServer {
+ public:
+  struct Result {
+    std::map<std::string, std::vector<float>> data_map;
+    std::map<std::string, std::vector<int>> shape_map;
+  };
+
+  // batch_axes gives the axis each output is split along, -1 returns the
+  // output as a whole to every request of the batch. Outputs not in
+  // batch_axes are split along the first axis. A batch fails if the split
+  // axis of an output does not have the batch size.
+  BatchServer(const Network &network, int max_batch, int timeout_us,
+              int num_workers = 1, int max_queue_size = 0,
+              const std::map<std::string, int> &batch_axes = {});
+  ~BatchServer();
+
+  // data_map and shape_map give every input blob of the network, the first
+  // axis is the number of samples in this request. The future holds an
+  // exception if the forward fails or the server is stopped.
+  std::future<Result> Submit(
+      const std::map<std::string, std::vector<float>> &data_map,
+      const std::map<std::string, std::vector<int>> &shape_map);
+
+  // Serves the requests already submitted and stops the workers, later
+  // submissions fail
+  void Stop();
+
+ private:
+  struct Request {
+    std::map<std::string, std::vector<float>> data_map;
+    std::map<std::string, std::vector<int>> shape_map;
+    int num = 0;
+    std::chrono::steady_clock::time_point time;
+    std::promise<Result> promise;
+  };
+
+  using RequestPtr = std::shared_ptr<Request>;
+
+  void Worker(int index);
+  void RunBatch(Network *network, const std::vector<RequestPtr> &requests);
+
+  // Requests can share a batch if their input shapes match except the first
+  // axis
+  static bool Batchable(const Request &a, const Request &b);
+
+  int max_batch_ = 1, timeout_us_ = 0;
+  std::map<std::string, int> batch_axes_;
+
+  std::vector<Network> networks_;
+  std::vector<std::thread> workers_;
+  Queue<RequestPtr> queue_;
+  std::mutex stop_mutex_;
+  bool stopped_ = false;
+
+  DISABLE_COPY_AND_ASSIGN(BatchServer);
+};
+
+}  // namespace Shadow
+
+#endif  // SHADOW_CORE_BATCH_SERVER_HPP
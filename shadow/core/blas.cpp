@@ -249,6 +249,19 @@ inline void SgemvT(int M, int N, float alpha, const float *A, const float *x,
   }
 }
 
+#if defined(USE_Eigen)
+// C may hold stale data when beta is zero, so it must not be read
+template <typename TB_, typename TA_, typename TC_>
+inline void EigenSgemm(float alpha, const TB_ &B, const TA_ &A, float beta,
+                       TC_ C) {
+  if (beta == 0) {
+    C.noalias() = alpha * B * A;
+  } else {
+    C = alpha * B * A + beta * C;
+  }
+}
+#endif
+
 template <typename T>
 void BlasSgemv(int TA, int M, int N, float alpha, const T *A, int offA,
                const T *x, int offx, float beta, T *y, int offy,
@@ -262,15 +275,15 @@ void BlasSgemv(int TA, int M, int N, float alpha, const T *A, int offA,
   if (!TA) {
     const auto &x_eigen = MapVector<T>(const_cast<T *>(x + offx), N);
     auto y_eigen = MapVector<T>(y + offy, M);
-    y_eigen = alpha * A_eigen.transpose() * x_eigen + beta * y_eigen;
+    EigenSgemm(alpha, A_eigen.transpose(), x_eigen, beta, y_eigen);
   } else {
     const auto &x_eigen = MapVector<T>(const_cast<T *>(x + offx), M);
     auto y_eigen = MapVector<T>(y + offy, N);
-    y_eigen = alpha * A_eigen * x_eigen + beta * y_eigen;
+    EigenSgemm(alpha, A_eigen, x_eigen, beta, y_eigen);
   }
 #else
   for (int i = 0; i < (TA ? N : M); ++i) {
-    y[offy + i] *= beta;
+    y[offy + i] = beta == 0 ? T(0) : y[offy + i] * beta;
   }
   if (!TA) {
     SgemvN(M, N, alpha, A + offA, x + offx, y + offy);
@@ -342,29 +355,40 @@ void BlasSgemm(int TA, int TB, int M, int N, int K, float alpha, const T *A,
   cblas_sgemm(CblasRowMajor, transA, transB, M, N, K, alpha, A + offA, lda,
               B + offB, ldb, beta, C + offC, N);
 #elif defined(USE_Eigen)
-  auto C_eigen = MapMatrix<T>(C + offC, N, M);
-  if (!TA && !TB) {
-    const auto &A_eigen = MapMatrix<T>(const_cast<T *>(A + offA), K, M);
-    const auto &B_eigen = MapMatrix<T>(const_cast<T *>(B + offB), N, K);
-    C_eigen = alpha * B_eigen * A_eigen + beta * C_eigen;
-  } else if (TA && !TB) {
-    const auto &A_eigen = MapMatrix<T>(const_cast<T *>(A + offA), M, K);
-    const auto &B_eigen = MapMatrix<T>(const_cast<T *>(B + offB), N, K);
-    C_eigen = alpha * B_eigen * A_eigen.transpose() + beta * C_eigen;
-  } else if (!TA && TB) {
-    const auto &A_eigen = MapMatrix<T>(const_cast<T *>(A + offA), K, M);
-    const auto &B_eigen = MapMatrix<T>(const_cast<T *>(B + offB), K, N);
-    C_eigen = alpha * B_eigen.transpose() * A_eigen + beta * C_eigen;
-  } else {
-    const auto &A_eigen = MapMatrix<T>(const_cast<T *>(A + offA), M, K);
-    const auto &B_eigen = MapMatrix<T>(const_cast<T *>(B + offB), K, N);
-    C_eigen =
-        alpha * B_eigen.transpose() * A_eigen.transpose() + beta * C_eigen;
-  }
+  // Split the larger dimension of C into blocks for the thread pool
+  bool split_m = M >= N;
+  context->thread_pool()->parallel_for(
+      split_m ? M : N, [&](int begin, int end) {
+        int off_m = split_m ? begin : 0, m = split_m ? end - begin : M;
+        int off_n = split_m ? 0 : begin, n = split_m ? N : end - begin;
+        auto C_eigen = MapMatrix<T>(C + offC, N, M);
+        auto C_block = C_eigen.block(off_n, off_m, n, m);
+        if (!TA && !TB) {
+          const auto &A_eigen = MapMatrix<T>(const_cast<T *>(A + offA), K, M);
+          const auto &B_eigen = MapMatrix<T>(const_cast<T *>(B + offB), N, K);
+          EigenSgemm(alpha, B_eigen.block(off_n, 0, n, K),
+                     A_eigen.block(0, off_m, K, m), beta, C_block);
+        } else if (TA && !TB) {
+          const auto &A_eigen = MapMatrix<T>(const_cast<T *>(A + offA), M, K);
+          const auto &B_eigen = MapMatrix<T>(const_cast<T *>(B + offB), N, K);
+          EigenSgemm(alpha, B_eigen.block(off_n, 0, n, K),
+                     A_eigen.block(off_m, 0, m, K).transpose(), beta, C_block);
+        } else if (!TA && TB) {
+          const auto &A_eigen = MapMatrix<T>(const_cast<T *>(A + offA), K, M);
+          const auto &B_eigen = MapMatrix<T>(const_cast<T *>(B + offB), K, N);
+          EigenSgemm(alpha, B_eigen.block(0, off_n, K, n).transpose(),
+                     A_eigen.block(0, off_m, K, m), beta, C_block);
+        } else {
+          const auto &A_eigen = MapMatrix<T>(const_cast<T *>(A + offA), M, K);
+          const auto &B_eigen = MapMatrix<T>(const_cast<T *>(B + offB), K, N);
+          EigenSgemm(alpha, B_eigen.block(0, off_n, K, n).transpose(),
+                     A_eigen.block(off_m, 0, m, K).transpose(), beta, C_block);
+        }
+      });
 #else
   for (int i = 0; i < M; ++i) {
     for (int j = 0; j < N; ++j) {
-      C[offC + i * N + j] *= beta;
+      C[offC + i * N + j] = beta == 0 ? T(0) : C[offC + i * N + j] * beta;
     }
   }
   if (!TA && !TB) {
@@ -3,6 +3,7 @@
 
 #include "allocator.hpp"
 #include "common.hpp"
+#include "half.hpp"
 
 #include "util/log.hpp"
 
@@ -12,7 +13,12 @@
 
 namespace Shadow {
 
-enum class DataType { kI32, kF32, kU8 };
+enum class DataType { kI32, kF32, kU8, kI8, kF16, kBF16 };
+
+// Blocked layouts store the channels in blocks as the innermost axis, a
+// NCHW8c blob is stored as N x C/8 x H x W x 8 with the channels padded to a
+// multiple of 8. The shape of a blob is always in NCHW order
+enum class Layout { kNCHW = 1, kNCHW8c = 8, kNCHW16c = 16 };
 
 class Blob {
  public:
@@ -77,34 +83,60 @@ class Blob {
     }
     data_ = const_cast<void *>(data);
     shape_ = shape;
+    layout_ = Layout::kNCHW;
     capacity_ = 0;
     shared_ = true;
     CHECK_GT(count(), 0);
   }
 
-  void reshape(const std::vector<int> &shape) {
-    auto cou = std::accumulate(shape.begin(), shape.end(), 1,
-                               std::multiplies<size_t>());
-    CHECK_GT(cou, 0);
-    if (data_ != nullptr && !shared_ && cou > capacity_) {
+  // Bind to external storage which holds at most capacity elements, reshape
+  // keeps using it until the blob outgrows the capacity
+  void bind_data(const void *data, size_t capacity) {
+    CHECK_NOTNULL(data);
+    CHECK_GT(capacity, 0);
+    if (data_ != nullptr && !shared_) {
       allocator_->free(data_);
-      data_ = nullptr;
     }
-    if (data_ == nullptr || shared_) {
+    data_ = const_cast<void *>(data);
+    capacity_ = capacity;
+    shared_ = true;
+  }
+
+  void reshape(const std::vector<int> &shape,
+               const Layout &layout = Layout::kNCHW) {
+    auto cou = static_cast<size_t>(storage_count(shape, layout));
+    CHECK_GT(cou, 0);
+    if (data_ == nullptr || cou > capacity_) {
+      if (data_ != nullptr && !shared_) {
+        allocator_->free(data_);
+      }
       data_ = allocator_->malloc(cou * elem_size(), nullptr);
       capacity_ = cou;
+      shared_ = false;
     }
     shape_ = shape;
+    layout_ = layout;
+  }
+
+  void release() {
+    if (data_ != nullptr && !shared_) {
+      allocator_->free(data_);
+    }
+    data_ = nullptr;
+    capacity_ = 0;
     shared_ = false;
   }
 
   const std::string &name() const { return name_; }
   const DataType &data_type() const { return data_type_; }
+  const Layout &layout() const { return layout_; }
+  int block() const { return static_cast<int>(layout_); }
   size_t capacity() const { return capacity_; }
   bool shared() const { return shared_; }
 
   void set_name(const std::string &name) { name_ = name; }
   void set_data_type(const DataType &data_type) { data_type_ = data_type; }
+  void set_layout(const Layout &layout) { layout_ = layout; }
   void set_capacity(size_t capacity) { capacity_ = capacity; }
   void set_shared(bool shared) { shared_ = shared; }
 
@@ -131,7 +163,11 @@ class Blob {
     return cou;
   }
 
-  size_t raw_size() const { return count() * elem_size(); }
+  // Number of elements in the storage, including the padded channels of
+  // blocked layouts
+  int storage_count() const { return storage_count(shape_, layout_); }
+
+  size_t raw_size() const { return storage_count() * elem_size(); }
   size_t max_size() const { return capacity_ * elem_size(); }
   size_t elem_size() const {
     if (data_type_ == DataType::kI32) {
@@ -140,6 +176,12 @@ class Blob {
       return sizeof(float);
     } else if (data_type_ == DataType::kU8) {
       return sizeof(unsigned char);
+    } else if (data_type_ == DataType::kI8) {
+      return sizeof(signed char);
+    } else if (data_type_ == DataType::kF16) {
+      return sizeof(Half);
+    } else if (data_type_ == DataType::kBF16) {
+      return sizeof(BFloat16);
     } else {
       return 0;
     }
@@ -155,6 +197,21 @@ class Blob {
   }
 
  private:
+  static int storage_count(const std::vector<int> &shape,
+                           const Layout &layout) {
+    int block = static_cast<int>(layout);
+    if (block == 1) {
+      return std::accumulate(shape.begin(), shape.end(), 1,
+                             std::multiplies<int>());
+    }
+    CHECK_GE(shape.size(), 2);
+    int cou = (shape[1] + block - 1) / block * block;
+    for (int i = 0; i < static_cast<int>(shape.size()); ++i) {
+      if (i != 1) cou *= shape[i];
+    }
+    return cou;
+  }
+
   template <typename T>
   static void check_data_type(DataType data_type) {
     if (std::is_same<T, int>::value) {
@@ -163,6 +220,12 @@ class Blob {
       CHECK(data_type == DataType::kF32);
     } else if (std::is_same<T, unsigned char>::value) {
       CHECK(data_type == DataType::kU8);
+    } else if (std::is_same<T, signed char>::value) {
+      CHECK(data_type == DataType::kI8);
+    } else if (std::is_same<T, Half>::value) {
+      CHECK(data_type == DataType::kF16);
+    } else if (std::is_same<T, BFloat16>::value) {
+      CHECK(data_type == DataType::kBF16);
     } else {
       LOG(FATAL) << "Invalid template typename " << typeid(T).name();
     }
@@ -174,6 +237,7 @@ class Blob {
 
   void *data_{nullptr};
   std::vector<int> shape_{};
+  Layout layout_{Layout::kNCHW};
   size_t capacity_{0};
   bool shared_{false};
 
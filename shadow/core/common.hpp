@@ -13,6 +13,16 @@
 #define SHADOW_ANONYMOUS_VARIABLE(s) SHADOW_CONCATENATE(s, __LINE__)
 #endif
 
+// Compiles a CPU kernel for AVX512 and AVX2 as well as the default target,
+// the version for the CPU it runs on is picked at load time where the
+// compiler supports target_clones
+#if defined(HAVE_TARGET_CLONES)
+#define SHADOW_CPU_TARGETS \
+  __attribute__((target_clones("arch=x86-64-v4", "arch=x86-64-v3", "default")))
+#else
+#define SHADOW_CPU_TARGETS
+#endif
+
 namespace Shadow {
 
 #define DISABLE_COPY_AND_ASSIGN(classname) \
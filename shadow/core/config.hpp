@@ -0,0 +1,14 @@
+#ifndef SHADOW_CORE_CONFIG_HPP
+#define SHADOW_CORE_CONFIG_HPP
+
+#define SHADOW_VERSION_MAJOR 0
+#define SHADOW_VERSION_MINOR 1
+#define SHADOW_VERSION_PATCH 0
+
+#define SHADOW_VERSION_STRING "0.1.0"
+
+#if !defined(USE_Protobuf)
+#define USE_Protobuf "3.21.12"
+#endif
+
+#endif  // SHADOW_CORE_CONFIG_HPP
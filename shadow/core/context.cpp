@@ -6,17 +6,30 @@ namespace Shadow {
 
 class CPUContext : public Context {
  public:
-  explicit CPUContext(const ArgumentHelper& arguments) {
+  CPUContext(const ArgumentHelper& arguments, const CPUContext* share) {
     device_id_ = arguments.GetSingleArgument<int>("device_id", 0);
 
     check_device(device_id_);
 
 #if defined(USE_NNPACK)
     CHECK_EQ(nnp_initialize(), nnp_status_success);
-    nnpack_handle_ = pthreadpool_create(0);
-    CHECK_NOTNULL(nnpack_handle_);
 #endif
 
+    if (share != nullptr) {
+      thread_pool_ = share->thread_pool_;
+#if defined(USE_NNPACK)
+      nnpack_handle_ = share->nnpack_handle_;
+#endif
+    } else {
+      thread_pool_ = std::make_shared<ThreadPool>(
+          arguments.GetSingleArgument<int>("num_threads", 1));
+#if defined(USE_NNPACK)
+      nnpack_handle_ = std::shared_ptr<pthreadpool>(
+          pthreadpool_create(thread_pool_->num_threads()), pthreadpool_destroy);
+      CHECK_NOTNULL(nnpack_handle_);
+#endif
+    }
+
 #if defined(USE_DNNL)
     dnnl_engine_ = std::make_shared<dnnl::engine>(
         dnnl::engine::kind::cpu, static_cast<size_t>(device_id_));
@@ -27,11 +40,7 @@ class CPUContext : public Context {
   }
   ~CPUContext() override {
 #if defined(USE_NNPACK)
-    if (nnpack_handle_ != nullptr) {
-      CHECK_EQ(nnp_deinitialize(), nnp_status_success);
-      pthreadpool_destroy(pthreadpool_t(nnpack_handle_));
-      nnpack_handle_ = nullptr;
-    }
+    CHECK_EQ(nnp_deinitialize(), nnp_status_success);
 #endif
   }
 
@@ -45,10 +54,15 @@ class CPUContext : public Context {
 
   void synchronize() override {}
 
+  ThreadPool* thread_pool() const override {
+    CHECK_NOTNULL(thread_pool_);
+    return thread_pool_.get();
+  }
+
 #if defined(USE_NNPACK)
   void* nnpack_handle() const override {
     CHECK_NOTNULL(nnpack_handle_);
-    return nnpack_handle_;
+    return nnpack_handle_.get();
   }
 #endif
 
@@ -77,8 +91,10 @@ class CPUContext : public Context {
 
   std::shared_ptr<Allocator> allocator_ = nullptr;
 
+  std::shared_ptr<ThreadPool> thread_pool_ = nullptr;
+
 #if defined(USE_NNPACK)
-  pthreadpool_t nnpack_handle_ = nullptr;
+  std::shared_ptr<pthreadpool> nnpack_handle_ = nullptr;
 #endif
 
 #if defined(USE_DNNL)
@@ -89,8 +105,9 @@ class CPUContext : public Context {
 
 template <>
 std::shared_ptr<Context> GetContext<DeviceType::kCPU>(
-    const ArgumentHelper& arguments) {
-  return std::make_shared<CPUContext>(arguments);
+    const ArgumentHelper& arguments, const Context* share) {
+  return std::make_shared<CPUContext>(
+      arguments, dynamic_cast<const CPUContext*>(share));
 }
 
 }  // namespace Shadow
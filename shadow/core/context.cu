@@ -107,9 +107,10 @@ class GPUContext : public Context {
 #endif
 };
 
+// Each clone of a network keeps a stream of its own, nothing is shared
 template <>
 std::shared_ptr<Context> GetContext<DeviceType::kGPU>(
-    const ArgumentHelper &arguments) {
+    const ArgumentHelper &arguments, const Context * /*share*/) {
   return std::make_shared<GPUContext>(arguments);
 }
 
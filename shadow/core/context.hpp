@@ -3,6 +3,7 @@
 
 #include "allocator.hpp"
 #include "helper.hpp"
+#include "thread_pool.hpp"
 
 #include <memory>
 
@@ -20,6 +21,8 @@ class Context {
   virtual void switch_device() = 0;
   virtual void synchronize() = 0;
 
+  virtual ThreadPool* thread_pool() const { return nullptr; }
+
   virtual void* cuda_stream() const { return nullptr; }
   virtual void* cublas_handle() const { return nullptr; }
   virtual void* cudnn_handle() const { return nullptr; }
@@ -28,8 +31,11 @@ class Context {
   virtual void* dnnl_stream() const { return nullptr; }
 };
 
+// A CPU context created with share runs on the threads of share instead of
+// starting its own, as the clones of a network do
 template <DeviceType D>
-std::shared_ptr<Context> GetContext(const ArgumentHelper& arguments);
+std::shared_ptr<Context> GetContext(const ArgumentHelper& arguments,
+                                    const Context* share = nullptr);
 
 }  // namespace Shadow
 
@@ -0,0 +1,978 @@
+#include "graph_optimizer.hpp"
+
+#include "operator.hpp"
+
+#include "operators/activate_op.hpp"
+#include "operators/binary_op.hpp"
+#include "operators/fused_op.hpp"
+
+#include "util/log.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+
+namespace Shadow {
+
+inline void remove_argument(shadow::OpParam *op_param,
+                            const std::string &name) {
+  std::vector<shadow::Argument> args;
+  for (const auto &arg : op_param->arg()) {
+    if (arg.name() != name) {
+      args.push_back(arg);
+    }
+  }
+  op_param->clear_arg();
+  for (const auto &arg : args) {
+    op_param->add_arg()->CopyFrom(arg);
+  }
+}
+
+// Moves the data of a blob sharing outside memory into its own storage
+inline void own_data(Blob *blob, Context *context) {
+  if (!blob->shared()) return;
+  std::vector<unsigned char> data(blob->raw_size());
+  context->allocator()->read(data.size(), blob->data<void>(), data.data());
+  const auto shape = blob->shape();
+  blob->release();
+  blob->reshape(shape);
+  context->allocator()->write(data.size(), data.data(),
+                              blob->mutable_data<void>());
+}
+
+inline void remove_ops(shadow::NetParam *net_param,
+                       const std::vector<bool> &removed) {
+  std::vector<shadow::OpParam> ops;
+  for (int n = 0; n < net_param->op_size(); ++n) {
+    if (!removed[n]) {
+      ops.push_back(net_param->op(n));
+    }
+  }
+  net_param->clear_op();
+  for (const auto &op : ops) {
+    net_param->add_op()->CopyFrom(op);
+  }
+}
+
+inline std::string blob_type_name(const DataType &data_type) {
+  switch (data_type) {
+    case DataType::kI32:
+      return "int";
+    case DataType::kF32:
+      return "float";
+    case DataType::kU8:
+      return "unsigned char";
+    case DataType::kI8:
+      return "signed char";
+    case DataType::kF16:
+      return "half";
+    case DataType::kBF16:
+      return "bfloat16";
+    default:
+      LOG(FATAL) << "Unsupported data type";
+  }
+  return "";
+}
+
+// Builds the instructions of a Fused operator, blobs computed by the fused
+// operators map to their registers and the other blobs become bottoms
+struct FusedExpression {
+  int Emit(int opcode, int a, int b, int c) {
+    code.insert(code.end(), {opcode, a, b, c});
+    return static_cast<int>(code.size()) / 4 - 1;
+  }
+
+  int Imm(float value) {
+    imm.push_back(value);
+    return static_cast<int>(imm.size()) - 1;
+  }
+
+  int Input(const std::string &blob_name, int axis = -1) {
+    if (axis < 0 && regs.count(blob_name)) {
+      return regs.at(blob_name);
+    }
+    for (int n = 0; n < static_cast<int>(bottoms.size()); ++n) {
+      if (bottoms[n] == blob_name && input_axis[n] == axis) {
+        return input_regs[n];
+      }
+    }
+    bottoms.push_back(blob_name), input_axis.push_back(axis);
+    input_regs.push_back(
+        Emit(FusedOp::kInput, static_cast<int>(bottoms.size()) - 1, 0, 0));
+    return input_regs.back();
+  }
+
+  VecInt code, input_axis, input_regs;
+  VecFloat imm;
+  VecString bottoms;
+  std::map<std::string, int> regs;
+};
+
+void GraphOptimizer::Optimize(shadow::NetParam *net_param) {
+  Attach(net_param);
+
+  using std::placeholders::_1;
+  using std::placeholders::_2;
+  const VecString affine_types{"Conv", "Deconv", "Connected"};
+  const std::vector<FusePass> passes{
+      {affine_types, "BatchNorm",
+       std::bind(&GraphOptimizer::FoldBatchNorm, this, _1, _2)},
+      {affine_types, "Scale",
+       std::bind(&GraphOptimizer::FoldScale, this, _1, _2)},
+      {affine_types, "Activate",
+       std::bind(&GraphOptimizer::FoldActivate, this, _1, _2)}};
+
+  int num_ops = net_param_->op_size();
+  FoldConstants();
+  bool changed = true;
+  while (changed) {
+    changed = false;
+    for (const auto &pass : passes) {
+      while (RunFusePass(pass)) {
+        changed = true;
+      }
+    }
+  }
+  while (EliminateDeadOps()) {
+  }
+  PruneBlobs();
+
+  DLOG(INFO) << "Graph optimizer: " << num_ops << " ops to "
+             << net_param_->op_size() << " ops";
+  net_param_ = nullptr;
+}
+
+void GraphOptimizer::PropagateLayout(shadow::NetParam *net_param, int block) {
+  CHECK(block == 8 || block == 16) << "Unsupported layout block " << block;
+  Attach(net_param);
+  for (const auto &op_param : net_param_->op()) {
+    // The layouts are already assigned
+    if (op_param.type() == "Reorder") {
+      net_param_ = nullptr;
+      return;
+    }
+  }
+
+  std::vector<shadow::OpParam> ops;
+  std::set<std::string> blocked;
+  // The reordered copies of the blobs, valid until the blob is written again
+  std::map<std::string, std::string> blocked_copy, plain_copy;
+  std::map<std::string, int> num_copies;
+  int num_reorders = 0;
+  auto reorder = [&](const std::string &blob_name, bool to_blocked) {
+    auto &copies = to_blocked ? blocked_copy : plain_copy;
+    if (copies.count(blob_name)) {
+      return copies.at(blob_name);
+    }
+    auto copy_name =
+        blob_name + (to_blocked ? "/nchw" + std::to_string(block) + "c"
+                                : std::string("/nchw"));
+    int index = num_copies[copy_name]++;
+    if (index > 0) {
+      copy_name += "_" + std::to_string(index);
+    }
+    shadow::OpParam reorder_param;
+    reorder_param.set_type("Reorder");
+    reorder_param.set_name(copy_name);
+    reorder_param.add_bottom(blob_name);
+    reorder_param.add_top(copy_name);
+    add_s_i(&reorder_param, "layout", to_blocked ? block : 1);
+    ops.push_back(reorder_param);
+    if (to_blocked) {
+      blocked.insert(copy_name);
+    }
+    num_reorders++;
+    return copies[blob_name] = copy_name;
+  };
+
+  for (const auto &op : net_param_->op()) {
+    auto op_param = op;
+    bool writes_out = false;
+    for (const auto &top : op_param.top()) {
+      writes_out |= std::find(out_blob_.begin(), out_blob_.end(), top) !=
+                    out_blob_.end();
+    }
+    // Eltwise and Fused read all bottoms in one layout, the others read only
+    // the first bottom as data
+    int num_inputs =
+        op_param.type() == "Eltwise" || op_param.type() == "Fused"
+            ? op_param.bottom_size()
+            : std::min(op_param.bottom_size(), 1);
+    bool has_blocked = false;
+    for (int n = 0; n < num_inputs; ++n) {
+      has_blocked |= blocked.count(op_param.bottom(n)) > 0;
+    }
+    int kind = LayoutKind(op_param);
+    bool run_blocked =
+        !writes_out && (kind == kLayoutBlocked ||
+                        (kind == kLayoutFollow && has_blocked));
+
+    for (int n = 0; n < op_param.bottom_size(); ++n) {
+      const auto bottom = op_param.bottom(n);
+      bool is_blocked = blocked.count(bottom) > 0;
+      if (run_blocked && n < num_inputs && !is_blocked) {
+        op_param.set_bottom(n, reorder(bottom, true));
+      } else if ((!run_blocked || n >= num_inputs) && is_blocked) {
+        op_param.set_bottom(n, reorder(bottom, false));
+      }
+    }
+    // Conv derives its blocked weights when it is created
+    if (run_blocked && op_param.type() == "Conv") {
+      add_s_i(&op_param, "layout", block);
+    }
+    for (const auto &top : op_param.top()) {
+      blocked_copy.erase(top), plain_copy.erase(top);
+      if (run_blocked) {
+        blocked.insert(top);
+      } else {
+        blocked.erase(top);
+      }
+    }
+    ops.push_back(op_param);
+  }
+
+  net_param_->clear_op();
+  for (const auto &op_param : ops) {
+    net_param_->add_op()->CopyFrom(op_param);
+  }
+
+  DLOG(INFO) << "Layout propagation: " << num_reorders << " reorders";
+  net_param_ = nullptr;
+}
+
+void GraphOptimizer::ReduceWeights(shadow::NetParam *net_param,
+                                   const std::string &weight_type) {
+  CHECK(weight_type == "half" || weight_type == "bfloat16")
+      << "Unsupported weight type " << weight_type;
+  Attach(net_param);
+  bool is_half = weight_type == "half";
+  std::map<std::string, std::string> reduced;
+  for (auto &op_param : *net_param_->mutable_op()) {
+    const auto &type = op_param.type();
+    if ((type != "Connected" && type != "MatMul") ||
+        op_param.bottom_size() < 2) {
+      continue;
+    }
+    const auto weight_name = op_param.bottom(1);
+    if (!reduced.count(weight_name)) {
+      // Quantized weights are not float and stay as they are
+      VecFloat data;
+      if (!GetWeightData(weight_name, &data)) continue;
+      const auto &reduced_name =
+          weight_name + (is_half ? "/half" : "/bfloat16");
+      const auto &shape = ws_->GetBlobShape(weight_name);
+      auto blob = ws_->CreateBlob(reduced_name,
+                                  is_half ? DataType::kF16 : DataType::kBF16);
+      blob->reshape(shape);
+      int count = static_cast<int>(data.size());
+      if (is_half) {
+        std::vector<Half> half_data(count);
+        for (int i = 0; i < count; ++i) {
+          half_data[i] = float_to_half(data[i]);
+        }
+        blob->set_data<Half>(half_data.data(), count);
+      } else {
+        std::vector<BFloat16> bfloat16_data(count);
+        for (int i = 0; i < count; ++i) {
+          bfloat16_data[i] = float_to_bfloat16(data[i]);
+        }
+        blob->set_data<BFloat16>(bfloat16_data.data(), count);
+      }
+      auto *blob_param = net_param_->add_blob();
+      blob_param->set_name(reduced_name);
+      blob_param->set_type(weight_type);
+      for (auto dim : shape) {
+        blob_param->add_shape(dim);
+      }
+      weight_names_.insert(reduced_name);
+      reduced[weight_name] = reduced_name;
+    }
+    op_param.set_bottom(1, reduced.at(weight_name));
+  }
+  PruneBlobs();
+
+  DLOG(INFO) << "Reduced " << reduced.size() << " weights to " << weight_type;
+  net_param_ = nullptr;
+}
+
+void GraphOptimizer::FuseElementwise(shadow::NetParam *net_param) {
+#if !defined(USE_CUDA)
+  Attach(net_param);
+  int num_ops = net_param_->op_size();
+  // The writer of each bottom, -1 for weights and inputs, the outputs of the
+  // network count as readers of their last writers
+  std::vector<VecInt> writers(num_ops);
+  std::map<std::string, int> last_writer;
+  VecInt num_readers(num_ops, 0);
+  for (int n = 0; n < num_ops; ++n) {
+    const auto &op_param = net_param_->op(n);
+    for (const auto &bottom : op_param.bottom()) {
+      int writer = last_writer.count(bottom) ? last_writer.at(bottom) : -1;
+      writers[n].push_back(writer);
+      if (writer >= 0) {
+        num_readers[writer]++;
+      }
+    }
+    for (const auto &top : op_param.top()) {
+      last_writer[top] = n;
+    }
+  }
+  for (const auto &blob_name : out_blob_) {
+    if (last_writer.count(blob_name)) {
+      num_readers[last_writer.at(blob_name)]++;
+    }
+  }
+
+  // The fused operator runs in place of the last member, the operators in
+  // between must not overwrite the bottoms read by the earlier members
+  auto can_fuse = [&](const VecInt &members) {
+    std::set<int> member_set(members.begin(), members.end());
+    std::set<std::string> inputs;
+    for (int m : members) {
+      for (int k = 0; k < static_cast<int>(writers[m].size()); ++k) {
+        if (!member_set.count(writers[m][k])) {
+          inputs.insert(net_param_->op(m).bottom(k));
+        }
+      }
+    }
+    for (int n = members.front() + 1; n < members.back(); ++n) {
+      if (member_set.count(n)) continue;
+      for (const auto &top : net_param_->op(n).top()) {
+        if (inputs.count(top)) return false;
+      }
+    }
+    return true;
+  };
+
+  VecInt group(num_ops, -1);
+  std::vector<VecInt> groups;
+  for (int n = 0; n < num_ops; ++n) {
+    if (!IsElementwise(net_param_->op(n))) continue;
+    VecInt members{n};
+    for (int writer : writers[n]) {
+      if (writer < 0 || group[writer] < 0 || num_readers[writer] != 1 ||
+          std::find(members.begin(), members.end(), writer) !=
+              members.end()) {
+        continue;
+      }
+      auto merged = groups[group[writer]];
+      merged.insert(merged.end(), members.begin(), members.end());
+      std::sort(merged.begin(), merged.end());
+      if (can_fuse(merged)) {
+        groups[group[writer]].clear();
+        members = merged;
+      }
+    }
+    for (int m : members) {
+      group[m] = static_cast<int>(groups.size());
+    }
+    groups.push_back(members);
+  }
+
+  std::vector<shadow::OpParam> ops;
+  int num_fused = 0, num_fused_ops = 0;
+  for (int n = 0; n < num_ops; ++n) {
+    const auto &op_param = net_param_->op(n);
+    const auto *members = group[n] >= 0 ? &groups[group[n]] : nullptr;
+    // A single Eltwise is fused when it takes more than one pass
+    bool fuse = members != nullptr &&
+                (members->size() > 1 ||
+                 (op_param.type() == "Eltwise" &&
+                  (op_param.bottom_size() > 2 ||
+                   ArgumentHelper(op_param).HasArgument("coeff"))));
+    if (!fuse) {
+      ops.push_back(op_param);
+    } else if (n == members->back()) {
+      ops.push_back(MakeFused(*members));
+      num_fused += static_cast<int>(members->size()), num_fused_ops++;
+    }
+  }
+  net_param_->clear_op();
+  for (const auto &op_param : ops) {
+    net_param_->add_op()->CopyFrom(op_param);
+  }
+  PruneBlobs();
+
+  DLOG(INFO) << "Elementwise fusion: " << num_fused << " ops to "
+             << num_fused_ops << " fused ops";
+  net_param_ = nullptr;
+#endif
+}
+
+void GraphOptimizer::Attach(shadow::NetParam *net_param) {
+  net_param_ = net_param;
+  weight_names_.clear();
+  for (const auto &blob : net_param_->blob()) {
+    weight_names_.insert(blob.name());
+  }
+  out_blob_ = ArgumentHelper(*net_param_).GetRepeatedArgument<std::string>(
+      "out_blob", {});
+}
+
+bool GraphOptimizer::FoldConstants() {
+  int num_ops = net_param_->op_size();
+  std::map<std::string, int> num_writers;
+  for (const auto &op_param : net_param_->op()) {
+    for (const auto &top : op_param.top()) {
+      num_writers[top]++;
+    }
+  }
+
+  std::vector<bool> removed(num_ops, false);
+  bool has_folded = false;
+  for (int n = 0; n < num_ops; ++n) {
+    const auto &op_param = net_param_->op(n);
+    // A top written by other operators as well has to stay a computed blob
+    bool foldable = op_param.bottom_size() > 0;
+    for (const auto &bottom : op_param.bottom()) {
+      foldable &= IsConstant(bottom);
+    }
+    for (const auto &top : op_param.top()) {
+      foldable &= num_writers.at(top) == 1;
+    }
+    if (!foldable) continue;
+
+    // Weights written in place get their own copy first, shared weights may
+    // be mapped read only
+    for (const auto &top : op_param.top()) {
+      const auto &bottoms = op_param.bottom();
+      if (std::find(bottoms.begin(), bottoms.end(), top) != bottoms.end()) {
+        own_data(ws_->GetBlob(top).get(), ws_->Ctx());
+      }
+    }
+    std::shared_ptr<Operator> op(CreateOperator(op_param, ws_));
+    op->Forward();
+    for (int i = 0; i < op->tops_size(); ++i) {
+      auto top = op->tops(i);
+      // Tops viewing their bottoms get their own copy, the bottoms may be
+      // released once no operator reads them
+      own_data(top.get(), ws_->Ctx());
+      const auto &top_name = op_param.top(i);
+      if (!weight_names_.count(top_name)) {
+        weight_names_.insert(top_name);
+        net_param_->add_blob()->set_name(top_name);
+      }
+      for (auto &blob_param : *net_param_->mutable_blob()) {
+        if (blob_param.name() == top_name) {
+          blob_param.set_type(blob_type_name(top->data_type()));
+          blob_param.clear_shape();
+          for (auto dim : top->shape()) {
+            blob_param.add_shape(dim);
+          }
+        }
+      }
+    }
+    removed[n] = has_folded = true;
+    DLOG(INFO) << "Folded constant operator " << op_param.name();
+  }
+  if (has_folded) {
+    remove_ops(net_param_, removed);
+  }
+  return has_folded;
+}
+
+// Fuses the first operator of pass.types whose top is only read by an
+// operator of pass.next_type, the top must not be an output of the network
+bool GraphOptimizer::RunFusePass(const FusePass &pass) {
+  int num_ops = net_param_->op_size();
+  std::map<std::string, int> last_writer;
+  std::vector<int> num_readers(num_ops, 0), reader(num_ops, -1);
+  for (int n = 0; n < num_ops; ++n) {
+    const auto &op_param = net_param_->op(n);
+    for (const auto &bottom : op_param.bottom()) {
+      if (last_writer.count(bottom)) {
+        int writer = last_writer.at(bottom);
+        num_readers[writer]++, reader[writer] = n;
+      }
+    }
+    for (const auto &top : op_param.top()) {
+      last_writer[top] = n;
+    }
+  }
+
+  for (int n = 0; n < num_ops; ++n) {
+    const auto &op_param = net_param_->op(n);
+    if (std::find(pass.types.begin(), pass.types.end(), op_param.type()) ==
+            pass.types.end() ||
+        op_param.top_size() != 1 || num_readers[n] != 1) {
+      continue;
+    }
+    const auto &top_name = op_param.top(0);
+    if (last_writer.at(top_name) == n &&
+        std::find(out_blob_.begin(), out_blob_.end(), top_name) !=
+            out_blob_.end()) {
+      continue;
+    }
+    int next = reader[n];
+    const auto &next_param = net_param_->op(next);
+    if (next_param.type() != pass.next_type || next_param.top_size() != 1 ||
+        next_param.bottom(0) != top_name) {
+      continue;
+    }
+    // The fused operator writes the top of next earlier, nothing in between
+    // may touch that blob
+    const auto &next_top_name = next_param.top(0);
+    bool touched = false;
+    for (int i = n + 1; i < next && !touched; ++i) {
+      const auto &op = net_param_->op(i);
+      touched =
+          std::find(op.bottom().begin(), op.bottom().end(), next_top_name) !=
+              op.bottom().end() ||
+          std::find(op.top().begin(), op.top().end(), next_top_name) !=
+              op.top().end();
+    }
+    if (touched) continue;
+
+    auto *fused_param = net_param_->mutable_op(n);
+    if (!pass.fuse(fused_param, next_param)) continue;
+    fused_param->set_top(0, next_top_name);
+    std::vector<bool> removed(num_ops, false);
+    removed[next] = true;
+    remove_ops(net_param_, removed);
+    return true;
+  }
+  return false;
+}
+
+bool GraphOptimizer::EliminateDeadOps() {
+  int num_ops = net_param_->op_size();
+  std::set<std::string> live(out_blob_.begin(), out_blob_.end());
+  std::vector<bool> removed(num_ops, false);
+  bool has_removed = false;
+  for (int n = num_ops - 1; n >= 0; --n) {
+    const auto &op_param = net_param_->op(n);
+    bool is_live = op_param.type() == "Input";
+    for (const auto &top : op_param.top()) {
+      is_live |= live.count(top) > 0;
+    }
+    if (!is_live) {
+      removed[n] = has_removed = true;
+      continue;
+    }
+    for (const auto &top : op_param.top()) {
+      live.erase(top);
+    }
+    for (const auto &bottom : op_param.bottom()) {
+      live.insert(bottom);
+    }
+  }
+  if (has_removed) {
+    remove_ops(net_param_, removed);
+  }
+  return has_removed;
+}
+
+// Drops the weights no operator uses any more
+void GraphOptimizer::PruneBlobs() {
+  std::set<std::string> used(out_blob_.begin(), out_blob_.end());
+  for (const auto &op_param : net_param_->op()) {
+    used.insert(op_param.bottom().begin(), op_param.bottom().end());
+  }
+  std::vector<shadow::Blob> blobs;
+  for (const auto &blob : net_param_->blob()) {
+    if (used.count(blob.name())) {
+      blobs.push_back(blob);
+    } else if (ws_->HasBlob(blob.name())) {
+      ws_->GetBlob(blob.name())->release();
+    }
+  }
+  net_param_->clear_blob();
+  for (const auto &blob : blobs) {
+    net_param_->add_blob()->CopyFrom(blob);
+  }
+}
+
+bool GraphOptimizer::FoldBatchNorm(shadow::OpParam *op_param,
+                                   const shadow::OpParam &bn_param) {
+  ArgumentHelper arguments(bn_param);
+  if (!arguments.GetSingleArgument<bool>("use_global_stats", true) ||
+      bn_param.bottom_size() < 3) {
+    return false;
+  }
+  VecFloat mean, variance, scale{1};
+  if (!GetWeightData(bn_param.bottom(1), &mean) ||
+      !GetWeightData(bn_param.bottom(2), &variance) ||
+      mean.size() != variance.size()) {
+    return false;
+  }
+  if (bn_param.bottom_size() == 4 &&
+      (!GetWeightData(bn_param.bottom(3), &scale) || scale.size() != 1)) {
+    return false;
+  }
+  float eps = arguments.GetSingleArgument<float>("eps", 1e-5);
+  float scale_factor = scale[0] == 0 ? 0 : 1 / scale[0];
+  VecFloat bn_scale(mean.size()), bn_shift(mean.size());
+  for (int c = 0; c < static_cast<int>(mean.size()); ++c) {
+    bn_scale[c] = 1 / std::sqrt(variance[c] * scale_factor + eps);
+    bn_shift[c] = -mean[c] * scale_factor * bn_scale[c];
+  }
+  return FoldChannelAffine(op_param, bn_scale, bn_shift);
+}
+
+bool GraphOptimizer::FoldScale(shadow::OpParam *op_param,
+                               const shadow::OpParam &scale_param) {
+  ArgumentHelper arguments(scale_param);
+  if (arguments.GetSingleArgument<int>("axis", 1) != 1) return false;
+  bool has_scale = arguments.GetSingleArgument<bool>("has_scale", true);
+  bool has_bias = arguments.GetSingleArgument<bool>("has_bias", true);
+  auto scale = arguments.GetRepeatedArgument<float>("scale_value", {});
+  auto bias = arguments.GetRepeatedArgument<float>("bias_value", {});
+  if (scale.empty() && bias.empty()) {
+    if (has_scale && has_bias) {
+      if (scale_param.bottom_size() != 3 ||
+          !GetWeightData(scale_param.bottom(1), &scale) ||
+          !GetWeightData(scale_param.bottom(2), &bias)) {
+        return false;
+      }
+    } else if (scale_param.bottom_size() != 2 ||
+               !GetWeightData(scale_param.bottom(1),
+                              has_scale ? &scale : &bias)) {
+      return false;
+    }
+  } else if (scale_param.bottom_size() != 1) {
+    return false;
+  }
+  return FoldChannelAffine(op_param, scale, bias);
+}
+
+bool GraphOptimizer::FoldActivate(shadow::OpParam *op_param,
+                                  const shadow::OpParam &activate_param) {
+  // Operators have a built in Relu, Conv has a built in Relu6 as well
+  ArgumentHelper arguments(activate_param);
+  int type = arguments.GetSingleArgument<int>("type", 1);
+  if ((type != 1 && !(type == 6 && op_param->type() == "Conv")) ||
+      activate_param.bottom_size() != 1 ||
+      ArgumentHelper(*op_param).GetSingleArgument<int>("type", -1) != -1) {
+    return false;
+  }
+  remove_argument(op_param, "type");
+  add_s_i(op_param, "type", type);
+  return true;
+}
+
+bool GraphOptimizer::FoldChannelAffine(shadow::OpParam *op_param,
+                                       VecFloat scale, VecFloat shift) {
+  ArgumentHelper arguments(*op_param);
+  int num_output = arguments.GetSingleArgument<int>("num_output", 0);
+  bool bias_term = arguments.GetSingleArgument<bool>("bias_term", true);
+  // The affine map can not move across a built in activation
+  if (num_output <= 0 || op_param->bottom_size() != (bias_term ? 3 : 2) ||
+      arguments.GetSingleArgument<int>("type", -1) != -1) {
+    return false;
+  }
+
+  for (auto *param : {&scale, &shift}) {
+    if (param->size() == 1) {
+      param->assign(num_output, param->front());
+    }
+  }
+  if (scale.empty()) {
+    scale.assign(num_output, 1);
+  }
+  if (shift.empty()) {
+    shift.assign(num_output, 0);
+  }
+  if (static_cast<int>(scale.size()) != num_output ||
+      static_cast<int>(shift.size()) != num_output) {
+    return false;
+  }
+
+  VecFloat weight, bias(num_output, 0);
+  if (!GetWeightData(op_param->bottom(1), &weight) ||
+      (bias_term && (!GetWeightData(op_param->bottom(2), &bias) ||
+                     static_cast<int>(bias.size()) != num_output))) {
+    return false;
+  }
+  const auto &weight_shape = ws_->GetBlobShape(op_param->bottom(1));
+
+  // Weights are laid out as outer x num_output x inner
+  int count = static_cast<int>(weight.size()), outer = 1;
+  const auto &type = op_param->type();
+  if (type == "Connected") {
+    if (!arguments.GetSingleArgument<bool>("transpose", true)) {
+      outer = count / num_output;
+    }
+  } else if (type == "Deconv") {
+    if (arguments.GetSingleArgument<int>("group", 1) != 1) return false;
+    outer = weight_shape[0];
+  }
+  if (count % (outer * num_output) != 0) return false;
+  int inner = count / (outer * num_output);
+
+  for (int o = 0; o < outer; ++o) {
+    for (int c = 0; c < num_output; ++c) {
+      auto *weight_data = weight.data() + (o * num_output + c) * inner;
+      for (int i = 0; i < inner; ++i) {
+        weight_data[i] *= scale[c];
+      }
+    }
+  }
+  for (int c = 0; c < num_output; ++c) {
+    bias[c] = bias[c] * scale[c] + shift[c];
+  }
+
+  const auto &weight_name = op_param->name() + "/merged_weights:0";
+  const auto &bias_name = op_param->name() + "/merged_weights:1";
+  SetWeightData(weight_name, weight_shape, weight);
+  SetWeightData(bias_name, {num_output}, bias);
+  op_param->set_bottom(1, weight_name);
+  if (bias_term) {
+    op_param->set_bottom(2, bias_name);
+  } else {
+    op_param->add_bottom(bias_name);
+    remove_argument(op_param, "bias_term");
+  }
+  return true;
+}
+
+bool GraphOptimizer::IsElementwise(const shadow::OpParam &op_param) const {
+  ArgumentHelper arguments(op_param);
+  // Quantized operators and operators on other types than float keep their
+  // own kernels
+  if (op_param.top_size() != 1 || op_param.bottom_size() == 0 ||
+      arguments.HasArgument("out_scale") ||
+      arguments.HasArgument(op_param.top(0) + "_type")) {
+    return false;
+  }
+  const auto &type = op_param.type();
+  int num_bottoms = op_param.bottom_size();
+  if (type == "Eltwise") {
+    int operation = arguments.GetSingleArgument<int>("operation", 1);
+    const auto &coeff = arguments.GetRepeatedArgument<float>("coeff", {});
+    return num_bottoms >= 2 && operation >= 0 && operation <= 3 &&
+           (coeff.empty() ||
+            (operation == 1 && static_cast<int>(coeff.size()) == num_bottoms));
+  } else if (type == "Binary") {
+    int operation = arguments.GetSingleArgument<int>("operation", -1);
+    return operation >= 0 && operation <= 6 &&
+           (arguments.HasArgument("scalar") || num_bottoms == 2);
+  } else if (type == "Unary") {
+    int operation = arguments.GetSingleArgument<int>("operation", -1);
+    return operation >= 0 && operation <= 14;
+  } else if (type == "Activate") {
+    int activate_type = arguments.GetSingleArgument<int>("type", 1);
+    return (activate_type > 0 && activate_type <= 6) ||
+           (activate_type == 0 && num_bottoms == 2);
+  } else if (type == "Scale") {
+    if (arguments.GetSingleArgument<int>("axis", 1) < 0) return false;
+    if (arguments.HasArgument("scale_value") ||
+        arguments.HasArgument("bias_value")) {
+      return true;
+    }
+    bool has_scale = arguments.GetSingleArgument<bool>("has_scale", true);
+    bool has_bias = arguments.GetSingleArgument<bool>("has_bias", true);
+    return (has_scale || has_bias) && num_bottoms == 1 + has_scale + has_bias;
+  } else if (type == "Axpy") {
+    return num_bottoms == 3;
+  }
+  return false;
+}
+
+shadow::OpParam GraphOptimizer::MakeFused(const VecInt &members) {
+  FusedExpression expression;
+  bool follow_layout = true;
+  for (int m : members) {
+    const auto &op_param = net_param_->op(m);
+    ArgumentHelper arguments(op_param);
+    const auto &type = op_param.type();
+    int out = -1;
+    if (type == "Eltwise") {
+      // Prod: 0, Sum: 1, Max: 2, Min: 3
+      const int operations[] = {BinaryOp::kMul, BinaryOp::kAdd, BinaryOp::kMax,
+                                BinaryOp::kMin};
+      int operation = arguments.GetSingleArgument<int>("operation", 1);
+      const auto &coeff = arguments.GetRepeatedArgument<float>("coeff", {});
+      for (int n = 0; n < op_param.bottom_size(); ++n) {
+        int x = expression.Input(op_param.bottom(n));
+        if (!coeff.empty() && coeff[n] != 1) {
+          x = expression.Emit(FusedOp::kBinaryScalar, x,
+                              expression.Imm(coeff[n]), BinaryOp::kMul);
+        }
+        out = n == 0 ? x
+                     : expression.Emit(FusedOp::kBinary, out, x,
+                                       operations[operation]);
+      }
+    } else if (type == "Binary") {
+      int operation = arguments.GetSingleArgument<int>("operation", -1);
+      int x = expression.Input(op_param.bottom(0));
+      if (arguments.HasArgument("scalar")) {
+        float scalar = arguments.GetSingleArgument<float>("scalar", 0);
+        out = expression.Emit(FusedOp::kBinaryScalar, x,
+                              expression.Imm(scalar), operation);
+      } else {
+        out = expression.Emit(FusedOp::kBinary, x,
+                              expression.Input(op_param.bottom(1)), operation);
+      }
+      follow_layout = false;
+    } else if (type == "Unary") {
+      int operation = arguments.GetSingleArgument<int>("operation", -1);
+      out = expression.Emit(FusedOp::kUnary,
+                            expression.Input(op_param.bottom(0)), operation, 0);
+      follow_layout = false;
+    } else if (type == "Activate") {
+      int activate_type = arguments.GetSingleArgument<int>("type", 1);
+      int x = expression.Input(op_param.bottom(0));
+      if (activate_type == ActivateOp::kPRelu) {
+        out = expression.Emit(FusedOp::kActivate, x, activate_type,
+                              expression.Input(op_param.bottom(1), 1));
+        follow_layout = false;
+      } else {
+        float slope = arguments.GetSingleArgument<float>("slope", 0.1);
+        out = expression.Emit(FusedOp::kActivate, x, activate_type,
+                              expression.Imm(slope));
+      }
+    } else if (type == "Scale") {
+      int axis = arguments.GetSingleArgument<int>("axis", 1);
+      out = expression.Input(op_param.bottom(0));
+      // Parameters of one value are immediates, the others are weights
+      auto apply = [&](const std::string &value_name, int operation) {
+        const auto &value = arguments.GetRepeatedArgument<float>(value_name);
+        if (value.size() == 1) {
+          out = expression.Emit(FusedOp::kBinaryScalar, out,
+                                expression.Imm(value[0]), operation);
+        } else if (value.size() > 1) {
+          const auto &weight_name = op_param.name() + "/" + value_name;
+          SetWeightData(weight_name, {static_cast<int>(value.size())}, value);
+          out = expression.Emit(FusedOp::kBinary, out,
+                                expression.Input(weight_name, axis), operation);
+        }
+      };
+      if (arguments.HasArgument("scale_value") ||
+          arguments.HasArgument("bias_value")) {
+        apply("scale_value", BinaryOp::kMul);
+        apply("bias_value", BinaryOp::kAdd);
+      } else {
+        bool has_scale = arguments.GetSingleArgument<bool>("has_scale", true);
+        bool has_bias = arguments.GetSingleArgument<bool>("has_bias", true);
+        if (has_scale) {
+          out = expression.Emit(FusedOp::kBinary, out,
+                                expression.Input(op_param.bottom(1), axis),
+                                BinaryOp::kMul);
+        }
+        if (has_bias) {
+          out = expression.Emit(
+              FusedOp::kBinary, out,
+              expression.Input(op_param.bottom(has_scale ? 2 : 1), axis),
+              BinaryOp::kAdd);
+        }
+      }
+      follow_layout = false;
+    } else {
+      CHECK_EQ(type, "Axpy");
+      // F = a * X + Y, a is N x C
+      int ax = expression.Emit(FusedOp::kBinary,
+                               expression.Input(op_param.bottom(0), 0),
+                               expression.Input(op_param.bottom(1)),
+                               BinaryOp::kMul);
+      out = expression.Emit(FusedOp::kBinary, ax,
+                            expression.Input(op_param.bottom(2)),
+                            BinaryOp::kAdd);
+      follow_layout = false;
+    }
+    expression.regs[op_param.top(0)] = out;
+  }
+
+  const auto &last_param = net_param_->op(members.back());
+  // The output is the last register, a top passing a bottom through is
+  // copied
+  int out = expression.regs.at(last_param.top(0));
+  if (out != static_cast<int>(expression.code.size()) / 4 - 1) {
+    expression.Emit(FusedOp::kBinaryScalar, out, expression.Imm(0),
+                    BinaryOp::kAdd);
+  }
+
+  shadow::OpParam fused_param;
+  fused_param.set_type("Fused");
+  fused_param.set_name(last_param.name());
+  for (const auto &bottom : expression.bottoms) {
+    fused_param.add_bottom(bottom);
+  }
+  fused_param.add_top(last_param.top(0));
+  add_v_i(&fused_param, "code", expression.code);
+  add_v_f(&fused_param, "imm", expression.imm);
+  add_v_i(&fused_param, "input_axis", expression.input_axis);
+  add_s_i(&fused_param, "follow_layout", follow_layout);
+  return fused_param;
+}
+
+int GraphOptimizer::LayoutKind(const shadow::OpParam &op_param) const {
+  // Channel wise parameters must be weights, so that they keep NCHW
+  for (int n = 1; n < op_param.bottom_size(); ++n) {
+    if (op_param.type() != "Eltwise" && op_param.type() != "Fused" &&
+        !weight_names_.count(op_param.bottom(n))) {
+      return kLayoutNCHW;
+    }
+  }
+  ArgumentHelper arguments(op_param);
+  // Quantized operators only run in NCHW
+  if (arguments.HasArgument("out_scale")) return kLayoutNCHW;
+  const auto &type = op_param.type();
+  if (type == "Conv") {
+    if (op_param.bottom_size() < 2) return kLayoutNCHW;
+    const auto &weight_shape = ws_->GetBlobShape(op_param.bottom(1));
+    int num_output = arguments.GetSingleArgument<int>("num_output", 0);
+    int group = arguments.GetSingleArgument<int>("group", 1);
+    if (weight_shape.size() == 4 &&
+        (group == 1 || (group == num_output && weight_shape[1] == 1))) {
+      return kLayoutBlocked;
+    }
+  } else if (type == "Scale") {
+    if (arguments.GetSingleArgument<int>("axis", 1) == 1) {
+      return kLayoutFollow;
+    }
+  } else if (type == "BatchNorm") {
+    if (arguments.GetSingleArgument<bool>("use_global_stats", true) &&
+        op_param.bottom_size() >= 3) {
+      return kLayoutFollow;
+    }
+  } else if (type == "Pooling" || type == "Activate" || type == "Eltwise") {
+    return kLayoutFollow;
+  } else if (type == "Fused") {
+    if (arguments.GetSingleArgument<bool>("follow_layout", false)) {
+      return kLayoutFollow;
+    }
+  }
+  return kLayoutNCHW;
+}
+
+bool GraphOptimizer::IsConstant(const std::string &blob_name) const {
+  if (!weight_names_.count(blob_name)) return false;
+  const auto blob = ws_->GetBlob(blob_name);
+  return blob != nullptr && blob->data<void>() != nullptr;
+}
+
+bool GraphOptimizer::GetWeightData(const std::string &blob_name,
+                                   VecFloat *data) const {
+  if (!weight_names_.count(blob_name)) return false;
+  const auto blob = ws_->GetBlob(blob_name);
+  if (blob == nullptr || blob->data_type() != DataType::kF32 ||
+      blob->data<float>() == nullptr) {
+    return false;
+  }
+  data->resize(blob->count());
+  blob->get_data<float>(data->data(), blob->count());
+  return true;
+}
+
+void GraphOptimizer::SetWeightData(const std::string &blob_name,
+                                   const VecInt &shape, const VecFloat &data) {
+  auto blob = ws_->CreateBlob(blob_name, DataType::kF32);
+  blob->reshape(shape);
+  blob->set_data<float>(data.data(), blob->count());
+
+  if (!weight_names_.count(blob_name)) {
+    weight_names_.insert(blob_name);
+    net_param_->add_blob()->set_name(blob_name);
+  }
+  for (auto &blob_param : *net_param_->mutable_blob()) {
+    if (blob_param.name() == blob_name) {
+      blob_param.set_type("float");
+      blob_param.clear_shape();
+      for (auto dim : shape) {
+        blob_param.add_shape(dim);
+      }
+    }
+  }
+}
+
+}  // namespace Shadow
@@ -0,0 +1,106 @@
+#ifndef SHADOW_CORE_GRAPH_OPTIMIZER_HPP
+#define SHADOW_CORE_GRAPH_OPTIMIZER_HPP
+
+#include "helper.hpp"
+#include "params.hpp"
+#include "workspace.hpp"
+
+#include "util/type.hpp"
+
+#include <functional>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace Shadow {
+
+// Rewrites a network after its weights are loaded and before its operators
+// are created. Fusion passes match an operator and its only consumer by
+// operator types and blob names and fold the consumer into the operator,
+// folded weights are written to the workspace. Operators reading only weights
+// are evaluated once and their tops become weights. Operators whose tops are
+// never used are removed at last.
+class GraphOptimizer {
+ public:
+  explicit GraphOptimizer(Workspace *ws) : ws_(ws) {}
+
+  void Optimize(shadow::NetParam *net_param);
+
+  // Lets the operators which support blocked layouts run on blobs blocked by
+  // block channels. Convolutions always run blocked, channel wise and
+  // elementwise operators follow the layout of their inputs, Reorder
+  // operators are inserted where a blocked blob meets an operator which only
+  // supports NCHW. Network inputs and outputs stay in NCHW.
+  void PropagateLayout(shadow::NetParam *net_param, int block);
+
+  // Stores the float weights of Connected and MatMul as weight_type, half or
+  // bfloat16, the operators widen them to float when they run. Convolutions
+  // keep float weights, they would have to widen them back to float anyway
+  void ReduceWeights(shadow::NetParam *net_param,
+                     const std::string &weight_type);
+
+  // Merges connected elementwise operators, Eltwise, Binary, Unary, Activate,
+  // Scale and Axpy, into Fused operators which read each input and write the
+  // output once. An operator joins the operators computing its bottoms when
+  // it is their only reader. Fused operators only run on CPU
+  void FuseElementwise(shadow::NetParam *net_param);
+
+ private:
+  using FuseFunc =
+      std::function<bool(shadow::OpParam *, const shadow::OpParam &)>;
+
+  struct FusePass {
+    VecString types;
+    std::string next_type;
+    FuseFunc fuse;
+  };
+
+  enum { kLayoutNCHW = 0, kLayoutBlocked = 1, kLayoutFollow = 2 };
+
+  void Attach(shadow::NetParam *net_param);
+
+  // Runs the operators whose bottoms are all weights and replaces their tops
+  // by weights holding the results, returns whether any operator was folded
+  bool FoldConstants();
+  bool RunFusePass(const FusePass &pass);
+  bool EliminateDeadOps();
+  void PruneBlobs();
+
+  bool FoldBatchNorm(shadow::OpParam *op_param,
+                     const shadow::OpParam &bn_param);
+  bool FoldScale(shadow::OpParam *op_param,
+                 const shadow::OpParam &scale_param);
+  bool FoldActivate(shadow::OpParam *op_param,
+                    const shadow::OpParam &activate_param);
+
+  // Maps the output channel c of op_param to scale[c] * x + shift[c] by
+  // rewriting its weight and bias
+  bool FoldChannelAffine(shadow::OpParam *op_param, VecFloat scale,
+                         VecFloat shift);
+
+  // Whether op_param can be a part of a Fused operator
+  bool IsElementwise(const shadow::OpParam &op_param) const;
+
+  // The Fused operator computing the operators of members in one pass
+  shadow::OpParam MakeFused(const VecInt &members);
+
+  // How op_param handles blocked layouts, one of the kLayout values
+  int LayoutKind(const shadow::OpParam &op_param) const;
+
+  // Whether blob_name is a weight whose data is loaded
+  bool IsConstant(const std::string &blob_name) const;
+
+  bool GetWeightData(const std::string &blob_name, VecFloat *data) const;
+  void SetWeightData(const std::string &blob_name, const VecInt &shape,
+                     const VecFloat &data);
+
+  Workspace *ws_ = nullptr;
+
+  shadow::NetParam *net_param_ = nullptr;
+  std::set<std::string> weight_names_;
+  VecString out_blob_;
+};
+
+}  // namespace Shadow
+
+#endif  // SHADOW_CORE_GRAPH_OPTIMIZER_HPP
@@ -0,0 +1,79 @@
+#ifndef SHADOW_CORE_HALF_HPP
+#define SHADOW_CORE_HALF_HPP
+
+#include <cstdint>
+#include <cstring>
+
+namespace Shadow {
+
+// IEEE 754 binary16, 1 sign, 5 exponent and 10 mantissa bits
+struct Half {
+  uint16_t bits;
+};
+
+// The upper 16 bits of a float, 1 sign, 8 exponent and 7 mantissa bits
+struct BFloat16 {
+  uint16_t bits;
+};
+
+inline uint32_t float_bits(float x) {
+  uint32_t bits;
+  memcpy(&bits, &x, sizeof(bits));
+  return bits;
+}
+
+inline float bits_float(uint32_t bits) {
+  float x;
+  memcpy(&x, &bits, sizeof(x));
+  return x;
+}
+
+// Conversions round to nearest even, NaN stays NaN
+inline Half float_to_half(float x) {
+  uint32_t bits = float_bits(x);
+  uint32_t sign = (bits >> 16) & 0x8000u, abs = bits & 0x7fffffffu;
+  uint32_t half;
+  if (abs >= 0x7f800000u) {
+    half = abs > 0x7f800000u ? 0x7e00u : 0x7c00u;
+  } else if (abs >= 0x477ff000u) {
+    // Rounds to more than the largest half 65504
+    half = 0x7c00u;
+  } else if (abs < 0x38800000u) {
+    // Subnormal halves, adding 0.5 aligns the mantissa to units of 2^-24
+    half = float_bits(bits_float(abs) + 0.5f) - 0x3f000000u;
+  } else {
+    // Rebias the exponent from 127 to 15 and round away 13 mantissa bits
+    abs += 0xc8000fffu + ((abs >> 13) & 1u);
+    half = abs >> 13;
+  }
+  return Half{static_cast<uint16_t>(sign | half)};
+}
+
+inline float half_to_float(Half x) {
+  uint32_t sign = static_cast<uint32_t>(x.bits & 0x8000u) << 16;
+  uint32_t exponent = (x.bits >> 10) & 0x1fu, mantissa = x.bits & 0x3ffu;
+  if (exponent == 0) {
+    // Zeros and subnormals are mantissa * 2^-24
+    return bits_float(sign | float_bits(mantissa * 5.9604644775390625e-8f));
+  } else if (exponent == 0x1fu) {
+    return bits_float(sign | 0x7f800000u | (mantissa << 13));
+  }
+  return bits_float(sign | ((exponent + 112) << 23) | (mantissa << 13));
+}
+
+inline BFloat16 float_to_bfloat16(float x) {
+  uint32_t bits = float_bits(x);
+  if ((bits & 0x7fffffffu) > 0x7f800000u) {
+    return BFloat16{static_cast<uint16_t>((bits >> 16) | 0x40u)};
+  }
+  bits += 0x7fffu + ((bits >> 16) & 1u);
+  return BFloat16{static_cast<uint16_t>(bits >> 16)};
+}
+
+inline float bfloat16_to_float(BFloat16 x) {
+  return bits_float(static_cast<uint32_t>(x.bits) << 16);
+}
+
+}  // namespace Shadow
+
+#endif  // SHADOW_CORE_HALF_HPP
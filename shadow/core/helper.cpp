@@ -50,6 +50,7 @@ INSTANTIATE_SINGLE_ARGUMENT(s_f, float);
 INSTANTIATE_SINGLE_ARGUMENT(s_i, int);
 INSTANTIATE_SINGLE_ARGUMENT(s_i, bool);
 INSTANTIATE_SINGLE_ARGUMENT(s_s, std::string);
+INSTANTIATE_SINGLE_ARGUMENT(s_l, int64_t);
 #undef INSTANTIATE_SINGLE_ARGUMENT
 
 #define INSTANTIATE_REPEATED_ARGUMENT(fieldname, T)                          \
@@ -80,6 +81,7 @@ INSTANTIATE_REPEATED_ARGUMENT(v_f, float);
 INSTANTIATE_REPEATED_ARGUMENT(v_i, int);
 INSTANTIATE_REPEATED_ARGUMENT(v_i, bool);
 INSTANTIATE_REPEATED_ARGUMENT(v_s, std::string);
+INSTANTIATE_REPEATED_ARGUMENT(v_l, int64_t);
 #undef INSTANTIATE_REPEATED_ARGUMENT
 
 #define INSTANTIATE_ADD_SINGLE_ARGUMENT(fieldname, P, T)                    \
@@ -97,6 +99,8 @@ INSTANTIATE_ADD_SINGLE_ARGUMENT(s_f, shadow::OpParam, float);
 INSTANTIATE_ADD_SINGLE_ARGUMENT(s_i, shadow::OpParam, int);
 INSTANTIATE_ADD_SINGLE_ARGUMENT(s_i, shadow::OpParam, bool);
 INSTANTIATE_ADD_SINGLE_ARGUMENT(s_s, shadow::OpParam, std::string);
+INSTANTIATE_ADD_SINGLE_ARGUMENT(s_l, shadow::NetParam, int64_t);
+INSTANTIATE_ADD_SINGLE_ARGUMENT(s_l, shadow::OpParam, int64_t);
 #undef INSTANTIATE_ADD_SINGLE_ARGUMENT
 
 #define INSTANTIATE_ADD_REPEATED_ARGUMENT(fieldname, P, T) \
@@ -117,6 +121,8 @@ INSTANTIATE_ADD_REPEATED_ARGUMENT(v_f, shadow::OpParam, float);
 INSTANTIATE_ADD_REPEATED_ARGUMENT(v_i, shadow::OpParam, int);
 INSTANTIATE_ADD_REPEATED_ARGUMENT(v_i, shadow::OpParam, bool);
 INSTANTIATE_ADD_REPEATED_ARGUMENT(v_s, shadow::OpParam, std::string);
+INSTANTIATE_ADD_REPEATED_ARGUMENT(v_l, shadow::NetParam, int64_t);
+INSTANTIATE_ADD_REPEATED_ARGUMENT(v_l, shadow::OpParam, int64_t);
 #undef INSTANTIATE_ADD_REPEATED_ARGUMENT
 
 }  // namespace Shadow
@@ -43,6 +43,7 @@ DECLARE_ADD_SINGLE_ARGUMENT(s_f, float);
 DECLARE_ADD_SINGLE_ARGUMENT(s_i, int);
 DECLARE_ADD_SINGLE_ARGUMENT(s_i, bool);
 DECLARE_ADD_SINGLE_ARGUMENT(s_s, std::string);
+DECLARE_ADD_SINGLE_ARGUMENT(s_l, int64_t);
 #undef DECLARE_ADD_SINGLE_ARGUMENT
 
 #define DECLARE_ADD_REPEATED_ARGUMENT(fieldname, T)                      \
@@ -55,6 +56,7 @@ DECLARE_ADD_REPEATED_ARGUMENT(v_f, float);
 DECLARE_ADD_REPEATED_ARGUMENT(v_i, int);
 DECLARE_ADD_REPEATED_ARGUMENT(v_i, bool);
 DECLARE_ADD_REPEATED_ARGUMENT(v_s, std::string);
+DECLARE_ADD_REPEATED_ARGUMENT(v_l, int64_t);
 #undef DECLARE_ADD_REPEATED_ARGUMENT
 
 }  // namespace Shadow
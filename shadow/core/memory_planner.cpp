@@ -0,0 +1,375 @@
+#include "memory_planner.hpp"
+
+#include <algorithm>
+
+namespace Shadow {
+
+const size_t PlanAlignment = 64;
+
+inline size_t align_plan_size(size_t size) {
+  return (size + PlanAlignment - 1) / PlanAlignment * PlanAlignment;
+}
+
+void MemoryPlanner::Setup(const std::vector<std::shared_ptr<Operator>> &ops,
+                          const std::vector<std::string> &persistent_blobs) {
+  Clear();
+
+  blob_infos_.clear(), blob_index_.clear(), concat_infos_.clear();
+  for (int n = 0; n < static_cast<int>(ops.size()); ++n) {
+    const auto &op = ops[n];
+    if (op->type() == "Concat") {
+      ConcatInfo concat_info;
+      concat_info.op = op;
+      concat_info.index = n;
+      concat_infos_.push_back(concat_info);
+    }
+    for (int i = 0; i < op->bottoms_size(); ++i) {
+      const auto &blob_name = op->bottoms_name(i);
+      if (blob_index_.count(blob_name)) {
+        blob_infos_[blob_index_.at(blob_name)].accesses.push_back(n);
+      }
+    }
+    // Input tops are filled from outside and PriorBox computes its tops only
+    // once, they must keep their own storage
+    bool keep = op->type() == "Input" || op->type() == "PriorBox";
+    for (int i = 0; i < op->tops_size(); ++i) {
+      const auto &blob_name = op->tops_name(i);
+      if (!blob_index_.count(blob_name)) {
+        BlobInfo blob_info;
+        blob_info.blob = op->tops(i);
+        blob_info.first = n;
+        blob_info.plannable = true;
+        blob_index_[blob_name] = static_cast<int>(blob_infos_.size());
+        blob_infos_.push_back(blob_info);
+      }
+      auto &blob_info = blob_infos_[blob_index_.at(blob_name)];
+      blob_info.accesses.push_back(n);
+      if (keep) {
+        blob_info.plannable = false;
+      }
+    }
+  }
+
+  for (const auto &blob_name : persistent_blobs) {
+    if (blob_index_.count(blob_name)) {
+      blob_infos_[blob_index_.at(blob_name)].plannable = false;
+    }
+  }
+}
+
+bool MemoryPlanner::Restore(const std::vector<std::vector<int>> &in_shapes) {
+  if (planned_ && in_shapes == in_shapes_) return true;
+  auto plan_it = plans_.find(in_shapes);
+  if (plan_it == plans_.end()) return false;
+  Bind(in_shapes, &plan_it->second);
+  return true;
+}
+
+void MemoryPlanner::Reset() {
+  for (auto &blob_info : blob_infos_) {
+    if (blob_info.bound) {
+      blob_info.blob->release();
+      blob_info.bound = false;
+    }
+  }
+  arena_size_ = 0;
+  planned_ = false;
+  in_shapes_.clear();
+}
+
+void MemoryPlanner::Clear() {
+  Reset();
+  plans_.clear();
+  if (arena_ != nullptr) {
+    arena_->release();
+  }
+}
+
+void MemoryPlanner::Plan(const std::vector<std::vector<int>> &in_shapes) {
+  int num_blobs = static_cast<int>(blob_infos_.size());
+
+  // Views share the storage of other blobs, the owner must live as long as
+  // the view, and can not be planned if the view must outlive the forward
+  std::vector<std::vector<int>> accesses(num_blobs);
+  std::vector<bool> pinned(num_blobs, false);
+  for (int n = 0; n < num_blobs; ++n) {
+    accesses[n] = blob_infos_[n].accesses;
+  }
+  for (const auto &blob_info : blob_infos_) {
+    const auto &blob = blob_info.blob;
+    if (!blob->shared() || blob->data<void>() == nullptr) continue;
+    int root = FindRoot(blob->data<void>());
+    if (root < 0) continue;
+    if (blob_info.plannable) {
+      accesses[root].insert(accesses[root].end(), blob_info.accesses.begin(),
+                            blob_info.accesses.end());
+    } else {
+      pinned[root] = true;
+    }
+  }
+
+  std::vector<int> firsts(num_blobs);
+  for (int n = 0; n < num_blobs; ++n) {
+    firsts[n] = blob_infos_[n].first;
+  }
+  NestConcats(pinned, &accesses, &firsts);
+
+  std::vector<int> candidates;
+  for (int n = 0; n < num_blobs; ++n) {
+    auto &blob_info = blob_infos_[n];
+    const auto &blob = blob_info.blob;
+    blob_info.size = 0, blob_info.offset = 0;
+    if (!blob_info.plannable || pinned[n] || blob_info.parent >= 0 ||
+        blob->shared() || blob->data<void>() == nullptr ||
+        blob->max_size() == 0) {
+      continue;
+    }
+    blob_info.size = align_plan_size(blob->max_size());
+    candidates.push_back(n);
+  }
+
+  // Greedy by size, place each blob at the lowest offset which does not
+  // overlap with any placed blob that may be alive at the same time
+  std::stable_sort(candidates.begin(), candidates.end(), [&](int a, int b) {
+    return blob_infos_[a].size > blob_infos_[b].size;
+  });
+  std::vector<int> placed;
+  arena_size_ = 0;
+  for (int n : candidates) {
+    auto &blob_info = blob_infos_[n];
+    std::vector<int> conflicts;
+    for (int p : placed) {
+      if (!Before(accesses[n], firsts[p]) && !Before(accesses[p], firsts[n])) {
+        conflicts.push_back(p);
+      }
+    }
+    std::sort(conflicts.begin(), conflicts.end(), [&](int a, int b) {
+      return blob_infos_[a].offset < blob_infos_[b].offset;
+    });
+    size_t offset = 0;
+    for (int p : conflicts) {
+      const auto &placed_info = blob_infos_[p];
+      if (offset + blob_info.size <= placed_info.offset) break;
+      offset = std::max(offset, placed_info.offset + placed_info.size);
+    }
+    blob_info.offset = offset;
+    arena_size_ = std::max(arena_size_, offset + blob_info.size);
+    placed.push_back(n);
+  }
+
+  PlanEntry plan;
+  plan.arena_size = arena_size_;
+  for (int n : placed) {
+    plan.blobs.push_back(n);
+    plan.offsets.push_back(blob_infos_[n].offset);
+    plan.capacities.push_back(blob_infos_[n].blob->capacity());
+  }
+  int num_nested = 0;
+  for (int n = 0; n < num_blobs; ++n) {
+    if (blob_infos_[n].parent < 0) continue;
+    plan.blobs.push_back(n);
+    plan.offsets.push_back(ArenaOffset(n));
+    plan.capacities.push_back(blob_infos_[n].blob->count());
+    num_nested++;
+  }
+  AddPlan(in_shapes, plan);
+
+  DLOG(INFO) << "Memory plan: " << placed.size() << " blobs in "
+             << arena_size_ << " bytes, " << num_nested
+             << " blobs in Concat tops";
+}
+
+void MemoryPlanner::SavePlan(shadow::NetParam *net_param) const {
+  if (!planned_) return;
+  std::vector<int> in_shapes;
+  for (const auto &in_shape : in_shapes_) {
+    in_shapes.push_back(static_cast<int>(in_shape.size()));
+    in_shapes.insert(in_shapes.end(), in_shape.begin(), in_shape.end());
+  }
+  VecString blob_names;
+  std::vector<int64_t> offsets, capacities;
+  for (const auto &blob_info : blob_infos_) {
+    if (!blob_info.bound) continue;
+    blob_names.push_back(blob_info.blob->name());
+    offsets.push_back(static_cast<int64_t>(blob_info.offset));
+    capacities.push_back(static_cast<int64_t>(blob_info.blob->capacity()));
+  }
+  add_v_i(net_param, "plan_in_shapes", in_shapes);
+  add_s_l(net_param, "plan_arena_size", static_cast<int64_t>(arena_size_));
+  add_v_s(net_param, "plan_blobs", blob_names);
+  add_v_l(net_param, "plan_offsets", offsets);
+  add_v_l(net_param, "plan_capacities", capacities);
+}
+
+void MemoryPlanner::LoadPlan(const ArgumentHelper &arguments) {
+  if (!arguments.HasArgument("plan_blobs")) return;
+
+  const auto &shapes = arguments.GetRepeatedArgument<int>("plan_in_shapes", {});
+  ShapeKey in_shapes;
+  for (int n = 0; n < static_cast<int>(shapes.size()); n += shapes[n] + 1) {
+    in_shapes.emplace_back(shapes.begin() + n + 1,
+                           shapes.begin() + n + 1 + shapes[n]);
+  }
+  const auto &blob_names =
+      arguments.GetRepeatedArgument<std::string>("plan_blobs", {});
+  const auto &offsets =
+      arguments.GetRepeatedArgument<int64_t>("plan_offsets", {});
+  const auto &capacities =
+      arguments.GetRepeatedArgument<int64_t>("plan_capacities", {});
+  CHECK_EQ(blob_names.size(), offsets.size());
+  CHECK_EQ(blob_names.size(), capacities.size());
+
+  PlanEntry plan;
+  plan.arena_size = static_cast<size_t>(
+      arguments.GetSingleArgument<int64_t>("plan_arena_size", 0));
+  for (int n = 0; n < static_cast<int>(blob_names.size()); ++n) {
+    CHECK(blob_index_.count(blob_names[n]))
+        << "Planned blob " << blob_names[n] << " is not in the network";
+    int index = blob_index_.at(blob_names[n]);
+    const auto &blob = blob_infos_[index].blob;
+    CHECK_GE(offsets[n], 0);
+    CHECK_GE(capacities[n], 0);
+    size_t end = static_cast<size_t>(offsets[n]) +
+                 static_cast<size_t>(capacities[n]) * blob->elem_size();
+    CHECK_LE(end, plan.arena_size);
+    plan.blobs.push_back(index);
+    plan.offsets.push_back(static_cast<size_t>(offsets[n]));
+    plan.capacities.push_back(static_cast<size_t>(capacities[n]));
+  }
+  AddPlan(in_shapes, plan);
+}
+
+void MemoryPlanner::Bind(const ShapeKey &in_shapes, PlanEntry *plan) {
+  Reset();
+
+  if (plan->arena_size > 0) {
+    if (arena_ == nullptr) {
+      arena_ = ws_->CreateBlob("plan_blob", DataType::kI32);
+    }
+    // The arena only grows, so that it fits every cached plan
+    size_t num_int = plan->arena_size / arena_->elem_size() + 1;
+    CHECK_LE(num_int, std::numeric_limits<int>::max());
+    arena_->reshape({static_cast<int>(num_int)});
+    auto *arena_data = arena_->mutable_data<unsigned char>();
+    for (int n = 0; n < static_cast<int>(plan->blobs.size()); ++n) {
+      auto &blob_info = blob_infos_[plan->blobs[n]];
+      blob_info.blob->bind_data(arena_data + plan->offsets[n],
+                                plan->capacities[n]);
+      blob_info.offset = plan->offsets[n];
+      blob_info.bound = true;
+    }
+  }
+
+  plan->last_use = ++use_count_;
+  arena_size_ = plan->arena_size;
+  planned_ = true;
+  in_shapes_ = in_shapes;
+}
+
+void MemoryPlanner::AddPlan(const ShapeKey &in_shapes, const PlanEntry &plan) {
+  if (!plans_.count(in_shapes) &&
+      static_cast<int>(plans_.size()) >= std::max(max_plans_, 1)) {
+    auto lru_it = plans_.begin();
+    for (auto plan_it = plans_.begin(); plan_it != plans_.end(); ++plan_it) {
+      if (plan_it->second.last_use < lru_it->second.last_use) {
+        lru_it = plan_it;
+      }
+    }
+    plans_.erase(lru_it);
+  }
+  auto &cached_plan = plans_[in_shapes];
+  cached_plan = plan;
+  Bind(in_shapes, &cached_plan);
+}
+
+bool MemoryPlanner::Before(const std::vector<int> &accesses, int first) const {
+  for (int op_index : accesses) {
+    bool before = precedes_ != nullptr ? precedes_(op_index, first)
+                                       : op_index < first;
+    if (!before) return false;
+  }
+  return true;
+}
+
+void MemoryPlanner::NestConcats(const std::vector<bool> &pinned,
+                                std::vector<std::vector<int>> *accesses,
+                                std::vector<int> *firsts) {
+  for (auto &blob_info : blob_infos_) {
+    blob_info.parent = -1, blob_info.parent_offset = 0;
+  }
+  // A blob can be placed in a Concat top if the planner owns its storage
+  auto nestable = [&](int n) {
+    const auto &blob_info = blob_infos_[n];
+    const auto &blob = blob_info.blob;
+    return blob_info.plannable && !pinned[n] && blob_info.parent < 0 &&
+           !blob->shared() && blob->data<void>() != nullptr &&
+           blob->layout() == Layout::kNCHW;
+  };
+
+  for (const auto &concat_info : concat_infos_) {
+    const auto &op = concat_info.op;
+    if (!blob_index_.count(op->tops_name(0))) continue;
+    int top_index = blob_index_.at(op->tops_name(0));
+    const auto &top = blob_infos_[top_index].blob;
+    if (!nestable(top_index)) continue;
+    int axis = op->get_single_argument<int>("axis", 1);
+    axis = top->canonical_index(axis);
+    if (top->count(0, axis) != 1) continue;
+
+    size_t offset = 0;
+    for (int i = 0; i < op->bottoms_size(); ++i) {
+      const auto &bottom_name = op->bottoms_name(i);
+      const auto bottom = op->bottoms(i);
+      size_t bottom_offset = offset;
+      offset += bottom->raw_size();
+      if (!blob_index_.count(bottom_name)) continue;
+      int n = blob_index_.at(bottom_name);
+      if (n == top_index || !nestable(n) ||
+          bottom->data_type() != top->data_type()) {
+        continue;
+      }
+      bool repeated = false;
+      for (int j = 0; j < op->bottoms_size(); ++j) {
+        repeated |= j != i && op->bottoms_name(j) == bottom_name;
+      }
+      // The top is written in place after the Concat, nothing may read the
+      // bottom then
+      std::vector<int> others;
+      for (int op_index : (*accesses)[n]) {
+        if (op_index != concat_info.index) {
+          others.push_back(op_index);
+        }
+      }
+      if (repeated || !Before(others, concat_info.index)) continue;
+
+      auto &blob_info = blob_infos_[n];
+      blob_info.parent = top_index, blob_info.parent_offset = bottom_offset;
+      auto &top_accesses = (*accesses)[top_index];
+      top_accesses.insert(top_accesses.end(), (*accesses)[n].begin(),
+                          (*accesses)[n].end());
+      (*firsts)[top_index] = std::min((*firsts)[top_index], (*firsts)[n]);
+    }
+  }
+}
+
+size_t MemoryPlanner::ArenaOffset(int n) const {
+  const auto &blob_info = blob_infos_[n];
+  if (blob_info.parent < 0) return blob_info.offset;
+  return ArenaOffset(blob_info.parent) + blob_info.parent_offset;
+}
+
+int MemoryPlanner::FindRoot(const void *ptr) const {
+  const auto *data = static_cast<const unsigned char *>(ptr);
+  for (int n = 0; n < static_cast<int>(blob_infos_.size()); ++n) {
+    const auto &blob = blob_infos_[n].blob;
+    if (!blob_infos_[n].plannable || blob->shared()) continue;
+    const auto *root_data = blob->data<unsigned char>();
+    if (root_data != nullptr && data >= root_data &&
+        data < root_data + blob->max_size()) {
+      return n;
+    }
+  }
+  return -1;
+}
+
+}  // namespace Shadow
@@ -0,0 +1,122 @@
+#ifndef SHADOW_CORE_MEMORY_PLANNER_HPP
+#define SHADOW_CORE_MEMORY_PLANNER_HPP
+
+#include "operator.hpp"
+#include "workspace.hpp"
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Shadow {
+
+// Plans the activation blobs produced by operators into one arena. The blob
+// lifetimes come from the bottom and top names of the operators, the blob
+// sizes are recorded during one planning forward, and blobs whose lifetimes
+// do not overlap share the same region of the arena. The bottoms of a Concat
+// whose outer axes are all 1 are placed in their slots of its top, so that
+// their producers write the concatenated blob directly. The plans of the last
+// max_plans input shapes are cached, all of them use the same arena.
+class MemoryPlanner {
+ public:
+  explicit MemoryPlanner(Workspace *ws, int max_plans = 8)
+      : ws_(ws), max_plans_(max_plans) {}
+
+  void Setup(const std::vector<std::shared_ptr<Operator>> &ops,
+             const std::vector<std::string> &persistent_blobs);
+
+  // Binds the blobs by the cached plan of in_shapes, returns false if there
+  // is no such plan
+  bool Restore(const std::vector<std::vector<int>> &in_shapes);
+
+  // Unbinds all planned blobs, the following forward lets every blob allocate
+  // its own storage so that the sizes can be recorded
+  void Reset();
+
+  // Also drops the cached plans and the arena
+  void Clear();
+
+  // Called after the sizing forward, resolves view blobs to the blobs owning
+  // their storage, assigns arena offsets and binds the planned blobs
+  void Plan(const std::vector<std::vector<int>> &in_shapes);
+
+  size_t arena_size() const { return arena_size_; }
+
+  // Stores the current plan as arguments of net_param, a network loaded with
+  // these arguments restores the plan and skips the sizing forward
+  void SavePlan(shadow::NetParam *net_param) const;
+  void LoadPlan(const ArgumentHelper &arguments);
+
+  // precedes(a, b) tells whether operator a always finishes before operator b
+  // starts, by default operators run in order. The cached plans are dropped
+  void set_precedes(const std::function<bool(int, int)> &precedes) {
+    precedes_ = precedes;
+    plans_.clear();
+  }
+
+ private:
+  struct BlobInfo {
+    std::shared_ptr<Blob> blob = nullptr;
+    int first = -1;
+    std::vector<int> accesses;
+    size_t size = 0, offset = 0;
+    bool plannable = false, bound = false;
+    // The blob lives in its parent blob from parent_offset on
+    int parent = -1;
+    size_t parent_offset = 0;
+  };
+
+  struct ConcatInfo {
+    std::shared_ptr<Operator> op = nullptr;
+    int index = -1;
+  };
+
+  struct PlanEntry {
+    size_t arena_size = 0;
+    std::vector<int> blobs;
+    std::vector<size_t> offsets, capacities;
+    int last_use = 0;
+  };
+
+  using ShapeKey = std::vector<std::vector<int>>;
+
+  void Bind(const ShapeKey &in_shapes, PlanEntry *plan);
+  void AddPlan(const ShapeKey &in_shapes, const PlanEntry &plan);
+
+  // Sets the parents of the Concat bottoms which can be written in place,
+  // their accesses and first accesses move to the Concat tops
+  void NestConcats(const std::vector<bool> &pinned,
+                   std::vector<std::vector<int>> *accesses,
+                   std::vector<int> *firsts);
+
+  size_t ArenaOffset(int n) const;
+
+  int FindRoot(const void *ptr) const;
+
+  bool Before(const std::vector<int> &accesses, int first) const;
+
+  Workspace *ws_ = nullptr;
+
+  std::vector<BlobInfo> blob_infos_;
+  std::vector<ConcatInfo> concat_infos_;
+  std::map<std::string, int> blob_index_;
+
+  std::shared_ptr<Blob> arena_ = nullptr;
+  size_t arena_size_ = 0;
+
+  std::function<bool(int, int)> precedes_ = nullptr;
+
+  std::map<ShapeKey, PlanEntry> plans_;
+  int max_plans_ = 8, use_count_ = 0;
+
+  bool planned_ = false;
+  ShapeKey in_shapes_;
+
+  DISABLE_COPY_AND_ASSIGN(MemoryPlanner);
+};
+
+}  // namespace Shadow
+
+#endif  // SHADOW_CORE_MEMORY_PLANNER_HPP
@@ -12,6 +12,17 @@ void Network::LoadXModel(const shadow::NetParam &net_param,
   engine_->LoadXModel(net_param, arguments);
 }
 
+void Network::LoadXModel(const std::string &model_file, int network_index,
+                         const ArgumentHelper &arguments) {
+  engine_->LoadXModel(model_file, network_index, arguments);
+}
+
+Network Network::Clone() const {
+  Network network;
+  network.engine_ = engine_->Clone();
+  return network;
+}
+
 void Network::Forward(
     const std::map<std::string, void *> &data_map,
     const std::map<std::string, std::vector<int>> &shape_map) {
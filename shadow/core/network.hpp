@@ -20,6 +20,12 @@ class Network {
 
   void LoadXModel(const shadow::NetParam &net_param,
                   const ArgumentHelper &arguments);
+  void LoadXModel(const std::string &model_file, int network_index,
+                  const ArgumentHelper &arguments);
+
+  // Returns a network sharing the loaded weights and the thread pool with its
+  // own activation and scratch memory, each clone can run on its own thread
+  Network Clone() const;
 
   void Forward(const std::map<std::string, void *> &data_map,
                const std::map<std::string, std::vector<int>> &shape_map = {});
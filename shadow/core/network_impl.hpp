@@ -11,17 +11,40 @@ class NetworkImpl {
     ArgumentHelper arguments;
     arguments.AddSingleArgument<int>("device_id", device_id);
     ws_ = std::make_shared<Workspace>(arguments);
+    ws_arguments_ = arguments;
   }
 
   void LoadXModel(const shadow::NetParam &net_param,
                   const ArgumentHelper &arguments) {
     if (ws_ == nullptr) {
       ws_ = std::make_shared<Workspace>(arguments);
+      ws_arguments_ = arguments;
     }
     backend_.reset(CreateBackend(arguments, ws_.get()));
     backend_->LoadModel(net_param);
   }
 
+  void LoadXModel(const std::string &model_file, int network_index,
+                  const ArgumentHelper &arguments) {
+    if (ws_ == nullptr) {
+      ws_ = std::make_shared<Workspace>(arguments);
+      ws_arguments_ = arguments;
+    }
+    backend_.reset(CreateBackend(arguments, ws_.get()));
+    backend_->LoadModel(model_file, network_index);
+  }
+
+  // The clone owns a new workspace for activations, which runs on the threads
+  // of this one, its backend holds the weights shared from this network
+  std::shared_ptr<NetworkImpl> Clone() const {
+    CHECK_NOTNULL(backend_);
+    auto network = std::make_shared<NetworkImpl>();
+    network->ws_ = std::make_shared<Workspace>(ws_arguments_, *ws_);
+    network->ws_arguments_ = ws_arguments_;
+    network->backend_.reset(backend_->Clone(network->ws_.get()));
+    return network;
+  }
+
   void Forward(const std::map<std::string, void *> &data_map,
                const std::map<std::string, std::vector<int>> &shape_map) {
     ws_->Ctx()->switch_device();
@@ -72,6 +95,7 @@ class NetworkImpl {
 
  private:
   std::shared_ptr<Workspace> ws_ = nullptr;
+  ArgumentHelper ws_arguments_;
   std::shared_ptr<Backend> backend_ = nullptr;
 };
 
@@ -0,0 +1,188 @@
+#include "op_profiler.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace Shadow {
+
+inline std::string json_escape(const std::string &str) {
+  std::stringstream ss;
+  for (auto c : str) {
+    if (c == '"' || c == '\\') {
+      ss << '\\' << c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      ss << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+         << static_cast<int>(c) << std::dec;
+    } else {
+      ss << c;
+    }
+  }
+  return ss.str();
+}
+
+OpProfiler::OpProfiler(const std::vector<std::shared_ptr<Operator>> &ops,
+                       Workspace *ws)
+    : ops_(ops), ws_(ws) {
+  origin_ = Clock::now();
+  runs_.resize(ops_.size());
+  stats_.resize(ops_.size());
+}
+
+void OpProfiler::Begin(int index) {
+  auto &run = runs_[index];
+  run.thread_id = std::this_thread::get_id();
+  run.start = Clock::now();
+}
+
+void OpProfiler::End(int index) {
+  // Device operators only finish when the device is synchronized
+  ws_->Ctx()->synchronize();
+  auto &run = runs_[index];
+  run.end = Clock::now();
+  run.done = true;
+}
+
+void OpProfiler::EndForward(bool keep) {
+  for (int n = 0; n < static_cast<int>(runs_.size()); ++n) {
+    auto &run = runs_[n];
+    if (!run.done) continue;
+    run.done = false;
+    if (!keep) continue;
+
+    auto to_us = [](const Clock::duration &duration) {
+      return std::chrono::duration<double, std::micro>(duration).count();
+    };
+    TraceEvent event;
+    event.index = n;
+    event.start_us = to_us(run.start - origin_);
+    event.duration_us = to_us(run.end - run.start);
+    auto thread_it =
+        std::find(threads_.begin(), threads_.end(), run.thread_id);
+    event.thread = static_cast<int>(thread_it - threads_.begin());
+    if (thread_it == threads_.end()) {
+      threads_.push_back(run.thread_id);
+    }
+    events_.push_back(event);
+
+    auto &stat = stats_[n];
+    Describe(n, &stat);
+    if (stat.count == 0) {
+      stat.min_us = stat.max_us = event.duration_us;
+    } else {
+      stat.min_us = std::min(stat.min_us, event.duration_us);
+      stat.max_us = std::max(stat.max_us, event.duration_us);
+    }
+    stat.total_us += event.duration_us;
+    stat.count++;
+  }
+  if (keep) {
+    num_forwards_++;
+  }
+}
+
+std::string OpProfiler::Summary() const {
+  std::vector<int> order;
+  double total_us = 0;
+  for (int n = 0; n < static_cast<int>(stats_.size()); ++n) {
+    if (stats_[n].count > 0) {
+      order.push_back(n);
+      total_us += stats_[n].total_us;
+    }
+  }
+  std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+    return stats_[a].total_us > stats_[b].total_us;
+  });
+
+  std::stringstream ss;
+  ss << std::fixed << std::setprecision(3);
+  ss << "Operator profile of " << num_forwards_ << " forwards, "
+     << total_us / std::max(num_forwards_, 1) / 1000 << " ms per forward";
+  for (int n : order) {
+    const auto &op = ops_[n];
+    const auto &stat = stats_[n];
+    double mean_us = stat.total_us / stat.count;
+    ss << "\n  " << op->name() << "(" << op->type() << "): " << mean_us / 1000
+       << " ms [" << stat.min_us / 1000 << ", " << stat.max_us / 1000
+       << "] x " << stat.count << ", "
+       << std::setprecision(1) << 100 * stat.total_us / total_us << "%, "
+       << std::setprecision(3) << stat.bytes / 1048576.0 << " MB, "
+       << stat.flops / 1e6 << " MFLOP, " << stat.flops / mean_us / 1000
+       << " GFLOP/s, " << stat.shapes;
+  }
+  return ss.str();
+}
+
+void OpProfiler::SaveTrace(const std::string &save_path) const {
+  std::ofstream file(save_path, std::ios::out | std::ios::trunc);
+  CHECK(file.is_open()) << "Failed to open file: " << save_path;
+  file << std::fixed << std::setprecision(3);
+  file << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+  for (int n = 0; n < static_cast<int>(events_.size()); ++n) {
+    const auto &event = events_[n];
+    const auto &op = ops_[event.index];
+    const auto &stat = stats_[event.index];
+    file << (n > 0 ? ",\n" : "\n") << "{\"name\": \""
+         << json_escape(op->name()) << "\", \"cat\": \""
+         << json_escape(op->type()) << "\", \"ph\": \"X\", \"ts\": "
+         << event.start_us << ", \"dur\": " << event.duration_us
+         << ", \"pid\": 0, \"tid\": " << event.thread
+         << ", \"args\": {\"shapes\": \"" << json_escape(stat.shapes)
+         << "\", \"bytes\": " << stat.bytes << ", \"flops\": " << stat.flops
+         << "}}";
+  }
+  file << "\n]}\n";
+  CHECK(file.good()) << "Error when saving trace: " << save_path;
+}
+
+void OpProfiler::Describe(int index, OpStat *stat) const {
+  const auto &op = ops_[index];
+  VecString bottom_str, top_str;
+  size_t bytes = 0;
+  double top_count = 0;
+  for (int n = 0; n < op->bottoms_size(); ++n) {
+    const auto bottom = op->bottoms(n);
+    bottom_str.push_back(Util::format_vector(bottom->shape(), ","));
+    bytes += bottom->raw_size();
+  }
+  for (int n = 0; n < op->tops_size(); ++n) {
+    const auto top = op->tops(n);
+    top_str.push_back(Util::format_vector(top->shape(), ","));
+    bytes += top->raw_size();
+    top_count += top->count();
+  }
+  stat->shapes = "(" + Util::format_vector(bottom_str, ") + (") + ") -> (" +
+                 Util::format_vector(top_str, ") + (") + ")";
+  stat->bytes = bytes;
+
+  // Multiplies and adds of the matrix products count as two operations, the
+  // other operators as one per output value
+  const auto &type = op->type();
+  double flops = top_count;
+  if (type == "Input") {
+    flops = 0;
+  } else if ((type == "Conv" || type == "Deconv") && op->bottoms_size() > 1) {
+    const auto weight = op->bottoms(1);
+    if (weight->num_axes() == 4) {
+      double num_macs = type == "Conv" ? top_count : op->bottoms(0)->count();
+      flops = 2 * num_macs * weight->count(1);
+    }
+  } else if (type == "Connected") {
+    flops = 2 * top_count * op->bottoms(0)->count(1);
+  } else if (type == "MatMul" && op->bottoms_size() > 1) {
+    const auto bottom = op->bottoms(0);
+    bool transpose_a = op->get_single_argument<bool>("transpose_a", false);
+    int num_axes = bottom->num_axes();
+    if (num_axes >= 2) {
+      flops = 2 * top_count *
+              bottom->shape(transpose_a ? num_axes - 2 : num_axes - 1);
+    }
+  } else if (type == "Fused") {
+    flops = top_count *
+            (op->get_repeated_argument<int>("code").size() / 4);
+  }
+  stat->flops = flops;
+}
+
+}  // namespace Shadow
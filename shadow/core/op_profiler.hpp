@@ -0,0 +1,79 @@
+#ifndef SHADOW_CORE_OP_PROFILER_HPP
+#define SHADOW_CORE_OP_PROFILER_HPP
+
+#include "operator.hpp"
+#include "workspace.hpp"
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Shadow {
+
+// Times every operator of a network over several forwards. Begin and End are
+// called around the forward of an operator by the thread running it, the
+// operators of one forward may run concurrently, EndForward is called after
+// the forward by the thread which started it. The statistics aggregate the
+// finished forwards, the trace keeps every operator run of them in the Chrome
+// trace event format, which chrome://tracing and Perfetto load.
+class OpProfiler {
+ public:
+  OpProfiler(const std::vector<std::shared_ptr<Operator>> &ops, Workspace *ws);
+
+  void Begin(int index);
+  void End(int index);
+
+  // Closes the current forward, its runs are dropped if keep is false
+  void EndForward(bool keep = true);
+
+  int num_forwards() const { return num_forwards_; }
+
+  // One line per operator with the time spent, shapes, bytes and flops,
+  // ordered by the total time
+  std::string Summary() const;
+
+  void SaveTrace(const std::string &save_path) const;
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  struct OpRun {
+    Clock::time_point start, end;
+    std::thread::id thread_id;
+    bool done = false;
+  };
+
+  struct OpStat {
+    std::string shapes;
+    size_t bytes = 0;
+    double flops = 0, total_us = 0, min_us = 0, max_us = 0;
+    int count = 0;
+  };
+
+  struct TraceEvent {
+    int index = 0, thread = 0;
+    double start_us = 0, duration_us = 0;
+  };
+
+  // Shapes, bytes read and written and an estimate of the floating point
+  // operations of operator index at its last run
+  void Describe(int index, OpStat *stat) const;
+
+  std::vector<std::shared_ptr<Operator>> ops_;
+  Workspace *ws_ = nullptr;
+
+  Clock::time_point origin_;
+  std::vector<OpRun> runs_;
+  std::vector<OpStat> stats_;
+  std::vector<TraceEvent> events_;
+  std::vector<std::thread::id> threads_;
+  int num_forwards_ = 0;
+
+  DISABLE_COPY_AND_ASSIGN(OpProfiler);
+};
+
+}  // namespace Shadow
+
+#endif  // SHADOW_CORE_OP_PROFILER_HPP
@@ -20,6 +20,12 @@ Operator::Operator(const shadow::OpParam &op_param, Workspace *ws)
       ws->CreateBlob(top_name, DataType::kF32);
     } else if (top_type == "unsigned char") {
       ws->CreateBlob(top_name, DataType::kU8);
+    } else if (top_type == "signed char") {
+      ws->CreateBlob(top_name, DataType::kI8);
+    } else if (top_type == "half") {
+      ws->CreateBlob(top_name, DataType::kF16);
+    } else if (top_type == "bfloat16") {
+      ws->CreateBlob(top_name, DataType::kBF16);
     } else {
       LOG(FATAL) << op_name_ << ": Failed to create top blob " << top_name
                  << ", asked for type " << top_type;
@@ -7,6 +7,7 @@
 #include "proto/shadow.pb.h"
 #endif
 
+#include <cstdint>
 #include <limits>
 #include <string>
 #include <vector>
@@ -107,10 +108,13 @@ class Argument {
     v_f_ = from.v_f_;
     v_i_ = from.v_i_;
     v_s_ = from.v_s_;
+    s_l_ = from.s_l_;
+    v_l_ = from.v_l_;
     has_name_ = from.has_name_;
     has_s_f_ = from.has_s_f_;
     has_s_i_ = from.has_s_i_;
     has_s_s_ = from.has_s_s_;
+    has_s_l_ = from.has_s_l_;
   }
 
   OPTIONAL_FIELD_FUNC(name, std::string, "");
@@ -120,6 +124,8 @@ class Argument {
   REPEATED_FIELD_FUNC(v_f, float);
   REPEATED_FIELD_FUNC(v_i, int);
   REPEATED_FIELD_FUNC(v_s, std::string);
+  OPTIONAL_FIELD_FUNC(s_l, int64_t, std::numeric_limits<int64_t>::max());
+  REPEATED_FIELD_FUNC(v_l, int64_t);
 
   void Clear() {
     clear_name();
@@ -129,6 +135,8 @@ class Argument {
     clear_v_f();
     clear_v_i();
     clear_v_s();
+    clear_s_l();
+    clear_v_l();
   }
 
  private:
@@ -139,7 +147,10 @@ class Argument {
   std::vector<float> v_f_;
   std::vector<int> v_i_;
   std::vector<std::string> v_s_;
-  bool has_name_{false}, has_s_f_{false}, has_s_i_{false}, has_s_s_{false};
+  int64_t s_l_;
+  std::vector<int64_t> v_l_;
+  bool has_name_{false}, has_s_f_{false}, has_s_i_{false}, has_s_s_{false},
+      has_s_l_{false};
 };
 
 class OpParam {
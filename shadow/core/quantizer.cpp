@@ -0,0 +1,289 @@
+#include "quantizer.hpp"
+
+#include "util/log.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Shadow {
+
+inline void set_transpose(shadow::OpParam *op_param) {
+  for (auto &arg : *op_param->mutable_arg()) {
+    if (arg.name() == "transpose") {
+      arg.set_s_i(1);
+      return;
+    }
+  }
+  add_s_i(op_param, "transpose", true);
+}
+
+void Quantizer::Observe(const Operator &op) {
+  for (int n = 0; n < op.tops_size(); ++n) {
+    const auto top = op.tops(n);
+    int count = top->count();
+    if (top->data_type() != DataType::kF32 || count == 0 ||
+        top->data<float>() == nullptr) {
+      continue;
+    }
+    VecFloat data(count);
+    top->get_data<float>(data.data(), count);
+    const auto &min_max = std::minmax_element(data.begin(), data.end());
+    const auto &top_name = op.tops_name(n);
+    if (ranges_.count(top_name)) {
+      auto &range = ranges_.at(top_name);
+      range.first = std::min(range.first, *min_max.first);
+      range.second = std::max(range.second, *min_max.second);
+    } else {
+      ranges_[top_name] = std::make_pair(*min_max.first, *min_max.second);
+    }
+  }
+}
+
+void Quantizer::Quantize(shadow::NetParam *net_param) {
+  const auto &out_blob =
+      ArgumentHelper(*net_param).GetRepeatedArgument<std::string>("out_blob",
+                                                                  {});
+  std::set<std::string> weight_names;
+  for (const auto &blob : net_param->blob()) {
+    weight_names.insert(blob.name());
+  }
+
+  std::vector<shadow::OpParam> ops;
+  // The blobs whose float values are current, and the int8 blobs holding the
+  // current values of float blobs
+  std::set<std::string> float_ready(weight_names);
+  std::map<std::string, std::string> int8_copy;
+  std::map<std::string, QuantParam> int8_params;
+  std::set<std::string> int8_weights;
+  int num_quantized = 0;
+
+  auto add_convert = [&](const std::string &type, const std::string &bottom,
+                         const std::string &top, const QuantParam &param) {
+    shadow::OpParam op_param;
+    op_param.set_type(type);
+    op_param.set_name(top + "/" + (type == "Quantize" ? "quantize"
+                                                      : "dequantize"));
+    op_param.add_bottom(bottom);
+    op_param.add_top(top);
+    add_s_f(&op_param, "scale", param.scale);
+    add_s_i(&op_param, "zero_point", param.zero_point);
+    if (type == "Quantize") {
+      add_s_s(&op_param, top + "_type", std::string("unsigned char"));
+    }
+    ops.push_back(op_param);
+  };
+  auto to_int8 = [&](const std::string &blob_name) {
+    if (int8_copy.count(blob_name)) {
+      return int8_copy.at(blob_name);
+    }
+    QuantParam param;
+    CHECK(GetQuantParam(blob_name, &param))
+        << "No calibrated range for blob " << blob_name;
+    const auto &int8_name = blob_name + "/int8";
+    add_convert("Quantize", blob_name, int8_name, param);
+    int8_params[int8_name] = param;
+    return int8_copy[blob_name] = int8_name;
+  };
+  auto to_float = [&](const std::string &blob_name) {
+    if (float_ready.count(blob_name)) return;
+    CHECK(int8_copy.count(blob_name)) << "Blob " << blob_name << " is unknown";
+    const auto &int8_name = int8_copy.at(blob_name);
+    add_convert("Dequantize", int8_name, blob_name, int8_params.at(int8_name));
+    float_ready.insert(blob_name);
+  };
+
+  for (const auto &op : net_param->op()) {
+    auto op_param = op;
+    const auto &type = op_param.type();
+    int num_inputs = type == "Eltwise" ? op_param.bottom_size()
+                                       : std::min(op_param.bottom_size(), 1);
+    // Conv and Connected always run quantized, Pooling and Eltwise only when
+    // their inputs are already quantized
+    bool quantize = op_param.top_size() == 1 && num_inputs > 0 &&
+                    ranges_.count(op_param.top(0));
+    for (int n = 0; n < num_inputs && quantize; ++n) {
+      const auto &bottom = op_param.bottom(n);
+      if (type == "Conv" || type == "Connected") {
+        quantize = int8_copy.count(bottom) || ranges_.count(bottom);
+      } else {
+        quantize = int8_copy.count(bottom) > 0;
+      }
+    }
+    if (type == "Conv" || type == "Connected") {
+      quantize = quantize && op_param.bottom_size() >= 2 &&
+                 weight_names.count(op_param.bottom(1)) &&
+                 ws_->GetBlobDataType(op_param.bottom(1)) == DataType::kF32;
+    } else if (type != "Pooling" && type != "Eltwise") {
+      quantize = false;
+    }
+
+    if (!quantize) {
+      for (const auto &bottom : op_param.bottom()) {
+        to_float(bottom);
+      }
+      for (const auto &top : op_param.top()) {
+        float_ready.insert(top), int8_copy.erase(top);
+      }
+      ops.push_back(op_param);
+      continue;
+    }
+
+    ArgumentHelper arguments(op_param);
+    VecFloat in_scale;
+    VecInt in_zero_point;
+    for (int n = 0; n < num_inputs; ++n) {
+      const auto &int8_name = to_int8(op_param.bottom(n));
+      op_param.set_bottom(n, int8_name);
+      in_scale.push_back(int8_params.at(int8_name).scale);
+      in_zero_point.push_back(int8_params.at(int8_name).zero_point);
+    }
+    // Pooling keeps the parameters of its input, max pooling is then exact
+    const auto top = op_param.top(0);
+    QuantParam out_param;
+    if (type == "Pooling") {
+      out_param.scale = in_scale[0], out_param.zero_point = in_zero_point[0];
+    } else {
+      GetQuantParam(top, &out_param);
+    }
+
+    if (type == "Conv" || type == "Connected") {
+      int num_output = arguments.GetSingleArgument<int>("num_output", 0);
+      bool transpose =
+          type == "Connected" &&
+          !arguments.GetSingleArgument<bool>("transpose", true);
+      VecFloat weight_scale;
+      const auto &weight_name = QuantizeWeight(op_param.bottom(1), num_output,
+                                               transpose, &weight_scale);
+      op_param.set_bottom(1, weight_name);
+      int8_weights.insert(weight_name);
+      if (transpose) {
+        set_transpose(&op_param);
+      }
+      add_v_f(&op_param, "weight_scale", weight_scale);
+    }
+    if (type == "Eltwise") {
+      add_v_f(&op_param, "in_scale", in_scale);
+      add_v_i(&op_param, "in_zero_point", in_zero_point);
+    } else {
+      add_s_f(&op_param, "in_scale", in_scale[0]);
+      add_s_i(&op_param, "in_zero_point", in_zero_point[0]);
+    }
+    add_s_f(&op_param, "out_scale", out_param.scale);
+    add_s_i(&op_param, "out_zero_point", out_param.zero_point);
+
+    const auto &int8_name = top + "/int8";
+    add_s_s(&op_param, int8_name + "_type", std::string("unsigned char"));
+    op_param.set_top(0, int8_name);
+    int8_params[int8_name] = out_param;
+    int8_copy[top] = int8_name;
+    float_ready.erase(top);
+    ops.push_back(op_param);
+    num_quantized++;
+  }
+  for (const auto &blob_name : out_blob) {
+    to_float(blob_name);
+  }
+
+  net_param->clear_op();
+  for (const auto &op_param : ops) {
+    net_param->add_op()->CopyFrom(op_param);
+  }
+
+  // The float weights replaced by int8 ones are dropped from the network, not
+  // from the workspace which still runs the float network
+  std::set<std::string> used;
+  for (const auto &op_param : net_param->op()) {
+    used.insert(op_param.bottom().begin(), op_param.bottom().end());
+  }
+  std::vector<shadow::Blob> blobs;
+  for (const auto &blob : net_param->blob()) {
+    if (used.count(blob.name())) {
+      blobs.push_back(blob);
+      used.erase(blob.name());
+    }
+  }
+  for (const auto &blob_name : int8_weights) {
+    if (!used.count(blob_name)) continue;
+    shadow::Blob blob;
+    blob.set_name(blob_name);
+    blob.set_type("signed char");
+    for (auto dim : ws_->GetBlobShape(blob_name)) {
+      blob.add_shape(dim);
+    }
+    blobs.push_back(blob);
+  }
+  net_param->clear_blob();
+  for (const auto &blob : blobs) {
+    net_param->add_blob()->CopyFrom(blob);
+  }
+
+  DLOG(INFO) << "Quantizer: " << num_quantized << " of " << ops.size()
+             << " ops quantized";
+}
+
+bool Quantizer::GetQuantParam(const std::string &blob_name,
+                              QuantParam *param) const {
+  if (!ranges_.count(blob_name)) return false;
+  // The range always covers zero, so that zero padding is exact
+  const auto &range = ranges_.at(blob_name);
+  float min = std::min(range.first, 0.f), max = std::max(range.second, 0.f);
+  param->scale = max > min ? (max - min) / 255 : 1;
+  param->zero_point = std::min(
+      std::max(static_cast<int>(std::lround(-min / param->scale)), 0), 255);
+  return true;
+}
+
+std::string Quantizer::QuantizeWeight(const std::string &blob_name,
+                                      int num_output, bool transpose,
+                                      VecFloat *weight_scale) {
+  const auto &int8_name = blob_name + "/int8";
+  if (weight_scales_.count(blob_name)) {
+    *weight_scale = weight_scales_.at(blob_name);
+    return int8_name;
+  }
+
+  const auto blob = ws_->GetBlob(blob_name);
+  CHECK_NOTNULL(blob) << "Can not find blob " << blob_name;
+  int count = blob->count();
+  CHECK_GT(num_output, 0);
+  CHECK_EQ(count % num_output, 0);
+  int kernel_dim = count / num_output;
+  VecFloat data(count);
+  blob->get_data<float>(data.data(), count);
+  auto shape = blob->shape();
+  // Rows of the int8 weights are the output channels
+  if (transpose) {
+    VecFloat transposed(count);
+    for (int k = 0; k < kernel_dim; ++k) {
+      for (int n = 0; n < num_output; ++n) {
+        transposed[n * kernel_dim + k] = data[k * num_output + n];
+      }
+    }
+    data.swap(transposed);
+    shape = VecInt{num_output, kernel_dim};
+  }
+
+  std::vector<signed char> weight(count);
+  weight_scale->resize(num_output);
+  for (int n = 0; n < num_output; ++n) {
+    const auto *data_n = data.data() + n * kernel_dim;
+    float max_abs = 0;
+    for (int k = 0; k < kernel_dim; ++k) {
+      max_abs = std::max(max_abs, std::abs(data_n[k]));
+    }
+    float scale = max_abs > 0 ? max_abs / 127 : 1;
+    for (int k = 0; k < kernel_dim; ++k) {
+      weight[n * kernel_dim + k] =
+          static_cast<signed char>(std::lround(data_n[k] / scale));
+    }
+    (*weight_scale)[n] = scale;
+  }
+
+  auto int8_blob = ws_->CreateBlob(int8_name, DataType::kI8);
+  int8_blob->reshape(shape);
+  int8_blob->set_data<signed char>(weight.data(), count);
+  weight_scales_[blob_name] = *weight_scale;
+  return int8_name;
+}
+
+}  // namespace Shadow
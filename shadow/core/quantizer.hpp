@@ -0,0 +1,57 @@
+#ifndef SHADOW_CORE_QUANTIZER_HPP
+#define SHADOW_CORE_QUANTIZER_HPP
+
+#include "helper.hpp"
+#include "operator.hpp"
+#include "params.hpp"
+#include "workspace.hpp"
+
+#include "util/type.hpp"
+
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Shadow {
+
+// Post training int8 quantization. The float ranges of the blobs are observed
+// while calibration samples run through the network, then the network is
+// rewritten to run Conv, Connected, Pooling and Eltwise on unsigned char
+// blobs. Activations are quantized per tensor with a zero point, weights per
+// output channel without one. Quantize and Dequantize operators are inserted
+// where int8 and float operators meet, network inputs and outputs stay float.
+class Quantizer {
+ public:
+  explicit Quantizer(Workspace *ws) : ws_(ws) {}
+
+  // Widens the ranges of the float tops of op, called after its forward
+  void Observe(const Operator &op);
+
+  // Rewrites net_param by the observed ranges, quantized weights are written
+  // to the workspace and replace the float weights in the blobs of net_param
+  void Quantize(shadow::NetParam *net_param);
+
+ private:
+  struct QuantParam {
+    float scale = 1;
+    int zero_point = 0;
+  };
+
+  bool GetQuantParam(const std::string &blob_name, QuantParam *param) const;
+
+  // Quantizes the weight of op_param with num_output rows, returns the name
+  // of the int8 weight blob and the scales of the rows
+  std::string QuantizeWeight(const std::string &blob_name, int num_output,
+                             bool transpose, VecFloat *weight_scale);
+
+  Workspace *ws_ = nullptr;
+
+  std::map<std::string, std::pair<float, float>> ranges_;
+  std::map<std::string, VecFloat> weight_scales_;
+};
+
+}  // namespace Shadow
+
+#endif  // SHADOW_CORE_QUANTIZER_HPP
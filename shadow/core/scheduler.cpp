@@ -0,0 +1,201 @@
+#include "scheduler.hpp"
+
+#include <algorithm>
+#include <map>
+
+namespace Shadow {
+
+Scheduler::Scheduler(const std::vector<std::shared_ptr<Operator>> &ops,
+                     int num_threads)
+    : ops_(ops) {
+  int num_ops = static_cast<int>(ops_.size());
+
+  // Resolve every view blob to the blob owning its storage
+  std::map<std::string, std::shared_ptr<Blob>> blobs;
+  for (const auto &op : ops_) {
+    for (int i = 0; i < op->bottoms_size(); ++i) {
+      blobs[op->bottoms_name(i)] = op->bottoms(i);
+    }
+    for (int i = 0; i < op->tops_size(); ++i) {
+      blobs[op->tops_name(i)] = op->tops(i);
+    }
+  }
+  std::map<std::string, std::string> alias;
+  for (const auto &blob_it : blobs) {
+    alias[blob_it.first] = blob_it.first;
+    const auto &blob = blob_it.second;
+    if (!blob->shared() || blob->data<void>() == nullptr) continue;
+    const auto *data = blob->data<unsigned char>();
+    for (const auto &root_it : blobs) {
+      const auto &root = root_it.second;
+      if (root->shared()) continue;
+      const auto *root_data = root->data<unsigned char>();
+      if (root_data != nullptr && data >= root_data &&
+          data < root_data + root->max_size()) {
+        alias[blob_it.first] = root_it.first;
+        break;
+      }
+    }
+  }
+
+  std::vector<std::vector<int>> predecessors(num_ops);
+  std::map<std::string, int> last_writer;
+  std::map<std::string, std::vector<int>> readers;
+  for (int n = 0; n < num_ops; ++n) {
+    const auto &op = ops_[n];
+    auto &deps = predecessors[n];
+    VecString bottom_names;
+    for (int i = 0; i < op->bottoms_size(); ++i) {
+      const auto &bottom_name = op->bottoms_name(i);
+      const auto &name = alias.at(bottom_name);
+      if (last_writer.count(name)) {
+        deps.push_back(last_writer.at(name));
+      }
+      // A view must also be bound to the current storage of its owner
+      if (name != bottom_name && last_writer.count(bottom_name)) {
+        deps.push_back(last_writer.at(bottom_name));
+      }
+      readers[name].push_back(n);
+      bottom_names.push_back(op->bottoms_name(i));
+    }
+    for (int i = 0; i < op->tops_size(); ++i) {
+      const auto &top_name = op->tops_name(i);
+      const auto &name = alias.at(top_name);
+      // A top sharing the storage of a bottom only reads it, unless the
+      // operator works in place
+      bool in_place = std::find(bottom_names.begin(), bottom_names.end(),
+                                top_name) != bottom_names.end();
+      if (name != top_name && !in_place) {
+        if (last_writer.count(name)) {
+          deps.push_back(last_writer.at(name));
+        }
+        readers[name].push_back(n);
+        // The operator binds the view, which its readers must wait for
+        last_writer[top_name] = n;
+        continue;
+      }
+      if (last_writer.count(name)) {
+        deps.push_back(last_writer.at(name));
+      }
+      for (int reader : readers[name]) {
+        deps.push_back(reader);
+      }
+      last_writer[name] = n;
+      readers[name].clear();
+    }
+    std::sort(deps.begin(), deps.end());
+    deps.erase(std::unique(deps.begin(), deps.end()), deps.end());
+    deps.erase(std::remove(deps.begin(), deps.end(), n), deps.end());
+  }
+
+  successors_.resize(num_ops), num_deps_.resize(num_ops, 0);
+  ancestors_.assign(num_ops, std::vector<bool>(num_ops, false));
+  for (int n = 0; n < num_ops; ++n) {
+    num_deps_[n] = static_cast<int>(predecessors[n].size());
+    for (int dep : predecessors[n]) {
+      successors_[dep].push_back(n);
+      ancestors_[n][dep] = true;
+      for (int a = 0; a < dep; ++a) {
+        if (ancestors_[dep][a]) {
+          ancestors_[n][a] = true;
+        }
+      }
+    }
+  }
+
+  pending_.reset(new std::atomic<int>[num_ops]);
+
+  for (int n = 1; n < num_threads; ++n) {
+    workers_.emplace_back(&Scheduler::Worker, this, n);
+  }
+}
+
+Scheduler::~Scheduler() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  cond_.notify_all();
+  for (auto &worker : workers_) {
+    worker.join();
+  }
+}
+
+void Scheduler::Run() {
+  int num_ops = static_cast<int>(ops_.size());
+  if (num_ops == 0) return;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (int n = 0; n < num_ops; ++n) {
+      pending_[n] = num_deps_[n];
+      if (num_deps_[n] == 0) {
+        ready_.push_back(n);
+      }
+    }
+    remaining_ = num_ops;
+  }
+  cond_.notify_all();
+
+  while (true) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cond_.wait(lock, [this] { return !ready_.empty() || remaining_ == 0; });
+    if (ready_.empty()) break;
+    int index = ready_.front();
+    ready_.pop_front();
+    lock.unlock();
+    RunFrom(index);
+  }
+}
+
+void Scheduler::Worker(int index) {
+  Workspace::SetTempSlot(index);
+  while (true) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cond_.wait(lock, [this] { return stop_ || !ready_.empty(); });
+    if (stop_) return;
+    int index = ready_.front();
+    ready_.pop_front();
+    lock.unlock();
+    RunFrom(index);
+  }
+}
+
+// Runs the operator, then continues with the first successor it makes ready
+// and hands the others to idle threads
+void Scheduler::RunFrom(int index) {
+  while (index >= 0) {
+    if (profiler_ != nullptr) {
+      profiler_->Begin(index);
+    }
+    ops_[index]->Forward();
+    if (profiler_ != nullptr) {
+      profiler_->End(index);
+    }
+    DLOG(INFO) << ops_[index]->debug_log();
+
+    int next = -1, num_ready = 0;
+    for (int successor : successors_[index]) {
+      if (--pending_[successor] > 0) continue;
+      if (next < 0) {
+        next = successor;
+      } else {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ready_.push_back(successor);
+        num_ready++;
+      }
+    }
+    if (num_ready == 1) {
+      cond_.notify_one();
+    } else if (num_ready > 1) {
+      cond_.notify_all();
+    }
+
+    if (--remaining_ == 0) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      cond_.notify_all();
+    }
+    index = next;
+  }
+}
+
+}  // namespace Shadow
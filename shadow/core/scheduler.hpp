@@ -0,0 +1,68 @@
+#ifndef SHADOW_CORE_SCHEDULER_HPP
+#define SHADOW_CORE_SCHEDULER_HPP
+
+#include "op_profiler.hpp"
+#include "operator.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Shadow {
+
+// Runs independent operators concurrently. The dependencies come from the
+// bottom and top names of the operators, read after write, write after read
+// and write after write on the same storage, a view blob counts as its owner.
+// The readers of a view also wait for the operator binding it, which may move
+// it to new storage in every forward. It must be built after one forward so
+// that the views are known.
+class Scheduler {
+ public:
+  // num_threads includes the calling thread
+  Scheduler(const std::vector<std::shared_ptr<Operator>> &ops,
+            int num_threads);
+  ~Scheduler();
+
+  int num_threads() const { return static_cast<int>(workers_.size()) + 1; }
+
+  // Whether operator a always finishes before operator b starts
+  bool precedes(int a, int b) const {
+    return a < b && ancestors_[b][a];
+  }
+
+  // Runs all operators once and returns when the last one finishes
+  void Run();
+
+  // Times the operators by profiler while it is not nullptr
+  void set_profiler(OpProfiler *profiler) { profiler_ = profiler; }
+
+ private:
+  void Worker(int index);
+  void RunFrom(int index);
+
+  std::vector<std::shared_ptr<Operator>> ops_;
+  std::vector<std::vector<int>> successors_;
+  std::vector<int> num_deps_;
+  std::vector<std::vector<bool>> ancestors_;
+
+  std::unique_ptr<std::atomic<int>[]> pending_;
+  std::atomic<int> remaining_{0};
+
+  std::vector<std::thread> workers_;
+  std::mutex mutex_;
+  std::condition_variable cond_;
+  std::deque<int> ready_;
+  bool stop_ = false;
+
+  OpProfiler *profiler_ = nullptr;
+
+  DISABLE_COPY_AND_ASSIGN(Scheduler);
+};
+
+}  // namespace Shadow
+
+#endif  // SHADOW_CORE_SCHEDULER_HPP
@@ -0,0 +1,85 @@
+#include "thread_pool.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace Shadow {
+
+inline void run_chunk(const std::function<void(int, int)> &func, int range,
+                      int num_tasks, int task) {
+  int begin = static_cast<int>(static_cast<int64_t>(range) * task / num_tasks);
+  int end =
+      static_cast<int>(static_cast<int64_t>(range) * (task + 1) / num_tasks);
+  if (begin < end) {
+    func(begin, end);
+  }
+}
+
+ThreadPool::ThreadPool(int num_threads) {
+  if (num_threads <= 0) {
+    num_threads = static_cast<int>(std::thread::hardware_concurrency());
+  }
+  num_threads_ = std::max(num_threads, 1);
+  for (int n = 1; n < num_threads_; ++n) {
+    workers_.emplace_back(&ThreadPool::Worker, this, n);
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  task_cond_.notify_all();
+  for (auto &worker : workers_) {
+    worker.join();
+  }
+}
+
+void ThreadPool::parallel_for(int range, int grain,
+                              const std::function<void(int, int)> &func) {
+  if (range <= 0) return;
+  int num_tasks = std::min(range / std::max(grain, 1), num_threads_);
+  if (num_tasks <= 1) {
+    func(0, range);
+    return;
+  }
+  std::unique_lock<std::mutex> run_lock(run_mutex_, std::try_to_lock);
+  if (!run_lock.owns_lock()) {
+    func(0, range);
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    func_ = &func, range_ = range, num_tasks_ = num_tasks;
+    pending_ = num_tasks - 1;
+    generation_++;
+  }
+  task_cond_.notify_all();
+  run_chunk(func, range, num_tasks, 0);
+  std::unique_lock<std::mutex> lock(mutex_);
+  done_cond_.wait(lock, [this] { return pending_ == 0; });
+  func_ = nullptr;
+}
+
+void ThreadPool::Worker(int index) {
+  size_t generation = 0;
+  while (true) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    task_cond_.wait(lock,
+                    [&] { return stop_ || generation_ != generation; });
+    if (stop_) return;
+    generation = generation_;
+    if (index >= num_tasks_) continue;
+    const auto *func = func_;
+    int range = range_, num_tasks = num_tasks_;
+    lock.unlock();
+    run_chunk(*func, range, num_tasks, index);
+    lock.lock();
+    if (--pending_ == 0) {
+      done_cond_.notify_one();
+    }
+  }
+}
+
+}  // namespace Shadow
@@ -0,0 +1,54 @@
+#ifndef SHADOW_CORE_THREAD_POOL_HPP
+#define SHADOW_CORE_THREAD_POOL_HPP
+
+#include "common.hpp"
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Shadow {
+
+// Elements an elementwise loop gives each thread at least, smaller loops run
+// on the calling thread
+const int ElementGrain = 16384;
+
+class ThreadPool {
+ public:
+  // num_threads <= 0 uses all hardware threads
+  explicit ThreadPool(int num_threads);
+  ~ThreadPool();
+
+  int num_threads() const { return num_threads_; }
+
+  // Splits [0, range) into contiguous chunks of at least grain and calls
+  // func(begin, end) for each chunk, the calling thread runs the first chunk.
+  // Calls made while the pool is busy, e.g. nested or from concurrent
+  // operators, run inline
+  void parallel_for(int range, int grain,
+                    const std::function<void(int, int)> &func);
+  void parallel_for(int range, const std::function<void(int, int)> &func) {
+    parallel_for(range, 1, func);
+  }
+
+ private:
+  void Worker(int index);
+
+  int num_threads_ = 1;
+  std::vector<std::thread> workers_;
+
+  std::mutex run_mutex_, mutex_;
+  std::condition_variable task_cond_, done_cond_;
+  const std::function<void(int, int)> *func_ = nullptr;
+  int range_ = 0, num_tasks_ = 0, pending_ = 0;
+  size_t generation_ = 0;
+  bool stop_ = false;
+
+  DISABLE_COPY_AND_ASSIGN(ThreadPool);
+};
+
+}  // namespace Shadow
+
+#endif  // SHADOW_CORE_THREAD_POOL_HPP
@@ -2,6 +2,10 @@
 
 namespace Shadow {
 
+const size_t TempAlignment = 64;
+
+thread_local int temp_slot = 0;
+
 Workspace::Workspace(const ArgumentHelper &arguments) {
 #if defined(USE_CUDA)
   context_ = GetContext<DeviceType::kGPU>(arguments);
@@ -10,6 +14,16 @@ Workspace::Workspace(const ArgumentHelper &arguments) {
 #endif
 }
 
+Workspace::Workspace(const ArgumentHelper &arguments, const Workspace &ws) {
+  weight_context_ =
+      ws.weight_context_ != nullptr ? ws.weight_context_ : ws.context_;
+#if defined(USE_CUDA)
+  context_ = GetContext<DeviceType::kGPU>(arguments, ws.context_.get());
+#else
+  context_ = GetContext<DeviceType::kCPU>(arguments, ws.context_.get());
+#endif
+}
+
 Context *Workspace::Ctx() {
   CHECK_NOTNULL(context_);
   return context_.get();
@@ -51,43 +65,125 @@ std::shared_ptr<Blob> Workspace::CreateBlob(const std::string &name,
 
 std::shared_ptr<Blob> Workspace::CreateTempBlob(const std::vector<int> &shape,
                                                 DataType data_type) {
+  auto *arena = GetTempArena();
+  CHECK_GT(arena->scopes, 0) << "Temp blob must be created in a TempScope";
   auto count =
       std::accumulate(shape.begin(), shape.end(), 1, std::multiplies<size_t>());
   CHECK_GT(count, 0);
   auto temp_blob =
       std::make_shared<Blob>("temp", data_type, context_->allocator());
-  temp_blob->share_data(GetTempPtr(count * temp_blob->elem_size()), shape);
+  size_t raw_size = (count * temp_blob->elem_size() + TempAlignment - 1) /
+                    TempAlignment * TempAlignment;
+  const auto &arena_blob = arena->blob;
+  if (arena_blob != nullptr &&
+      arena->offset + raw_size <= arena_blob->max_size()) {
+    temp_blob->share_data(arena_blob->data<unsigned char>() + arena->offset,
+                          shape);
+  } else {
+    // The arena is too small during warm up, the temp blob owns its storage
+    // and the arena grows to the peak size once the outermost scope ends
+    temp_blob->reshape(shape);
+  }
+  arena->offset += raw_size;
+  arena->peak = std::max(arena->peak, arena->offset);
   return temp_blob;
 }
 
-void Workspace::GrowTempBuffer(size_t raw_size) {
-  auto temp_blob = CreateBlob("temp_blob", DataType::kI32);
-  size_t num_int = raw_size / temp_blob->elem_size() + 1;
-  CHECK_LE(num_int, std::numeric_limits<int>::max());
-  temp_blob->reshape({static_cast<int>(num_int)});
-  temp_offset_ = 0;
+size_t Workspace::MarkTemp() {
+  auto *arena = GetTempArena();
+  arena->scopes++;
+  return arena->offset;
+}
+
+void Workspace::ReleaseTemp(size_t mark) {
+  auto *arena = GetTempArena();
+  CHECK_GT(arena->scopes, 0);
+  CHECK_LE(mark, arena->offset);
+  arena->offset = mark;
+  if (--arena->scopes == 0) {
+    GrowTempBuffer(arena, arena->peak);
+  }
+}
+
+void Workspace::ClearTemp() {
+  std::lock_guard<std::mutex> lock(temp_mutex_);
+  for (const auto &arena : temp_arenas_) {
+    if (arena != nullptr) {
+      CHECK_EQ(arena->scopes, 0);
+    }
+  }
+  temp_arenas_.clear();
+}
+
+void Workspace::SetTempSlot(int slot) {
+  CHECK_GE(slot, 0);
+  temp_slot = slot;
 }
 
 size_t Workspace::GetWorkspaceSize() const {
   size_t mem_size = 0;
   for (const auto &blob_it : blob_map_) {
+    // Shared blobs live in the storage of other blobs
+    if (blob_it.second->shared()) continue;
     mem_size += blob_it.second->max_size();
   }
-  return mem_size;
+  return mem_size + GetWorkspaceTempSize();
 }
 
 size_t Workspace::GetWorkspaceTempSize() const {
-  const auto temp_blob = GetBlob("temp_blob");
-  return temp_blob != nullptr ? temp_blob->max_size() : 0;
+  std::lock_guard<std::mutex> lock(temp_mutex_);
+  size_t temp_size = 0;
+  for (const auto &arena : temp_arenas_) {
+    if (arena != nullptr && arena->blob != nullptr) {
+      temp_size += arena->blob->max_size();
+    }
+  }
+  return temp_size;
+}
+
+size_t Workspace::GetWorkspaceTempPeakSize() const {
+  std::lock_guard<std::mutex> lock(temp_mutex_);
+  size_t peak_size = 0;
+  for (const auto &arena : temp_arenas_) {
+    peak_size += arena != nullptr ? arena->peak : 0;
+  }
+  return peak_size;
 }
 
-const void *Workspace::GetTempPtr(size_t raw_size) {
-  const auto temp_blob = GetBlob("temp_blob");
-  CHECK_NOTNULL(temp_blob);
-  CHECK_LE(temp_offset_ + raw_size, temp_blob->max_size());
-  const auto *ptr = temp_blob->data<unsigned char>() + temp_offset_;
-  temp_offset_ += raw_size;
-  return ptr;
+int Workspace::GetWorkspaceTempGrowCount() const {
+  std::lock_guard<std::mutex> lock(temp_mutex_);
+  int grow_count = 0;
+  for (const auto &arena : temp_arenas_) {
+    grow_count += arena != nullptr ? arena->grow_count : 0;
+  }
+  return grow_count;
+}
+
+// Each temp slot owns an arena, so concurrent operators never interleave
+// their temp scopes
+Workspace::TempArena *Workspace::GetTempArena() {
+  std::lock_guard<std::mutex> lock(temp_mutex_);
+  if (temp_slot >= static_cast<int>(temp_arenas_.size())) {
+    temp_arenas_.resize(temp_slot + 1);
+  }
+  auto &arena = temp_arenas_[temp_slot];
+  if (arena == nullptr) {
+    arena.reset(new TempArena());
+  }
+  return arena.get();
+}
+
+void Workspace::GrowTempBuffer(TempArena *arena, size_t raw_size) {
+  if (raw_size == 0) return;
+  if (arena->blob == nullptr) {
+    arena->blob = std::make_shared<Blob>("temp_blob", DataType::kI32,
+                                         context_->allocator());
+  }
+  if (raw_size <= arena->blob->max_size()) return;
+  size_t num_int = raw_size / arena->blob->elem_size() + 1;
+  CHECK_LE(num_int, std::numeric_limits<int>::max());
+  arena->blob->reshape({static_cast<int>(num_int)});
+  arena->grow_count++;
 }
 
 }  // namespace Shadow
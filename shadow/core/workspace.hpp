@@ -6,7 +6,9 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 namespace Shadow {
 
@@ -14,6 +16,11 @@ class Workspace {
  public:
   explicit Workspace(const ArgumentHelper &arguments);
 
+  // The workspace of a clone of the network running on ws, it runs on the
+  // threads of ws and keeps the context which allocated the shared weights
+  // alive
+  Workspace(const ArgumentHelper &arguments, const Workspace &ws);
+
   Context *Ctx();
 
   bool HasBlob(const std::string &name) const;
@@ -26,26 +33,64 @@ class Workspace {
   std::shared_ptr<Blob> CreateBlob(const std::string &name, DataType data_type,
                                    Allocator *allocator = nullptr);
 
+  // Temp blobs are carved from the scratch arena of the temp slot of the
+  // calling thread and stay valid until the enclosing TempScope releases them
   std::shared_ptr<Blob> CreateTempBlob(const std::vector<int> &shape,
                                        DataType data_type);
 
-  void GrowTempBuffer(size_t raw_size);
+  size_t MarkTemp();
+  void ReleaseTemp(size_t mark);
+
+  // Frees the scratch arenas, no TempScope may be open
+  void ClearTemp();
+
+  // Threads running operators use temp slot 0 unless they set another one,
+  // worker n of the inter-op scheduler uses slot n, so there is one arena per
+  // thread of one forward however many threads ever call it
+  static void SetTempSlot(int slot);
 
   size_t GetWorkspaceSize() const;
   size_t GetWorkspaceTempSize() const;
+  size_t GetWorkspaceTempPeakSize() const;
+  int GetWorkspaceTempGrowCount() const;
 
  private:
-  const void *GetTempPtr(size_t raw_size);
+  struct TempArena {
+    std::shared_ptr<Blob> blob = nullptr;
+    size_t offset = 0, peak = 0;
+    int scopes = 0, grow_count = 0;
+  };
 
-  std::shared_ptr<Context> context_{nullptr};
+  TempArena *GetTempArena();
+  void GrowTempBuffer(TempArena *arena, size_t raw_size);
+
+  std::shared_ptr<Context> weight_context_{nullptr}, context_{nullptr};
 
   std::map<std::string, std::shared_ptr<Blob>> blob_map_;
 
-  size_t temp_offset_{0};
+  std::vector<std::unique_ptr<TempArena>> temp_arenas_;
+  mutable std::mutex temp_mutex_;
 
   DISABLE_COPY_AND_ASSIGN(Workspace);
 };
 
+// Releases the temp blobs created in its lifetime, the arena only grows when
+// the outermost scope is released, so no live temp blob is ever invalidated
+class TempScope {
+ public:
+  explicit TempScope(Workspace *ws) : ws_(ws) {
+    CHECK_NOTNULL(ws_);
+    mark_ = ws_->MarkTemp();
+  }
+  ~TempScope() { ws_->ReleaseTemp(mark_); }
+
+ private:
+  Workspace *ws_ = nullptr;
+  size_t mark_ = 0;
+
+  DISABLE_COPY_AND_ASSIGN(TempScope);
+};
+
 }  // namespace Shadow
 
 #endif  // SHADOW_CORE_WORKSPACE_HPP
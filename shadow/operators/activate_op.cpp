@@ -7,7 +7,7 @@ void ActivateOp::Forward() {
   auto top = tops(0);
 
   if (bottom != top) {
-    top->reshape(bottom->shape());
+    top->reshape(bottom->shape(), bottom->layout());
   }
 
 #if defined(USE_CUDNN)
@@ -32,7 +32,8 @@ void ActivateOp::Forward() {
       activate_type_ == kSigmoid || activate_type_ == kSoftPlus ||
       activate_type_ == kTanh || activate_type_ == kRelu6) {
     Vision::Activate(bottom->data<float>(), top->mutable_data<float>(),
-                     top->count(), activate_type_, slope_, ws_->Ctx());
+                     top->storage_count(), activate_type_, slope_,
+                     ws_->Ctx());
   } else if (activate_type_ == kPRelu) {
     CHECK_EQ(bottoms_size(), 2);
     CHECK_GE(bottom->num_axes(), 2);
@@ -41,6 +42,14 @@ void ActivateOp::Forward() {
     if (!channel_shared) {
       CHECK_EQ(slope->count(), bottom->shape(1));
     }
+#if !defined(USE_CUDA)
+    if (bottom->layout() != Layout::kNCHW) {
+      Vision::PReluBlocked(bottom->data<float>(), top->mutable_data<float>(),
+                           top->shape(), top->block(), channel_shared,
+                           slope->data<float>(), ws_->Ctx());
+      return;
+    }
+#endif
     Vision::PRelu(bottom->data<float>(), top->mutable_data<float>(),
                   top->shape(), channel_shared, slope->data<float>(),
                   ws_->Ctx());
@@ -79,42 +88,46 @@ inline T Activate(T x, int type, float slope) {
 template <typename T>
 void Activate(const T *in_data, T *out_data, int count, int type, float slope,
               Context *context) {
+  context->thread_pool()->parallel_for(
+      count, ElementGrain, [&](int begin, int end) {
 #if defined(USE_Eigen)
-  const auto &in_eigen = MapVector<T>(const_cast<T *>(in_data), count);
-  auto out_eigen = MapVector<T>(out_data, count);
-  switch (type) {
-    case ActivateOp::kRelu:
-      out_eigen = in_eigen.cwiseMax(T(0));
-      break;
-    case ActivateOp::kLeaky:
-      out_eigen =
-          in_eigen.unaryExpr([slope](T x) { return x > 0 ? x : T(slope * x); });
-      break;
-    case ActivateOp::kSigmoid:
-      out_eigen =
-          in_eigen.unaryExpr([](T x) { return 1 / (1 + std::exp(-x)); });
-      break;
-    case ActivateOp::kSoftPlus:
-      out_eigen =
-          in_eigen.unaryExpr([](T x) { return std::log(1 + std::exp(x)); });
-      break;
-    case ActivateOp::kTanh:
-      out_eigen = in_eigen.unaryExpr([](T x) {
-        T exp_2x = std::exp(2 * x);
-        return (exp_2x - 1) / (exp_2x + 1);
-      });
-      break;
-    case ActivateOp::kRelu6:
-      out_eigen = in_eigen.cwiseMax(T(0)).cwiseMin(T(6));
-      break;
-    default:
-      return;
-  }
+        const auto &in_eigen =
+            MapVector<T>(const_cast<T *>(in_data + begin), end - begin);
+        auto out_eigen = MapVector<T>(out_data + begin, end - begin);
+        switch (type) {
+          case ActivateOp::kRelu:
+            out_eigen = in_eigen.cwiseMax(T(0));
+            break;
+          case ActivateOp::kLeaky:
+            out_eigen = in_eigen.unaryExpr(
+                [slope](T x) { return x > 0 ? x : T(slope * x); });
+            break;
+          case ActivateOp::kSigmoid:
+            out_eigen =
+                in_eigen.unaryExpr([](T x) { return 1 / (1 + std::exp(-x)); });
+            break;
+          case ActivateOp::kSoftPlus:
+            out_eigen = in_eigen.unaryExpr(
+                [](T x) { return std::log(1 + std::exp(x)); });
+            break;
+          case ActivateOp::kTanh:
+            out_eigen = in_eigen.unaryExpr([](T x) {
+              T exp_2x = std::exp(2 * x);
+              return (exp_2x - 1) / (exp_2x + 1);
+            });
+            break;
+          case ActivateOp::kRelu6:
+            out_eigen = in_eigen.cwiseMax(T(0)).cwiseMin(T(6));
+            break;
+          default:
+            return;
+        }
 #else
-  for (int i = 0; i < count; ++i) {
-    out_data[i] = Activate(in_data[i], type, slope);
-  }
+        for (int i = begin; i < end; ++i) {
+          out_data[i] = Activate(in_data[i], type, slope);
+        }
 #endif
+      });
 }
 
 template <typename T>
@@ -124,15 +137,52 @@ void PRelu(const T *in_data, T *out_data, const VecInt &in_shape,
   for (int i = 2; i < in_shape.size(); ++i) dim *= in_shape[i];
   int count = in_shape[0] * channels * dim;
   int div_factor = channel_shared ? channels : 1;
-  for (int i = 0; i < count; ++i) {
-    int c = (i / dim) % channels / div_factor;
-    out_data[i] = in_data[i] > 0 ? in_data[i] : in_data[i] * slope_data[c];
+  context->thread_pool()->parallel_for(
+      count, ElementGrain, [&](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+          int c = (i / dim) % channels / div_factor;
+          out_data[i] =
+              in_data[i] > 0 ? in_data[i] : in_data[i] * slope_data[c];
+        }
+      });
+}
+
+template <typename T>
+void PReluBlocked(const T *in_data, T *out_data, const VecInt &in_shape,
+                  int block, bool channel_shared, const T *slope_data,
+                  Context *context) {
+  int channels = in_shape[1], dim = 1;
+  for (int i = 2; i < static_cast<int>(in_shape.size()); ++i) {
+    dim *= in_shape[i];
   }
+  int num_blocks = (channels + block - 1) / block;
+  int grain = ElementGrain / (block * dim);
+  context->thread_pool()->parallel_for(
+      in_shape[0] * num_blocks, grain, [&](int begin, int end) {
+        T slope[16];
+        for (int b_cb = begin; b_cb < end; ++b_cb) {
+          int c_0 = b_cb % num_blocks * block;
+          for (int l = 0; l < block; ++l) {
+            int c = std::min(c_0 + l, channels - 1);
+            slope[l] = slope_data[channel_shared ? 0 : c];
+          }
+          const T *in_block = in_data + b_cb * dim * block;
+          T *out_block = out_data + b_cb * dim * block;
+          for (int i = 0; i < dim * block; i += block) {
+            for (int l = 0; l < block; ++l) {
+              T x = in_block[i + l];
+              out_block[i + l] = x > 0 ? x : x * slope[l];
+            }
+          }
+        }
+      });
 }
 
 template void Activate(const float *, float *, int, int, float, Context *);
 template void PRelu(const float *, float *, const VecInt &, bool, const float *,
                     Context *);
+template void PReluBlocked(const float *, float *, const VecInt &, int, bool,
+                           const float *, Context *);
 #endif
 
 }  // namespace Vision
@@ -69,6 +69,11 @@ template <typename T>
 void PRelu(const T *in_data, T *out_data, const VecInt &in_shape,
            bool channel_shared, const T *slope_data, Context *context);
 
+template <typename T>
+void PReluBlocked(const T *in_data, T *out_data, const VecInt &in_shape,
+                  int block, bool channel_shared, const T *slope_data,
+                  Context *context);
+
 }  // namespace Vision
 
 }  // namespace Shadow
@@ -38,14 +38,13 @@ void Axpy(const T *scale_data, const T *x_data, const T *y_data,
   int count = batch * in_c * in_h * in_w;
   int spatial_dim = in_h * in_w;
   Blas::BlasScopy(count, y_data, 0, out_data, 0, context);
-  for (int b = 0; b < batch; ++b) {
-    for (int c = 0; c < in_c; ++c) {
-      int scale_offset = b * in_c + c;
+  context->thread_pool()->parallel_for(batch * in_c, [&](int begin, int end) {
+    for (int scale_offset = begin; scale_offset < end; ++scale_offset) {
       int data_offset = scale_offset * spatial_dim;
       Blas::BlasSaxpy(spatial_dim, scale_data[scale_offset], x_data,
                       data_offset, out_data, data_offset, context);
     }
-  }
+  });
 }
 
 template void Axpy(const float *, const float *, const float *, const VecInt &,
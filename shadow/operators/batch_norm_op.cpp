@@ -1,5 +1,7 @@
 #include "batch_norm_op.hpp"
 
+#include "scale_op.hpp"
+
 namespace Shadow {
 
 void BatchNormOp::Forward() {
@@ -12,7 +14,7 @@ void BatchNormOp::Forward() {
   const auto bottom = bottoms(0);
   auto top = tops(0);
 
-  top->reshape(bottom->shape());
+  top->reshape(bottom->shape(), bottom->layout());
 
   int batch = bottom->shape(0), channel = bottom->shape(1),
       spatial_dim = bottom->count(2);
@@ -23,7 +25,7 @@ void BatchNormOp::Forward() {
                                   spatial_dim, 1);
     cudnn::setTensor4dDesc<float>(&param_desc_, 1, channel, 1, 1);
 
-    ws_->GrowTempBuffer(4 * channel * sizeof(float));
+    TempScope temp_scope(ws_);
 
     auto scale_cudnn = ws_->CreateTempBlob({1, channel}, DataType::kF32);
     auto bias_cudnn = ws_->CreateTempBlob({1, channel}, DataType::kF32);
@@ -61,14 +63,39 @@ void BatchNormOp::Forward() {
   }
 #endif
 
+#if !defined(USE_CUDA)
+  // Blocked blobs are normalized by the folded channel wise scale and bias
+  if (bottom->layout() != Layout::kNCHW) {
+    CHECK(use_global_stats_)
+        << "Blocked layouts only support batch norm with global stats";
+    CHECK_EQ(bottoms(1)->count(), channel);
+    CHECK_EQ(bottoms(2)->count(), channel);
+    float scale = 1;
+    if (bottoms_size() == 4) {
+      CHECK_EQ(bottoms(3)->count(), 1);
+      bottoms(3)->get_data<float>(&scale, 1);
+    }
+    float scale_factor = scale == 0 ? 0 : 1 / scale;
+    const auto *mean_data = bottoms(1)->data<float>();
+    const auto *variance_data = bottoms(2)->data<float>();
+    VecFloat bn_scale(channel), bn_bias(channel);
+    for (int c = 0; c < channel; ++c) {
+      bn_scale[c] = 1 / std::sqrt(variance_data[c] * scale_factor + eps_);
+      bn_bias[c] = -mean_data[c] * scale_factor * bn_scale[c];
+    }
+    Vision::ScaleBlocked(bottom->data<float>(), bottom->shape(),
+                         bottom->block(), bn_scale.data(), bn_bias.data(),
+                         top->mutable_data<float>(), ws_->Ctx());
+    return;
+  }
+#endif
+
   if (bottom != top) {
     Blas::BlasScopy(bottom->count(), bottom->data<float>(), 0,
                     top->mutable_data<float>(), 0, ws_->Ctx());
   }
 
-  int temp_count =
-      2 * channel + bottom->count() + batch * channel + batch + spatial_dim;
-  ws_->GrowTempBuffer(temp_count * sizeof(float));
+  TempScope temp_scope(ws_);
 
   auto mean = ws_->CreateTempBlob({1, channel}, DataType::kF32);
   auto variance = ws_->CreateTempBlob({1, channel}, DataType::kF32);
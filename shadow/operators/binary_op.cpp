@@ -47,7 +47,7 @@ void BinaryOp::Forward() {
   if (!has_scalar_arg_ && need_broadcast_) {
     int num_axes = static_cast<int>(top_shape_.size());
 
-    ws_->GrowTempBuffer(3 * num_axes * sizeof(int));
+    TempScope temp_scope(ws_);
 
     auto bottom_shape = ws_->CreateTempBlob({num_axes}, DataType::kI32);
     auto scalar_shape = ws_->CreateTempBlob({num_axes}, DataType::kI32);
@@ -165,17 +165,20 @@ void BroadcastBinary(const T *in_data, const int *in_shape,
     scalar_shape_acc.insert(scalar_shape_acc.begin(),
                             scalar_shape[n] * scalar_shape_acc[0]);
   }
-  for (int i = 0; i < count; ++i) {
-    int in_index = 0, scalar_index = 0, cc = i;
-    for (int n = num_axes - 1; n >= 0; --n) {
-      int dim = cc % out_shape[n];
-      in_index += (dim % in_shape[n]) * in_shape_acc[n];
-      scalar_index += (dim % scalar_shape[n]) * scalar_shape_acc[n];
-      cc /= out_shape[n];
-    }
-    out_data[i] =
-        Binary(in_data[in_index], scalar_data[scalar_index], operation);
-  }
+  context->thread_pool()->parallel_for(
+      count, ElementGrain, [&](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+          int in_index = 0, scalar_index = 0, cc = i;
+          for (int n = num_axes - 1; n >= 0; --n) {
+            int dim = cc % out_shape[n];
+            in_index += (dim % in_shape[n]) * in_shape_acc[n];
+            scalar_index += (dim % scalar_shape[n]) * scalar_shape_acc[n];
+            cc /= out_shape[n];
+          }
+          out_data[i] =
+              Binary(in_data[in_index], scalar_data[scalar_index], operation);
+        }
+      });
 }
 
 template void BroadcastBinary(const float *, const int *, const float *,
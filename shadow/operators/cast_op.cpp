@@ -0,0 +1,141 @@
+#include "cast_op.hpp"
+
+#if defined(HAVE_TARGET_CLONES)
+#define CAST_F16C
+#include <immintrin.h>
+#endif
+
+namespace Shadow {
+
+void CastOp::Forward() {
+  const auto bottom = bottoms(0);
+  auto top = tops(0);
+
+  top->reshape(bottom->shape(), bottom->layout());
+
+#if !defined(USE_CUDA)
+  int count = bottom->storage_count();
+  const auto in_type = bottom->data_type(), out_type = top->data_type();
+  if (in_type == DataType::kF32 && out_type == DataType::kF16) {
+    Vision::Cast(bottom->data<float>(), count, top->mutable_data<Half>(),
+                 ws_->Ctx());
+  } else if (in_type == DataType::kF32 && out_type == DataType::kBF16) {
+    Vision::Cast(bottom->data<float>(), count, top->mutable_data<BFloat16>(),
+                 ws_->Ctx());
+  } else if (in_type == DataType::kF16 && out_type == DataType::kF32) {
+    Vision::Cast(bottom->data<Half>(), count, top->mutable_data<float>(),
+                 ws_->Ctx());
+  } else if (in_type == DataType::kBF16 && out_type == DataType::kF32) {
+    Vision::Cast(bottom->data<BFloat16>(), count, top->mutable_data<float>(),
+                 ws_->Ctx());
+  } else {
+    LOG(FATAL) << "Cast only converts float from and to half or bfloat16";
+  }
+
+#else
+  LOG(FATAL) << "Half and bfloat16 operators are only supported on CPU";
+#endif
+}
+
+REGISTER_OPERATOR(Cast, CastOp);
+
+namespace Vision {
+
+#if !defined(USE_CUDA)
+template <typename Tin, typename Tout>
+void Cast(const Tin *in_data, int count, Tout *out_data, Context *context) {
+  context->thread_pool()->parallel_for(
+      count, ElementGrain, [&](int begin, int end) {
+        CastRow(in_data + begin, end - begin, out_data + begin);
+      });
+}
+
+template void Cast(const float *, int, Half *, Context *);
+template void Cast(const float *, int, BFloat16 *, Context *);
+template void Cast(const Half *, int, float *, Context *);
+template void Cast(const BFloat16 *, int, float *, Context *);
+
+inline void half_to_float_row(const Half *in_data, int count,
+                              float *out_data) {
+  for (int i = 0; i < count; ++i) {
+    out_data[i] = half_to_float(in_data[i]);
+  }
+}
+
+inline void float_to_half_row(const float *in_data, int count,
+                              Half *out_data) {
+  for (int i = 0; i < count; ++i) {
+    out_data[i] = float_to_half(in_data[i]);
+  }
+}
+
+using HalfToFloatFunc = void (*)(const Half *, int, float *);
+using FloatToHalfFunc = void (*)(const float *, int, Half *);
+
+#if defined(CAST_F16C)
+__attribute__((target("avx,f16c"))) void half_to_float_f16c(
+    const Half *in_data, int count, float *out_data) {
+  int i = 0;
+  for (; i + 8 <= count; i += 8) {
+    auto half = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in_data + i));
+    _mm256_storeu_ps(out_data + i, _mm256_cvtph_ps(half));
+  }
+  half_to_float_row(in_data + i, count - i, out_data + i);
+}
+
+__attribute__((target("avx,f16c"))) void float_to_half_f16c(
+    const float *in_data, int count, Half *out_data) {
+  int i = 0;
+  for (; i + 8 <= count; i += 8) {
+    auto half = _mm256_cvtps_ph(_mm256_loadu_ps(in_data + i),
+                                _MM_FROUND_TO_NEAREST_INT);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out_data + i), half);
+  }
+  float_to_half_row(in_data + i, count - i, out_data + i);
+}
+
+inline bool has_f16c() {
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx") && __builtin_cpu_supports("f16c");
+}
+
+inline HalfToFloatFunc select_half_to_float() {
+  return has_f16c() ? half_to_float_f16c : half_to_float_row;
+}
+
+inline FloatToHalfFunc select_float_to_half() {
+  return has_f16c() ? float_to_half_f16c : float_to_half_row;
+}
+#else
+inline HalfToFloatFunc select_half_to_float() { return half_to_float_row; }
+
+inline FloatToHalfFunc select_float_to_half() { return float_to_half_row; }
+#endif
+
+void CastRow(const Half *in_data, int count, float *out_data) {
+  static const HalfToFloatFunc func = select_half_to_float();
+  func(in_data, count, out_data);
+}
+
+void CastRow(const float *in_data, int count, Half *out_data) {
+  static const FloatToHalfFunc func = select_float_to_half();
+  func(in_data, count, out_data);
+}
+
+// The bfloat16 conversions are shifts and adds which vectorize on any CPU
+void CastRow(const BFloat16 *in_data, int count, float *out_data) {
+  for (int i = 0; i < count; ++i) {
+    out_data[i] = bfloat16_to_float(in_data[i]);
+  }
+}
+
+void CastRow(const float *in_data, int count, BFloat16 *out_data) {
+  for (int i = 0; i < count; ++i) {
+    out_data[i] = float_to_bfloat16(in_data[i]);
+  }
+}
+#endif
+
+}  // namespace Vision
+
+}  // namespace Shadow
@@ -0,0 +1,34 @@
+#ifndef SHADOW_OPERATORS_CAST_OP_HPP
+#define SHADOW_OPERATORS_CAST_OP_HPP
+
+#include "core/operator.hpp"
+
+namespace Shadow {
+
+// Converts a blob between float, half and bfloat16, the type of the top is
+// given by the argument <top>_type
+class CastOp : public Operator {
+ public:
+  CastOp(const shadow::OpParam &op_param, Workspace *ws)
+      : Operator(op_param, ws) {}
+
+  void Forward() override;
+};
+
+namespace Vision {
+
+template <typename Tin, typename Tout>
+void Cast(const Tin *in_data, int count, Tout *out_data, Context *context);
+
+// Converts a row on the calling thread, with F16C instructions for half where
+// the CPU has them. Conversions to half and bfloat16 round to nearest even
+void CastRow(const Half *in_data, int count, float *out_data);
+void CastRow(const BFloat16 *in_data, int count, float *out_data);
+void CastRow(const float *in_data, int count, Half *out_data);
+void CastRow(const float *in_data, int count, BFloat16 *out_data);
+
+}  // namespace Vision
+
+}  // namespace Shadow
+
+#endif  // SHADOW_OPERATORS_CAST_OP_HPP
@@ -34,9 +34,17 @@ void ConcatOp::Forward() {
   for (int n = 0; n < bottoms_size(); ++n) {
     const auto bottom = bottoms(n);
     int bottom_concat_axis = bottom->shape(axis_);
-    Vision::Concat(bottom->data<float>(), bottom->count(), num_concats,
-                   concat_size, top_concat_axis, bottom_concat_axis,
-                   offset_concat_axis, top->mutable_data<float>(), ws_->Ctx());
+    // The memory planner may place a bottom in its slot of the top, its
+    // producer has written the top already
+    bool in_place = num_concats == 1 &&
+                    bottom->data<float>() ==
+                        top->data<float>() + offset_concat_axis * concat_size;
+    if (!in_place) {
+      Vision::Concat(bottom->data<float>(), bottom->count(), num_concats,
+                     concat_size, top_concat_axis, bottom_concat_axis,
+                     offset_concat_axis, top->mutable_data<float>(),
+                     ws_->Ctx());
+    }
     offset_concat_axis += bottom_concat_axis;
   }
 }
@@ -50,11 +58,14 @@ template <typename T>
 void Concat(const T *in_data, int count, int num_concats, int concat_size,
             int top_concat_axis, int bottom_concat_axis, int offset_concat_axis,
             T *out_data, Context *context) {
-  for (int n = 0; n < num_concats; ++n) {
-    memcpy(out_data + (n * top_concat_axis + offset_concat_axis) * concat_size,
-           in_data + n * bottom_concat_axis * concat_size,
-           bottom_concat_axis * concat_size * sizeof(T));
-  }
+  context->thread_pool()->parallel_for(num_concats, [&](int begin, int end) {
+    for (int n = begin; n < end; ++n) {
+      memcpy(
+          out_data + (n * top_concat_axis + offset_concat_axis) * concat_size,
+          in_data + n * bottom_concat_axis * concat_size,
+          bottom_concat_axis * concat_size * sizeof(T));
+    }
+  });
 }
 
 template void Concat(const float *, int, int, int, int, int, int, float *,
@@ -1,5 +1,9 @@
 #include "connected_op.hpp"
 
+#include "activate_op.hpp"
+#include "matmul_op.hpp"
+#include "quantize_op.hpp"
+
 namespace Shadow {
 
 void ConnectedOp::Forward() {
@@ -18,7 +22,71 @@ void ConnectedOp::Forward() {
   VecInt top_shape{batch, num_output_};
   top->reshape(top_shape);
 
-  if (batch == 1) {
+  if (bottom->data_type() == DataType::kU8) {
+#if !defined(USE_CUDA)
+    CHECK(weight->data_type() == DataType::kI8);
+    CHECK(transpose_) << "Quantized weights must be num_output x in";
+    if (quantized_offset_.empty()) {
+      Vision::QuantizedOffset(
+          weight->data<signed char>(),
+          bias_term_ ? bottoms(2)->data<float>() : nullptr, num_output_,
+          bottom_num, in_scale_, in_zero_point_, weight_scale_, out_scale_,
+          &quantized_offset_, &quantized_multiplier_);
+    }
+    int low, high;
+    quantized_activate_range(activate_type_, out_scale_, out_zero_point_, &low,
+                             &high);
+    const auto *in_data = bottom->data<unsigned char>();
+    const auto *weight_data = weight->data<signed char>();
+    auto *out_data = top->mutable_data<unsigned char>();
+    ws_->Ctx()->thread_pool()->parallel_for(
+        num_output_, [&](int begin, int end) {
+          Vision::QuantizedGemm(
+              end - begin, batch, bottom_num, weight_data + begin * bottom_num,
+              in_data, quantized_offset_.data() + begin,
+              quantized_multiplier_.data() + begin, out_zero_point_, low, high,
+              out_data + begin, 1, num_output_);
+        });
+    return;
+
+#else
+    LOG(FATAL) << "Quantized operators are only supported on CPU";
+#endif
+  }
+
+  const auto weight_type = weight->data_type();
+  if (weight_type == DataType::kF16 || weight_type == DataType::kBF16) {
+#if !defined(USE_CUDA)
+    TempScope temp_scope(ws_);
+    int temp_count =
+        Vision::MatMulReducedTempCount(batch, num_output_, bottom_num);
+    std::shared_ptr<Blob> reduced_temp = nullptr;
+    if (temp_count > 0) {
+      reduced_temp = ws_->CreateTempBlob({temp_count}, DataType::kF32);
+    }
+    auto *temp_data =
+        temp_count > 0 ? reduced_temp->mutable_data<float>() : nullptr;
+    if (weight_type == DataType::kF16) {
+      Vision::MatMulReduced(transpose_, batch, num_output_, bottom_num,
+                            bottom->data<float>(), weight->data<Half>(),
+                            temp_data, top->mutable_data<float>(), ws_->Ctx());
+    } else {
+      Vision::MatMulReduced(transpose_, batch, num_output_, bottom_num,
+                            bottom->data<float>(), weight->data<BFloat16>(),
+                            temp_data, top->mutable_data<float>(), ws_->Ctx());
+    }
+    if (bias_term_) {
+      for (int b = 0; b < batch; ++b) {
+        Blas::BlasSaxpy(num_output_, 1, bottoms(2)->data<float>(), 0,
+                        top->mutable_data<float>(), b * num_output_,
+                        ws_->Ctx());
+      }
+    }
+
+#else
+    LOG(FATAL) << "Half and bfloat16 operators are only supported on CPU";
+#endif
+  } else if (batch == 1) {
     if (transpose_) {
       Blas::BlasSgemv(0, num_output_, bottom_num, 1, weight->data<float>(), 0,
                       bottom->data<float>(), 0, 0, top->mutable_data<float>(),
@@ -37,7 +105,7 @@ void ConnectedOp::Forward() {
                     bottom->data<float>(), 0, weight->data<float>(), 0, 0,
                     top->mutable_data<float>(), 0, ws_->Ctx());
     if (bias_term_) {
-      ws_->GrowTempBuffer(batch * sizeof(float));
+      TempScope temp_scope(ws_);
       auto biases_multiplier = ws_->CreateTempBlob({batch}, DataType::kF32);
       Blas::Set(batch, 1, biases_multiplier->mutable_data<float>(), 0,
                 ws_->Ctx());
@@ -47,6 +115,10 @@ void ConnectedOp::Forward() {
                       top->mutable_data<float>(), 0, ws_->Ctx());
     }
   }
+  if (activate_type_ == 1) {
+    Vision::Activate(top->data<float>(), top->mutable_data<float>(),
+                     top->count(), activate_type_, 0, ws_->Ctx());
+  }
 }
 
 REGISTER_OPERATOR(Connected, ConnectedOp);
@@ -13,13 +13,26 @@ class ConnectedOp : public Operator {
     num_output_ = get_single_argument<int>("num_output", 0);
     bias_term_ = get_single_argument<bool>("bias_term", true);
     transpose_ = get_single_argument<bool>("transpose", true);
+    activate_type_ = get_single_argument<int>("type", -1);
+    CHECK((activate_type_ == -1 || activate_type_ == 1))
+        << "Build in activate only support Relu";
+    in_scale_ = get_single_argument<float>("in_scale", 1);
+    in_zero_point_ = get_single_argument<int>("in_zero_point", 0);
+    out_scale_ = get_single_argument<float>("out_scale", 1);
+    out_zero_point_ = get_single_argument<int>("out_zero_point", 0);
+    weight_scale_ = get_repeated_argument<float>("weight_scale");
   }
 
   void Forward() override;
 
  private:
-  int num_output_;
+  int num_output_, activate_type_;
   bool bias_term_, transpose_;
+
+  float in_scale_, out_scale_;
+  int in_zero_point_, out_zero_point_;
+  VecFloat weight_scale_, quantized_multiplier_;
+  VecInt quantized_offset_;
 };
 
 }  // namespace Shadow
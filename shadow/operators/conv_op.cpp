@@ -1,6 +1,14 @@
 #include "conv_op.hpp"
 
 #include "activate_op.hpp"
+#include "quantize_op.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <tuple>
 
 namespace Shadow {
 
@@ -28,7 +36,7 @@ void ConvOp::Forward() {
       conv_out_size(in_h, kernel_size_h_, stride_h_, pad_h_, dilation_);
   top_shape[3] =
       conv_out_size(in_w, kernel_size_w_, stride_w_, pad_w_, dilation_);
-  top->reshape(top_shape);
+  top->reshape(top_shape, bottom->layout());
 
   out_spatial_dim_ = top->count(2);
   kernel_dim_ = kernel_size_h_ * kernel_size_w_ * in_c / group_;
@@ -37,8 +45,86 @@ void ConvOp::Forward() {
   col_offset_ = kernel_dim_ * out_spatial_dim_;
   output_offset_ = num_output_ * out_spatial_dim_ / group_;
 
+  if (bottom->data_type() == DataType::kU8) {
+#if !defined(USE_CUDA)
+    CHECK(weight->data_type() == DataType::kI8);
+    CHECK(bottom->layout() == Layout::kNCHW);
+    if (quantized_offset_.empty()) {
+      Vision::QuantizedOffset(
+          weight->data<signed char>(),
+          bias_term_ ? bottoms(2)->data<float>() : nullptr, num_output_,
+          kernel_dim_, in_scale_, in_zero_point_, weight_scale_, out_scale_,
+          &quantized_offset_, &quantized_multiplier_);
+    }
+    int low, high;
+    quantized_activate_range(activate_type_, out_scale_, out_zero_point_, &low,
+                             &high);
+    if (group_ == in_c && group_ == num_output_) {
+      Vision::QuantizedDepthwise(
+          bottom->data<unsigned char>(), bottom->shape(),
+          weight->data<signed char>(), quantized_offset_.data(),
+          quantized_multiplier_.data(), kernel_size_h_, kernel_size_w_,
+          stride_h_, stride_w_, pad_h_, pad_w_, dilation_, in_zero_point_,
+          out_zero_point_, low, high, top->shape(),
+          top->mutable_data<unsigned char>(), ws_->Ctx());
+    } else {
+      TempScope temp_scope(ws_);
+      auto quantized_temp = ws_->CreateTempBlob(
+          {Vision::QuantizedConvTempCount(kernel_dim_, ws_->Ctx())},
+          DataType::kU8);
+      Vision::QuantizedConv(
+          bottom->data<unsigned char>(), bottom->shape(),
+          weight->data<signed char>(), quantized_offset_.data(),
+          quantized_multiplier_.data(), kernel_size_h_, kernel_size_w_,
+          stride_h_, stride_w_, pad_h_, pad_w_, dilation_, group_,
+          in_zero_point_, out_zero_point_, low, high, top->shape(),
+          quantized_temp->mutable_data<unsigned char>(),
+          top->mutable_data<unsigned char>(), ws_->Ctx());
+    }
+    return;
+
+#else
+    LOG(FATAL) << "Quantized operators are only supported on CPU";
+#endif
+  }
+
+  CHECK(weight->data_type() == DataType::kF32)
+      << "Convolution weights must be float";
+
+#if !defined(USE_CUDA)
+  CheckWeight(*weight);
+  if (bottom->layout() != Layout::kNCHW) {
+    CHECK(group_ == 1 || (group_ == in_c && group_ == num_output_))
+        << "Blocked layouts only support dense and depthwise convolution";
+    if (blocked_weight_block_ != bottom->block()) {
+      blocked_weight_ =
+          DeriveWeight(*weight, WeightForm::kBlocked, bottom->block());
+      blocked_weight_block_ = bottom->block();
+    }
+    TempScope temp_scope(ws_);
+    std::shared_ptr<Blob> blocked_temp = nullptr;
+    if (group_ == 1) {
+      blocked_temp = ws_->CreateTempBlob(
+          {Vision::ConvBlockedTempCount(in_c, kernel_size_h_, kernel_size_w_,
+                                        bottom->block(), ws_->Ctx())},
+          DataType::kF32);
+    }
+    Vision::ConvBlocked(bottom->data<float>(), bottom->shape(),
+                        bottom->block(), blocked_weight_->data(),
+                        bias_term_ ? bottoms(2)->data<float>() : nullptr,
+                        kernel_size_h_, kernel_size_w_, stride_h_, stride_w_,
+                        pad_h_, pad_w_, dilation_, group_, activate_type_,
+                        top->shape(),
+                        group_ == 1 ? blocked_temp->mutable_data<float>()
+                                    : nullptr,
+                        top->mutable_data<float>(), ws_->Ctx());
+    return;
+  }
+#endif
+
 #if defined(USE_NNPACK)
-  use_nnpack_ = batch == 1 && group_ == 1 && dilation_ == 1 && bias_term_;
+  use_nnpack_ = batch == 1 && group_ == 1 && dilation_ == 1 && bias_term_ &&
+                activate_type_ != 6;
   if (use_nnpack_) {
     nnp_algorithm_ = nnp_convolution_algorithm_auto;
     nnp_transform_ = nnp_convolution_transform_strategy_compute;
@@ -94,6 +180,10 @@ void ConvOp::Forward() {
                                bottom->data<float>(), weight->data<float>(),
                                bias_term_ ? bottoms(2)->data<float>() : nullptr,
                                top->mutable_data<float>(), activate_type_);
+    if (activate_type_ == 6) {
+      Vision::Activate(top->data<float>(), top->mutable_data<float>(),
+                       top->count(), activate_type_, 0, ws_->Ctx());
+    }
 
     return;
   }
@@ -128,10 +218,11 @@ void ConvOp::Forward() {
         cudnnHandle_t(ws_->Ctx()->cudnn_handle()), bottom_desc_, filter_desc_,
         conv_desc_, top_desc_, fwd_algo_, &workspace_fwd_size));
 
+    TempScope temp_scope(ws_);
+
     std::shared_ptr<Blob> workspace = nullptr;
     const void *workspace_ptr = nullptr;
     if (workspace_fwd_size > 0) {
-      ws_->GrowTempBuffer(workspace_fwd_size);
       workspace = ws_->CreateTempBlob({static_cast<int>(workspace_fwd_size)},
                                       DataType::kU8);
       workspace_ptr = workspace->data<unsigned char>();
@@ -154,6 +245,9 @@ void ConvOp::Forward() {
           cudnnHandle_t(ws_->Ctx()->cudnn_handle()), activate_desc_,
           cudnn::dataType<float>::one, top_desc_, top->data<float>(),
           cudnn::dataType<float>::zero, top_desc_, top->mutable_data<float>()));
+    } else if (activate_type_ == 6) {
+      Vision::Activate(top->data<float>(), top->mutable_data<float>(),
+                       top->count(), activate_type_, 0, ws_->Ctx());
     }
 
     return;
@@ -166,21 +260,50 @@ void ConvOp::Forward() {
       Vision::Depthwise(bottom->data<float>(), bottom->shape(),
                         weight->data<float>(), bottoms(2)->data<float>(),
                         kernel_size_h_, kernel_size_w_, stride_h_, stride_w_,
-                        pad_h_, pad_w_, dilation_, bias_term_, top->shape(),
-                        top->mutable_data<float>(), ws_->Ctx());
+                        pad_h_, pad_w_, dilation_, bias_term_, activate_type_,
+                        top->shape(), top->mutable_data<float>(), ws_->Ctx());
     } else {
       Vision::Depthwise(
           bottom->data<float>(), bottom->shape(), weight->data<float>(),
           static_cast<decltype(weight->data<float>())>(nullptr), kernel_size_h_,
           kernel_size_w_, stride_h_, stride_w_, pad_h_, pad_w_, dilation_,
-          bias_term_, top->shape(), top->mutable_data<float>(), ws_->Ctx());
+          bias_term_, activate_type_, top->shape(), top->mutable_data<float>(),
+          ws_->Ctx());
     }
   } else {
-    int temp_count = kernel_dim_ * group_ * out_spatial_dim_;
-    if (bias_term_) {
-      temp_count += out_spatial_dim_;
+    TempScope temp_scope(ws_);
+#if !defined(USE_CUDA)
+    int tile = WinogradTile(in_c, top_shape[2], top_shape[3]);
+    if (tile > 0) {
+      auto &winograd_weight =
+          tile == 4 ? winograd_weight_4_ : winograd_weight_2_;
+      if (winograd_weight == nullptr) {
+        winograd_weight = DeriveWeight(*weight, WeightForm::kWinograd, tile);
+      }
+      auto winograd_temp = ws_->CreateTempBlob(
+          {Vision::WinogradTempCount(in_c, tile, ws_->Ctx())}, DataType::kF32);
+      Vision::Winograd(bottom->data<float>(), bottom->shape(),
+                       winograd_weight->data(),
+                       bias_term_ ? bottoms(2)->data<float>() : nullptr, tile,
+                       pad_h_, pad_w_, activate_type_, top->shape(),
+                       winograd_temp->mutable_data<float>(),
+                       top->mutable_data<float>(), ws_->Ctx());
+      return;
     }
-    ws_->GrowTempBuffer(temp_count * sizeof(float));
+
+    if (packed_weight_ == nullptr) {
+      packed_weight_ = DeriveWeight(*weight, WeightForm::kPacked, 0);
+    }
+    auto conv_temp = ws_->CreateTempBlob(
+        {Vision::ConvTempCount(ws_->Ctx())}, DataType::kF32);
+    Vision::Conv(bottom->data<float>(), bottom->shape(), packed_weight_->data(),
+                 bias_term_ ? bottoms(2)->data<float>() : nullptr,
+                 kernel_size_h_, kernel_size_w_, stride_h_, stride_w_, pad_h_,
+                 pad_w_, dilation_, group_, activate_type_, top->shape(),
+                 conv_temp->mutable_data<float>(), top->mutable_data<float>(),
+                 ws_->Ctx());
+    return;
+#else
     auto col_image = ws_->CreateTempBlob(
         {kernel_dim_ * group_, out_spatial_dim_}, DataType::kF32);
     std::shared_ptr<Blob> biases_multiplier = nullptr;
@@ -210,11 +333,101 @@ void ConvOp::Forward() {
                         top->mutable_data<float>(), b * top_num, ws_->Ctx());
       }
     }
+    if (activate_type_ != -1) {
+      Vision::Activate(top->data<float>(), top->mutable_data<float>(),
+                       top->count(), activate_type_, 0, ws_->Ctx());
+    }
+#endif
+  }
+}
+
+void ConvOp::PrepareWeight() {
+#if !defined(USE_CUDA) && !defined(USE_DNNL)
+  if (bottoms_size() < 2) return;
+  const auto weight = ws_->GetBlob(bottoms_name(1));
+  if (weight == nullptr || weight->data<void>() == nullptr ||
+      weight->num_axes() != 4 || weight->data_type() != DataType::kF32) {
+    return;
+  }
+  CheckWeight(*weight);
+  int in_c = weight->shape(1) * group_;
+  if (group_ == in_c && group_ == num_output_ && layout_ == 1) return;
+  if (layout_ > 1) {
+    blocked_weight_ = DeriveWeight(*weight, WeightForm::kBlocked, layout_);
+    blocked_weight_block_ = layout_;
+  } else if (WinogradTile(in_c, INT_MAX, INT_MAX) == 4) {
+    winograd_weight_4_ = DeriveWeight(*weight, WeightForm::kWinograd, 4);
+  } else {
+    packed_weight_ = DeriveWeight(*weight, WeightForm::kPacked, 0);
   }
-  if (activate_type_ == 1) {
-    Vision::Activate(top->data<float>(), top->mutable_data<float>(),
-                     top->count(), activate_type_, 0, ws_->Ctx());
+#endif
+}
+
+void ConvOp::CheckWeight(const Blob &weight) {
+  if (weight.shape() == weight_shape_ && weight.data_type() == weight_type_) {
+    return;
   }
+  packed_weight_.reset();
+  winograd_weight_2_.reset(), winograd_weight_4_.reset();
+  blocked_weight_.reset();
+  blocked_weight_block_ = 0;
+  weight_shape_ = weight.shape();
+  weight_type_ = weight.data_type();
+}
+
+std::shared_ptr<const VecFloat> ConvOp::DeriveWeight(const Blob &weight,
+                                                     WeightForm form,
+                                                     int block) {
+  // Entries expire with the last operator holding their weight, which is
+  // before the weight data is freed
+  static std::mutex mutex;
+  static std::map<std::tuple<const void *, WeightForm, int, int>,
+                  std::weak_ptr<const VecFloat>>
+      derived_weights;
+  std::lock_guard<std::mutex> lock(mutex);
+  for (auto it = derived_weights.begin(); it != derived_weights.end();) {
+    it = it->second.expired() ? derived_weights.erase(it) : std::next(it);
+  }
+  const auto key = std::make_tuple(weight.data<void>(), form, block, group_);
+  auto &cached = derived_weights[key];
+  auto derived = cached.lock();
+  if (derived != nullptr) {
+    return derived;
+  }
+  auto derived_weight = std::make_shared<VecFloat>();
+#if !defined(USE_CUDA)
+  int in_c = weight.shape(1) * group_;
+  if (form == WeightForm::kPacked) {
+    Vision::ConvPackedWeight(weight.data<float>(), num_output_, in_c,
+                             kernel_size_h_, kernel_size_w_, group_,
+                             derived_weight.get());
+  } else if (form == WeightForm::kWinograd) {
+    Vision::WinogradWeight(weight.data<float>(), num_output_, in_c, block,
+                           derived_weight.get());
+  } else {
+    Vision::ConvBlockedWeight(weight.data<float>(), num_output_, in_c,
+                              kernel_size_h_, kernel_size_w_, group_, block,
+                              derived_weight.get());
+  }
+#endif
+  cached = derived_weight;
+  return derived_weight;
+}
+
+// Winograd for 3x3 stride 1 convolutions with enough channels, F(4x4) when
+// the output holds enough tiles, F(2x2) for small outputs with many channels
+int ConvOp::WinogradTile(int in_c, int out_h, int out_w) const {
+  if (kernel_size_h_ != 3 || kernel_size_w_ != 3 || stride_h_ != 1 ||
+      stride_w_ != 1 || dilation_ != 1 || group_ != 1) {
+    return 0;
+  }
+  int min_c = std::min(in_c, num_output_);
+  if (min_c >= 32 && out_h >= 12 && out_w >= 12) {
+    return 4;
+  } else if (min_c >= 256) {
+    return 2;
+  }
+  return 0;
 }
 
 REGISTER_OPERATOR(Conv, ConvOp);
@@ -227,85 +440,931 @@ inline bool check_border(int a, int b) {
   return static_cast<unsigned>(a) < static_cast<unsigned>(b);
 }
 
+// Implicit GEMM convolution, the input is never expanded as a whole. The
+// weights of each group are packed as blocks of ConvMR output channels, the
+// output is split into tiles of ConvPC positions, and every tile expands
+// ConvKC rows of its input patch at a time into a small panel which stays in
+// cache while all output channel blocks are accumulated on it. Bias and Relu
+// are applied when the accumulators are stored.
+const int ConvMR = 4, ConvNR = 8, ConvKC = 256, ConvPC = 128;
+
+inline int conv_round_up(int a, int b) { return (a + b - 1) / b * b; }
+
+// The built in activations, Relu and Relu6
 template <typename T>
-void Im2Col(const T *in_data, const VecInt &in_shape, int offset,
-            int kernel_size_h, int kernel_size_w, int stride_h, int stride_w,
-            int pad_h, int pad_w, int dilation, int zero_point,
-            const VecInt &out_shape, T *col_data, Context *context) {
-  in_data += offset;
-  int in_c = in_shape[1], in_h = in_shape[2], in_w = in_shape[3];
-  int out_h = out_shape[2], out_w = out_shape[3];
-  int spatial_dim = in_h * in_w;
-  for (int k_c = 0; k_c < in_c; ++k_c, in_data += spatial_dim) {
-    for (int k_s = 0; k_s < kernel_size_h * kernel_size_w; ++k_s) {
-      int k_h = k_s / kernel_size_w;
-      int k_w = k_s % kernel_size_w;
-      int im_row = -pad_h + k_h * dilation;
-      for (int h = 0; h < out_h; ++h, im_row += stride_h) {
-        if (check_border(im_row, in_h)) {
-          int im_col = -pad_w + k_w * dilation;
-          for (int w = 0; w < out_w; ++w, im_col += stride_w) {
-            if (check_border(im_col, in_w)) {
-              *(col_data++) = in_data[im_row * in_w + im_col];
+inline T conv_activate(T x, int activate_type) {
+  if (activate_type == 1) {
+    return std::max(x, T(0));
+  } else if (activate_type == 6) {
+    return std::min(std::max(x, T(0)), T(6));
+  }
+  return x;
+}
+
+template <typename T>
+inline void ConvMicroKernel(int kc, const T *a, const T *b, int ldb, T *c,
+                            int ldc, int m, int n, const T *bias, bool first,
+                            int activate_type) {
+  T acc[ConvMR][ConvNR] = {};
+  for (int k = 0; k < kc; ++k, a += ConvMR, b += ldb) {
+    for (int i = 0; i < ConvMR; ++i) {
+      for (int j = 0; j < ConvNR; ++j) {
+        acc[i][j] += a[i] * b[j];
+      }
+    }
+  }
+  for (int i = 0; i < m; ++i) {
+    T init = bias != nullptr ? bias[i] : T(0);
+    for (int j = 0; j < n; ++j) {
+      T val = acc[i][j] + (first ? init : c[i * ldc + j]);
+      c[i * ldc + j] = conv_activate(val, activate_type);
+    }
+  }
+}
+
+// Packed weights: [group][out_c_pad / ConvMR][kernel_dim][ConvMR]
+template <typename T>
+void ConvPackedWeight(const T *weight_data, int out_c, int in_c,
+                      int kernel_size_h, int kernel_size_w, int group,
+                      std::vector<T> *packed_weight) {
+  int out_c_g = out_c / group;
+  int kernel_dim = kernel_size_h * kernel_size_w * in_c / group;
+  int out_c_pad = conv_round_up(out_c_g, ConvMR);
+  packed_weight->assign(group * out_c_pad * kernel_dim, T(0));
+  T *packed_n = packed_weight->data();
+  for (int g = 0; g < group; ++g) {
+    const T *weight_g = weight_data + g * out_c_g * kernel_dim;
+    for (int oc = 0; oc < out_c_pad; oc += ConvMR) {
+      for (int k = 0; k < kernel_dim; ++k) {
+        for (int i = 0; i < ConvMR; ++i, ++packed_n) {
+          if (oc + i < out_c_g) {
+            *packed_n = weight_g[(oc + i) * kernel_dim + k];
+          }
+        }
+      }
+    }
+  }
+}
+
+template void ConvPackedWeight(const float *, int, int, int, int, int,
+                               std::vector<float> *);
+
+int ConvTempCount(Context *context) {
+  return context->thread_pool()->num_threads() * ConvKC * ConvPC;
+}
+
+template <typename T>
+void Conv(const T *in_data, const VecInt &in_shape, const T *packed_weight,
+          const T *bias_data, int kernel_size_h, int kernel_size_w,
+          int stride_h, int stride_w, int pad_h, int pad_w, int dilation,
+          int group, int activate_type, const VecInt &out_shape, T *temp_data,
+          T *out_data, Context *context) {
+  int batch = in_shape[0], in_c = in_shape[1], in_h = in_shape[2],
+      in_w = in_shape[3];
+  int out_c = out_shape[1], out_h = out_shape[2], out_w = out_shape[3];
+  int in_c_g = in_c / group, out_c_g = out_c / group;
+  int kernel_spatial = kernel_size_h * kernel_size_w;
+  int kernel_dim = in_c_g * kernel_spatial;
+  int out_spatial = out_h * out_w;
+  int out_c_pad = conv_round_up(out_c_g, ConvMR);
+
+  int num_tiles = (out_spatial + ConvPC - 1) / ConvPC;
+  int num_jobs = batch * group * num_tiles;
+  int num_tasks = std::min(context->thread_pool()->num_threads(), num_jobs);
+
+  context->thread_pool()->parallel_for(num_tasks, [&](int begin, int end) {
+    for (int task = begin; task < end; ++task) {
+      T *panel = temp_data + task * ConvKC * ConvPC;
+      for (int job = task; job < num_jobs; job += num_tasks) {
+        int tile = job % num_tiles, b_g = job / num_tiles;
+        int g = b_g % group, b = b_g / group;
+        int p_begin = tile * ConvPC;
+        int pc = std::min(ConvPC, out_spatial - p_begin);
+        const T *in_g = in_data + (b * in_c + g * in_c_g) * in_h * in_w;
+        T *out_g = out_data + (b * out_c + g * out_c_g) * out_spatial;
+        for (int k_begin = 0; k_begin < kernel_dim; k_begin += ConvKC) {
+          int kc = std::min(ConvKC, kernel_dim - k_begin);
+          for (int k = 0; k < kc; ++k) {
+            int c = (k_begin + k) / kernel_spatial;
+            int k_s = (k_begin + k) % kernel_spatial;
+            int k_h = k_s / kernel_size_w, k_w = k_s % kernel_size_w;
+            const T *in_c_data = in_g + c * in_h * in_w;
+            T *panel_k = panel + k * ConvPC;
+            int h = p_begin / out_w, w = p_begin % out_w;
+            for (int j = 0; j < pc; w = 0, ++h) {
+              int len = std::min(out_w - w, pc - j);
+              int h_in = h * stride_h - pad_h + k_h * dilation;
+              if (check_border(h_in, in_h)) {
+                const T *in_row = in_c_data + h_in * in_w;
+                int w_in = w * stride_w - pad_w + k_w * dilation;
+                for (int l = 0; l < len; ++l, w_in += stride_w) {
+                  panel_k[j + l] =
+                      check_border(w_in, in_w) ? in_row[w_in] : T(0);
+                }
+              } else {
+                std::fill(panel_k + j, panel_k + j + len, T(0));
+              }
+              j += len;
+            }
+            for (int j = pc; j < conv_round_up(pc, ConvNR); ++j) {
+              panel_k[j] = T(0);
+            }
+          }
+          bool first = k_begin == 0, last = k_begin + kc >= kernel_dim;
+          for (int oc = 0; oc < out_c_g; oc += ConvMR) {
+            const T *packed_oc = packed_weight +
+                                 (g * out_c_pad + oc) * kernel_dim +
+                                 k_begin * ConvMR;
+            const T *bias_oc =
+                bias_data != nullptr ? bias_data + g * out_c_g + oc : nullptr;
+            T *out_oc = out_g + oc * out_spatial + p_begin;
+            int m = std::min(ConvMR, out_c_g - oc);
+            for (int j = 0; j < pc; j += ConvNR) {
+              ConvMicroKernel(kc, packed_oc, panel + j, ConvPC, out_oc + j,
+                              out_spatial, m, std::min(ConvNR, pc - j),
+                              bias_oc, first, last ? activate_type : -1);
+            }
+          }
+        }
+      }
+    }
+  });
+}
+
+template void Conv(const float *, const VecInt &, const float *,
+                   const float *, int, int, int, int, int, int, int, int, int,
+                   const VecInt &, float *, float *, Context *);
+
+// Winograd F(m x m, 3 x 3) convolution for stride 1, the tile size is
+// m + 2. Every input tile of every channel is transformed by B, the products
+// with the transformed weights at each of the (m + 2)^2 points are summed over
+// the input channels by the same micro kernel as above, and the results are
+// transformed back by A. The tiles are processed in blocks of WinogradNT so
+// that the transformed inputs of one block stay in cache.
+const int WinogradNT = 16;
+
+// clang-format off
+const float WinogradG2[4 * 3] = {
+    1.f,  0.f, 0.f,
+    .5f,  .5f, .5f,
+    .5f, -.5f, .5f,
+    0.f,  0.f, 1.f};
+const float WinogradBT2[4 * 4] = {
+    1.f,  0.f, -1.f,  0.f,
+    0.f,  1.f,  1.f,  0.f,
+    0.f, -1.f,  1.f,  0.f,
+    0.f,  1.f,  0.f, -1.f};
+const float WinogradAT2[2 * 4] = {
+    1.f, 1.f,  1.f,  0.f,
+    0.f, 1.f, -1.f, -1.f};
+
+const float WinogradG4[6 * 3] = {
+    1.f / 4,   0.f,        0.f,
+    -1.f / 6,  -1.f / 6,   -1.f / 6,
+    -1.f / 6,  1.f / 6,    -1.f / 6,
+    1.f / 24,  1.f / 12,   1.f / 6,
+    1.f / 24,  -1.f / 12,  1.f / 6,
+    0.f,       0.f,        1.f};
+const float WinogradBT4[6 * 6] = {
+    4.f,  0.f, -5.f,  0.f, 1.f, 0.f,
+    0.f, -4.f, -4.f,  1.f, 1.f, 0.f,
+    0.f,  4.f, -4.f, -1.f, 1.f, 0.f,
+    0.f, -2.f, -1.f,  2.f, 1.f, 0.f,
+    0.f,  2.f, -1.f, -2.f, 1.f, 0.f,
+    0.f,  4.f,  0.f, -5.f, 0.f, 1.f};
+const float WinogradAT4[4 * 6] = {
+    1.f, 1.f,  1.f, 1.f,  1.f, 0.f,
+    0.f, 1.f, -1.f, 2.f, -2.f, 0.f,
+    0.f, 1.f,  1.f, 4.f,  4.f, 0.f,
+    0.f, 1.f, -1.f, 8.f, -8.f, 1.f};
+// clang-format on
+
+// out = left * in * left^T, left is rows x cols, in is cols x cols. The sizes
+// are template arguments so that the loops unroll and the zeros of the
+// constant matrices fold away
+template <typename T, int rows, int cols>
+inline void winograd_transform(const float *left, const T *in, T *out) {
+  T temp[rows * cols];
+  for (int i = 0; i < rows; ++i) {
+    for (int j = 0; j < cols; ++j) {
+      T sum = T(0);
+      for (int k = 0; k < cols; ++k) {
+        sum += left[i * cols + k] * in[k * cols + j];
+      }
+      temp[i * cols + j] = sum;
+    }
+  }
+  for (int i = 0; i < rows; ++i) {
+    for (int j = 0; j < rows; ++j) {
+      T sum = T(0);
+      for (int k = 0; k < cols; ++k) {
+        sum += temp[i * cols + k] * left[j * cols + k];
+      }
+      out[i * rows + j] = sum;
+    }
+  }
+}
+
+int WinogradTempCount(int in_c, int tile, Context *context) {
+  int alpha = tile + 2;
+  int num_tasks = context->thread_pool()->num_threads();
+  return num_tasks * alpha * alpha * (in_c + ConvMR) * WinogradNT;
+}
+
+template <typename T>
+void WinogradWeight(const T *weight_data, int out_c, int in_c, int tile,
+                    std::vector<T> *winograd_weight) {
+  CHECK(tile == 2 || tile == 4);
+  int alpha = tile + 2, out_c_pad = conv_round_up(out_c, ConvMR);
+  const float *G = tile == 2 ? WinogradG2 : WinogradG4;
+  // Packed as [alpha * alpha][out_c_pad / ConvMR][in_c][ConvMR]
+  winograd_weight->assign(alpha * alpha * out_c_pad * in_c, T(0));
+  T *packed_data = winograd_weight->data();
+  for (int oc = 0; oc < out_c; ++oc) {
+    for (int ic = 0; ic < in_c; ++ic) {
+      const T *g = weight_data + (oc * in_c + ic) * 9;
+      T temp[6 * 3], u[6 * 6];
+      for (int i = 0; i < alpha; ++i) {
+        for (int j = 0; j < 3; ++j) {
+          temp[i * 3 + j] = G[i * 3] * g[j] + G[i * 3 + 1] * g[3 + j] +
+                            G[i * 3 + 2] * g[6 + j];
+        }
+      }
+      for (int i = 0; i < alpha; ++i) {
+        for (int j = 0; j < alpha; ++j) {
+          u[i * alpha + j] = temp[i * 3] * G[j * 3] +
+                             temp[i * 3 + 1] * G[j * 3 + 1] +
+                             temp[i * 3 + 2] * G[j * 3 + 2];
+        }
+      }
+      for (int xi = 0; xi < alpha * alpha; ++xi) {
+        int oc_block = oc / ConvMR * ConvMR;
+        packed_data[(xi * out_c_pad + oc_block) * in_c + ic * ConvMR +
+                    oc % ConvMR] = u[xi];
+      }
+    }
+  }
+}
+
+template void WinogradWeight(const float *, int, int, int,
+                             std::vector<float> *);
+
+template <typename T>
+void Winograd(const T *in_data, const VecInt &in_shape,
+              const T *winograd_weight, const T *bias_data, int tile,
+              int pad_h, int pad_w, int activate_type, const VecInt &out_shape,
+              T *temp_data, T *out_data, Context *context) {
+  int batch = in_shape[0], in_c = in_shape[1], in_h = in_shape[2],
+      in_w = in_shape[3];
+  int out_c = out_shape[1], out_h = out_shape[2], out_w = out_shape[3];
+  int alpha = tile + 2, alpha_2 = alpha * alpha;
+  int out_c_pad = conv_round_up(out_c, ConvMR);
+
+  int tiles_h = (out_h + tile - 1) / tile, tiles_w = (out_w + tile - 1) / tile;
+  int num_tiles = tiles_h * tiles_w;
+  int num_blocks = (num_tiles + WinogradNT - 1) / WinogradNT;
+  int num_jobs = batch * num_blocks;
+  int num_tasks = std::min(context->thread_pool()->num_threads(), num_jobs);
+
+  context->thread_pool()->parallel_for(num_tasks, [&](int begin, int end) {
+    for (int task = begin; task < end; ++task) {
+      // [alpha * alpha][in_c][WinogradNT] and [alpha * alpha][ConvMR][NT]
+      T *in_trans = temp_data + task * alpha_2 * (in_c + ConvMR) * WinogradNT;
+      T *out_trans = in_trans + alpha_2 * in_c * WinogradNT;
+      for (int job = task; job < num_jobs; job += num_tasks) {
+        int b = job / num_blocks, t_begin = job % num_blocks * WinogradNT;
+        int nt = std::min(WinogradNT, num_tiles - t_begin);
+        const T *in_b = in_data + b * in_c * in_h * in_w;
+        T *out_b = out_data + b * out_c * out_h * out_w;
+
+        for (int ic = 0; ic < in_c; ++ic) {
+          const T *in_c_data = in_b + ic * in_h * in_w;
+          for (int t = 0; t < WinogradNT; ++t) {
+            T d[6 * 6] = {}, v[6 * 6];
+            if (t < nt) {
+              int h_0 = (t_begin + t) / tiles_w * tile - pad_h;
+              int w_0 = (t_begin + t) % tiles_w * tile - pad_w;
+              for (int i = 0; i < alpha; ++i) {
+                if (!check_border(h_0 + i, in_h)) continue;
+                for (int j = 0; j < alpha; ++j) {
+                  if (check_border(w_0 + j, in_w)) {
+                    d[i * alpha + j] = in_c_data[(h_0 + i) * in_w + w_0 + j];
+                  }
+                }
+              }
+            }
+            if (tile == 2) {
+              winograd_transform<T, 4, 4>(WinogradBT2, d, v);
             } else {
-              *(col_data++) = static_cast<T>(zero_point);
+              winograd_transform<T, 6, 6>(WinogradBT4, d, v);
+            }
+            for (int xi = 0; xi < alpha_2; ++xi) {
+              in_trans[(xi * in_c + ic) * WinogradNT + t] = v[xi];
+            }
+          }
+        }
+
+        for (int oc = 0; oc < out_c; oc += ConvMR) {
+          for (int xi = 0; xi < alpha_2; ++xi) {
+            const T *weight_xi =
+                winograd_weight + (xi * out_c_pad + oc) * in_c;
+            for (int t = 0; t < WinogradNT; t += ConvNR) {
+              ConvMicroKernel(in_c, weight_xi,
+                              in_trans + xi * in_c * WinogradNT + t,
+                              WinogradNT,
+                              out_trans + xi * ConvMR * WinogradNT + t,
+                              WinogradNT, ConvMR, ConvNR,
+                              static_cast<const T *>(nullptr), true, -1);
             }
           }
-        } else {
-          for (int w = 0; w < out_w; ++w) {
-            *(col_data++) = static_cast<T>(zero_point);
+          for (int i = 0; i < std::min(ConvMR, out_c - oc); ++i) {
+            T bias = bias_data != nullptr ? bias_data[oc + i] : T(0);
+            T *out_oc = out_b + (oc + i) * out_h * out_w;
+            for (int t = 0; t < nt; ++t) {
+              T m[6 * 6], y[4 * 4];
+              for (int xi = 0; xi < alpha_2; ++xi) {
+                m[xi] = out_trans[(xi * ConvMR + i) * WinogradNT + t];
+              }
+              if (tile == 2) {
+                winograd_transform<T, 2, 4>(WinogradAT2, m, y);
+              } else {
+                winograd_transform<T, 4, 6>(WinogradAT4, m, y);
+              }
+              int h_0 = (t_begin + t) / tiles_w * tile;
+              int w_0 = (t_begin + t) % tiles_w * tile;
+              for (int p = 0; p < std::min(tile, out_h - h_0); ++p) {
+                for (int q = 0; q < std::min(tile, out_w - w_0); ++q) {
+                  out_oc[(h_0 + p) * out_w + w_0 + q] =
+                      conv_activate(y[p * tile + q] + bias, activate_type);
+                }
+              }
+            }
           }
         }
       }
     }
+  });
+}
+
+template void Winograd(const float *, const VecInt &, const float *,
+                       const float *, int, int, int, int, const VecInt &,
+                       float *, float *, Context *);
+
+// Depthwise convolution by output rows. Inside the interior, where every tap
+// of the kernel is in the input, each tap adds a scaled input row to the
+// output row without bounds checks, the loops over the row are vectorized by
+// the compiler. Kernel sizes 3 and 5 with strides 1 and 2 are unrolled, the
+// borders take the checked path.
+template <typename T, int K, int S>
+inline void depthwise_plane(const T *in_data, int in_h, int in_w,
+                            const T *weight_data, T bias, int kernel_size_h,
+                            int kernel_size_w, int stride_h, int stride_w,
+                            int pad_h, int pad_w, int dilation,
+                            int activate_type, int out_h, int out_w,
+                            T *out_data) {
+  if (K > 0) {
+    kernel_size_h = kernel_size_w = K;
+  }
+  if (S > 0) {
+    stride_h = stride_w = S;
+  }
+  // Output columns [w_begin, w_end) read no padding
+  int w_begin = std::min((pad_w + stride_w - 1) / stride_w, out_w);
+  int w_last = in_w + pad_w - (kernel_size_w - 1) * dilation - 1;
+  int w_end = w_last >= 0 ? std::min(w_last / stride_w + 1, out_w) : 0;
+  w_end = std::max(w_end, w_begin);
+
+  auto checked = [&](int h, int w) {
+    T sum_val = bias;
+    for (int kh = 0; kh < kernel_size_h; ++kh) {
+      int h_in = h * stride_h - pad_h + kh * dilation;
+      if (!check_border(h_in, in_h)) continue;
+      for (int kw = 0; kw < kernel_size_w; ++kw) {
+        int w_in = w * stride_w - pad_w + kw * dilation;
+        if (check_border(w_in, in_w)) {
+          sum_val += in_data[h_in * in_w + w_in] *
+                     weight_data[kh * kernel_size_w + kw];
+        }
+      }
+    }
+    return conv_activate(sum_val, activate_type);
+  };
+
+  for (int h = 0; h < out_h; ++h) {
+    T *out_row = out_data + h * out_w;
+    int h_0 = h * stride_h - pad_h;
+    if (h_0 < 0 || h_0 + (kernel_size_h - 1) * dilation >= in_h) {
+      for (int w = 0; w < out_w; ++w) {
+        out_row[w] = checked(h, w);
+      }
+      continue;
+    }
+    for (int w = 0; w < w_begin; ++w) {
+      out_row[w] = checked(h, w);
+    }
+    for (int w = w_begin; w < w_end; ++w) {
+      out_row[w] = bias;
+    }
+    for (int kh = 0; kh < kernel_size_h; ++kh) {
+      const T *in_row = in_data + (h_0 + kh * dilation) * in_w - pad_w;
+      for (int kw = 0; kw < kernel_size_w; ++kw) {
+        T weight = weight_data[kh * kernel_size_w + kw];
+        const T *in_tap = in_row + kw * dilation;
+        for (int w = w_begin; w < w_end; ++w) {
+          out_row[w] += weight * in_tap[w * stride_w];
+        }
+      }
+    }
+    if (activate_type != -1) {
+      for (int w = w_begin; w < w_end; ++w) {
+        out_row[w] = conv_activate(out_row[w], activate_type);
+      }
+    }
+    for (int w = w_end; w < out_w; ++w) {
+      out_row[w] = checked(h, w);
+    }
   }
 }
 
-template void Im2Col(const float *, const VecInt &, int, int, int, int, int,
-                     int, int, int, int, const VecInt &, float *, Context *);
+// Flattened so the row helpers are inlined into each target clone
+SHADOW_CPU_TARGETS __attribute__((flatten))
+void depthwise_planes(int begin, int end, const float *in_data, int in_c,
+                      int in_h, int in_w, const float *weight_data,
+                      const float *bias_data, int kernel_size_h,
+                      int kernel_size_w, int stride_h, int stride_w, int pad_h,
+                      int pad_w, int dilation, int activate_type, int out_h,
+                      int out_w, float *out_data) {
+  bool square = kernel_size_h == kernel_size_w && stride_h == stride_w;
+  int kernel_size = square ? kernel_size_h : 0, stride = square ? stride_h : 0;
+  for (int b_c = begin; b_c < end; ++b_c) {
+    int c = b_c % in_c;
+    const float *in_plane = in_data + b_c * in_h * in_w;
+    const float *weight_plane = weight_data + c * kernel_size_h * kernel_size_w;
+    float bias = bias_data != nullptr ? bias_data[c] : 0.f;
+    float *out_plane = out_data + b_c * out_h * out_w;
+#define DEPTHWISE_PLANE(K, S)                                                \
+  depthwise_plane<float, K, S>(in_plane, in_h, in_w, weight_plane, bias,     \
+                               kernel_size_h, kernel_size_w, stride_h,       \
+                               stride_w, pad_h, pad_w, dilation,             \
+                               activate_type, out_h, out_w, out_plane)
+    if (kernel_size == 3 && stride == 1) {
+      DEPTHWISE_PLANE(3, 1);
+    } else if (kernel_size == 3 && stride == 2) {
+      DEPTHWISE_PLANE(3, 2);
+    } else if (kernel_size == 5 && stride == 1) {
+      DEPTHWISE_PLANE(5, 1);
+    } else if (kernel_size == 5 && stride == 2) {
+      DEPTHWISE_PLANE(5, 2);
+    } else {
+      DEPTHWISE_PLANE(0, 0);
+    }
+#undef DEPTHWISE_PLANE
+  }
+}
 
 template <typename T>
 void Depthwise(const T *in_data, const VecInt &in_shape, const T *weight_data,
                const T *bias_data, int kernel_size_h, int kernel_size_w,
                int stride_h, int stride_w, int pad_h, int pad_w, int dilation,
-               int bias_term, const VecInt &out_shape, T *out_data,
-               Context *context) {
+               int bias_term, int activate_type, const VecInt &out_shape,
+               T *out_data, Context *context) {
   int batch = in_shape[0];
   int in_c = in_shape[1], in_h = in_shape[2], in_w = in_shape[3];
   int out_h = out_shape[2], out_w = out_shape[3];
-  for (int b = 0; b < batch; ++b) {
-    for (int c = 0; c < in_c; ++c) {
-      const T *in_offset_data = in_data + (b * in_c + c) * in_h * in_w;
-      T *out_offset_data = out_data + (b * in_c + c) * out_h * out_w;
-      for (int h = 0; h < out_h; ++h) {
-        for (int w = 0; w < out_w; ++w) {
-          const T *weight_offset_data =
-              weight_data + c * kernel_size_h * kernel_size_w;
-          auto sum_val = T(0);
-          for (int kh = 0; kh < kernel_size_h; ++kh) {
-            for (int kw = 0; kw < kernel_size_w; ++kw) {
-              int h_in = h * stride_h - pad_h + kh * dilation;
-              int w_in = w * stride_w - pad_w + kw * dilation;
-              if (h_in >= 0 && h_in < in_h && w_in >= 0 && w_in < in_w) {
-                sum_val +=
-                    in_offset_data[h_in * in_w + w_in] * *weight_offset_data;
+  context->thread_pool()->parallel_for(batch * in_c, [&](int begin, int end) {
+    depthwise_planes(begin, end, in_data, in_c, in_h, in_w, weight_data,
+                     bias_term ? bias_data : nullptr, kernel_size_h,
+                     kernel_size_w, stride_h, stride_w, pad_h, pad_w, dilation,
+                     activate_type, out_h, out_w, out_data);
+  });
+}
+
+template void Depthwise(const float *, const VecInt &, const float *,
+                        const float *, int, int, int, int, int, int, int, int,
+                        int, const VecInt &, float *, Context *);
+
+template <typename T>
+void ConvBlockedWeight(const T *weight_data, int out_c, int in_c,
+                       int kernel_size_h, int kernel_size_w, int group,
+                       int block, std::vector<T> *blocked_weight) {
+  int kernel_dim = kernel_size_h * kernel_size_w;
+  int out_c_pad = conv_round_up(out_c, block);
+  if (group == 1) {
+    int in_c_pad = conv_round_up(in_c, block);
+    blocked_weight->assign(out_c_pad * in_c_pad * kernel_dim, T(0));
+    for (int oc = 0; oc < out_c; ++oc) {
+      for (int ic = 0; ic < in_c; ++ic) {
+        for (int k = 0; k < kernel_dim; ++k) {
+          int index = ((oc / block * (in_c_pad / block) + ic / block) *
+                           kernel_dim +
+                       k) *
+                          block * block +
+                      ic % block * block + oc % block;
+          (*blocked_weight)[index] =
+              weight_data[(oc * in_c + ic) * kernel_dim + k];
+        }
+      }
+    }
+  } else {
+    CHECK(group == in_c && group == out_c);
+    blocked_weight->assign(out_c_pad * kernel_dim, T(0));
+    for (int c = 0; c < out_c; ++c) {
+      for (int k = 0; k < kernel_dim; ++k) {
+        (*blocked_weight)[(c / block * kernel_dim + k) * block + c % block] =
+            weight_data[c * kernel_dim + k];
+      }
+    }
+  }
+}
+
+// Dense convolution of blocked blobs by output rows. Every row is split into
+// tiles of ConvBN positions, a tile packs its input patch into a panel as
+// [in_blocks][kernel_dim][B][ConvBN] with zeros for padding, then every output
+// block is accumulated on the panel by ConvBL output channels at a time, the
+// packed weight row of one input channel is loaded contiguously.
+const int ConvBN = 6, ConvBL = 8;
+
+template <typename T>
+inline void conv_blocked_kernel(int kc, const T *a, const T *b, int ldb,
+                                const T *bias, int n, int ldc,
+                                int activate_type, T *c) {
+  T acc[ConvBN][ConvBL] = {};
+  for (int k = 0; k < kc; ++k, a += ConvBN, b += ldb) {
+    for (int t = 0; t < ConvBN; ++t) {
+      for (int l = 0; l < ConvBL; ++l) {
+        acc[t][l] += a[t] * b[l];
+      }
+    }
+  }
+  for (int t = 0; t < n; ++t) {
+    for (int l = 0; l < ConvBL; ++l) {
+      c[t * ldc + l] = conv_activate(acc[t][l] + bias[l], activate_type);
+    }
+  }
+}
+
+template <typename T, int B>
+inline void conv_blocked_rows(int begin, int end, const T *in_data,
+                              const VecInt &in_shape, const T *weight_data,
+                              const T *bias_data, int kernel_size_h,
+                              int kernel_size_w, int stride_h, int stride_w,
+                              int pad_h, int pad_w, int dilation,
+                              int activate_type, const VecInt &out_shape,
+                              T *panel, T *out_data) {
+  int in_c = in_shape[1], in_h = in_shape[2], in_w = in_shape[3];
+  int out_c = out_shape[1], out_h = out_shape[2], out_w = out_shape[3];
+  int in_blocks = (in_c + B - 1) / B, out_blocks = (out_c + B - 1) / B;
+  int kernel_dim = kernel_size_h * kernel_size_w;
+  int kc = in_blocks * kernel_dim * B;
+
+  for (int row = begin; row < end; ++row) {
+    int h = row % out_h, b = row / out_h;
+    int h_0 = h * stride_h - pad_h;
+    const T *in_batch = in_data + b * in_blocks * in_h * in_w * B;
+    for (int w_0 = 0; w_0 < out_w; w_0 += ConvBN) {
+      int nt = std::min(ConvBN, out_w - w_0);
+      T *panel_k = panel;
+      for (int icb = 0; icb < in_blocks; ++icb) {
+        const T *in_block = in_batch + icb * in_h * in_w * B;
+        for (int kh = 0; kh < kernel_size_h; ++kh) {
+          int h_in = h_0 + kh * dilation;
+          bool h_valid = check_border(h_in, in_h);
+          const T *in_row = in_block + h_in * in_w * B;
+          for (int kw = 0; kw < kernel_size_w; ++kw, panel_k += B * ConvBN) {
+            for (int t = 0; t < ConvBN; ++t) {
+              int w_in = (w_0 + t) * stride_w - pad_w + kw * dilation;
+              if (h_valid && t < nt && check_border(w_in, in_w)) {
+                const T *in_val = in_row + w_in * B;
+                for (int icl = 0; icl < B; ++icl) {
+                  panel_k[icl * ConvBN + t] = in_val[icl];
+                }
+              } else {
+                for (int icl = 0; icl < B; ++icl) {
+                  panel_k[icl * ConvBN + t] = T(0);
+                }
               }
-              weight_offset_data++;
             }
           }
-          if (bias_term) {
-            sum_val += bias_data[c];
+        }
+      }
+      for (int ocb = 0; ocb < out_blocks; ++ocb) {
+        const T *weight_ocb = weight_data + ocb * kc * B;
+        T *out_tile =
+            out_data + (((b * out_blocks + ocb) * out_h + h) * out_w + w_0) * B;
+        for (int l_0 = 0; l_0 < B; l_0 += ConvBL) {
+          T bias[ConvBL];
+          for (int l = 0; l < ConvBL; ++l) {
+            int oc = ocb * B + l_0 + l;
+            bias[l] = bias_data != nullptr && oc < out_c ? bias_data[oc] : T(0);
           }
-          out_offset_data[h * out_w + w] = sum_val;
+          conv_blocked_kernel(kc, panel, weight_ocb + l_0, B, bias, nt, B,
+                              activate_type, out_tile + l_0);
         }
       }
     }
   }
 }
 
-template void Depthwise(const float *, const VecInt &, const float *,
-                        const float *, int, int, int, int, int, int, int, int,
-                        const VecInt &, float *, Context *);
+// Depthwise convolution of blocked blobs, vectorized over the channels of a
+// block
+template <typename T, int B, bool Checked>
+inline void depthwise_blocked_tile(const T *in_data, int in_h, int in_w,
+                                   const T *weight_data, const T *bias,
+                                   int kernel_size_h, int kernel_size_w,
+                                   int dilation, int h_0, int w_0,
+                                   int activate_type, T *out_data) {
+  T acc[B];
+  for (int l = 0; l < B; ++l) acc[l] = bias[l];
+  for (int kh = 0; kh < kernel_size_h; ++kh) {
+    int h_in = h_0 + kh * dilation;
+    if (!check_border(h_in, in_h)) continue;
+    const T *in_row = in_data + h_in * in_w * B;
+    const T *weight_kh = weight_data + kh * kernel_size_w * B;
+    for (int kw = 0; kw < kernel_size_w; ++kw) {
+      int w_in = w_0 + kw * dilation;
+      if (Checked && !check_border(w_in, in_w)) continue;
+      const T *in_val = in_row + w_in * B;
+      const T *weight_k = weight_kh + kw * B;
+      for (int l = 0; l < B; ++l) {
+        acc[l] += in_val[l] * weight_k[l];
+      }
+    }
+  }
+  for (int l = 0; l < B; ++l) {
+    out_data[l] = conv_activate(acc[l], activate_type);
+  }
+}
+
+// Output columns which read no padding are computed without bounds checks
+template <typename T, int B>
+inline void depthwise_blocked_rows(int begin, int end, const T *in_data,
+                                   const VecInt &in_shape,
+                                   const T *weight_data, const T *bias_data,
+                                   int kernel_size_h, int kernel_size_w,
+                                   int stride_h, int stride_w, int pad_h,
+                                   int pad_w, int dilation, int activate_type,
+                                   const VecInt &out_shape, T *out_data) {
+  int in_c = in_shape[1], in_h = in_shape[2], in_w = in_shape[3];
+  int out_c = out_shape[1], out_h = out_shape[2], out_w = out_shape[3];
+  int blocks = (in_c + B - 1) / B;
+  int kernel_dim = kernel_size_h * kernel_size_w;
+  // Output columns [w_begin, w_end) read no padding
+  int w_begin = std::min((pad_w + stride_w - 1) / stride_w, out_w);
+  int w_last = in_w + pad_w - (kernel_size_w - 1) * dilation - 1;
+  int w_end = w_last >= 0 ? std::min(w_last / stride_w + 1, out_w) : 0;
+  w_end = std::max(w_end, w_begin);
+
+  for (int row = begin; row < end; ++row) {
+    int h = row % out_h, cb = row / out_h % blocks;
+    int b = row / out_h / blocks;
+    T bias[B];
+    for (int l = 0; l < B; ++l) {
+      int c = cb * B + l;
+      bias[l] = bias_data != nullptr && c < out_c ? bias_data[c] : T(0);
+    }
+    int h_0 = h * stride_h - pad_h;
+    const T *in_block = in_data + (b * blocks + cb) * in_h * in_w * B;
+    const T *weight_cb = weight_data + cb * kernel_dim * B;
+    T *out_row = out_data + row * out_w * B;
+#define DEPTHWISE_BLOCKED_TILE(CHECKED)                                     \
+  depthwise_blocked_tile<T, B, CHECKED>(                                    \
+      in_block, in_h, in_w, weight_cb, bias, kernel_size_h, kernel_size_w,  \
+      dilation, h_0, w * stride_w - pad_w, activate_type, out_row + w * B)
+    int w = 0;
+    for (; w < w_begin; ++w) DEPTHWISE_BLOCKED_TILE(true);
+    for (; w < w_end; ++w) DEPTHWISE_BLOCKED_TILE(false);
+    for (; w < out_w; ++w) DEPTHWISE_BLOCKED_TILE(true);
+#undef DEPTHWISE_BLOCKED_TILE
+  }
+}
+
+SHADOW_CPU_TARGETS __attribute__((flatten))
+void conv_blocked(int begin, int end, const float *in_data,
+                  const VecInt &in_shape, int block, const float *weight_data,
+                  const float *bias_data, int kernel_size_h, int kernel_size_w,
+                  int stride_h, int stride_w, int pad_h, int pad_w,
+                  int dilation, int group, int activate_type,
+                  const VecInt &out_shape, float *panel, float *out_data) {
+#define CONV_BLOCKED_ROWS(B)                                                  \
+  if (group == 1) {                                                           \
+    conv_blocked_rows<float, B>(begin, end, in_data, in_shape, weight_data,   \
+                                bias_data, kernel_size_h, kernel_size_w,      \
+                                stride_h, stride_w, pad_h, pad_w, dilation,   \
+                                activate_type, out_shape, panel, out_data);   \
+  } else {                                                                    \
+    depthwise_blocked_rows<float, B>(                                         \
+        begin, end, in_data, in_shape, weight_data, bias_data, kernel_size_h, \
+        kernel_size_w, stride_h, stride_w, pad_h, pad_w, dilation,            \
+        activate_type, out_shape, out_data);                                  \
+  }
+  if (block == 8) {
+    CONV_BLOCKED_ROWS(8);
+  } else {
+    CONV_BLOCKED_ROWS(16);
+  }
+#undef CONV_BLOCKED_ROWS
+}
+
+int ConvBlockedTempCount(int in_c, int kernel_size_h, int kernel_size_w,
+                         int block, Context *context) {
+  int in_c_pad = conv_round_up(in_c, block);
+  int num_tasks = context->thread_pool()->num_threads();
+  return num_tasks * in_c_pad * kernel_size_h * kernel_size_w * ConvBN;
+}
+
+template <typename T>
+void ConvBlocked(const T *in_data, const VecInt &in_shape, int block,
+                 const T *blocked_weight, const T *bias_data,
+                 int kernel_size_h, int kernel_size_w, int stride_h,
+                 int stride_w, int pad_h, int pad_w, int dilation, int group,
+                 int activate_type, const VecInt &out_shape, T *temp_data,
+                 T *out_data, Context *context) {
+  CHECK(block == 8 || block == 16);
+  int batch = out_shape[0], out_h = out_shape[2];
+  if (group != 1) {
+    int out_blocks = (out_shape[1] + block - 1) / block;
+    int num_rows = batch * out_blocks * out_h;
+    context->thread_pool()->parallel_for(num_rows, [&](int begin, int end) {
+      conv_blocked(begin, end, in_data, in_shape, block, blocked_weight,
+                   bias_data, kernel_size_h, kernel_size_w, stride_h, stride_w,
+                   pad_h, pad_w, dilation, group, activate_type, out_shape,
+                   nullptr, out_data);
+    });
+    return;
+  }
+  // Every task packs its rows into its own panel
+  int num_rows = batch * out_h;
+  int num_tasks = std::min(context->thread_pool()->num_threads(), num_rows);
+  int panel_count = conv_round_up(in_shape[1], block) * kernel_size_h *
+                    kernel_size_w * ConvBN;
+  context->thread_pool()->parallel_for(num_tasks, [&](int begin, int end) {
+    for (int task = begin; task < end; ++task) {
+      conv_blocked(num_rows * task / num_tasks,
+                   num_rows * (task + 1) / num_tasks, in_data, in_shape, block,
+                   blocked_weight, bias_data, kernel_size_h, kernel_size_w,
+                   stride_h, stride_w, pad_h, pad_w, dilation, group,
+                   activate_type, out_shape, temp_data + task * panel_count,
+                   out_data);
+    }
+  });
+}
+
+template void ConvBlockedWeight(const float *, int, int, int, int, int, int,
+                                std::vector<float> *);
+template void ConvBlocked(const float *, const VecInt &, int, const float *,
+                          const float *, int, int, int, int, int, int, int, int,
+                          int, const VecInt &, float *, float *, Context *);
+
+// The panel of a tile holds the input patch of each of its QConvPC positions
+// as a contiguous row, padding reads the zero point of the input
+const int QConvPC = 64;
+
+int QuantizedConvTempCount(int kernel_dim, Context *context) {
+  return context->thread_pool()->num_threads() * QConvPC * kernel_dim;
+}
+
+void QuantizedConv(const unsigned char *in_data, const VecInt &in_shape,
+                   const signed char *weight_data, const int *offset,
+                   const float *multiplier, int kernel_size_h,
+                   int kernel_size_w, int stride_h, int stride_w, int pad_h,
+                   int pad_w, int dilation, int group, int in_zero_point,
+                   int out_zero_point, int low, int high,
+                   const VecInt &out_shape, unsigned char *temp_data,
+                   unsigned char *out_data, Context *context) {
+  int batch = in_shape[0], in_c = in_shape[1], in_h = in_shape[2],
+      in_w = in_shape[3];
+  int out_c = out_shape[1], out_h = out_shape[2], out_w = out_shape[3];
+  int in_c_g = in_c / group, out_c_g = out_c / group;
+  int kernel_dim = in_c_g * kernel_size_h * kernel_size_w;
+  int out_spatial = out_h * out_w;
+  auto zero_point = static_cast<unsigned char>(in_zero_point);
+
+  int num_tiles = (out_spatial + QConvPC - 1) / QConvPC;
+  int num_jobs = batch * group * num_tiles;
+  int num_tasks = std::min(context->thread_pool()->num_threads(), num_jobs);
+
+  context->thread_pool()->parallel_for(num_tasks, [&](int begin, int end) {
+    for (int task = begin; task < end; ++task) {
+      unsigned char *panel = temp_data + task * QConvPC * kernel_dim;
+      for (int job = task; job < num_jobs; job += num_tasks) {
+        int tile = job % num_tiles, b_g = job / num_tiles;
+        int g = b_g % group, b = b_g / group;
+        int p_begin = tile * QConvPC;
+        int pc = std::min(QConvPC, out_spatial - p_begin);
+        const unsigned char *in_g =
+            in_data + (b * in_c + g * in_c_g) * in_h * in_w;
+        for (int j = 0; j < pc; ++j) {
+          int h = (p_begin + j) / out_w, w = (p_begin + j) % out_w;
+          int h_0 = h * stride_h - pad_h, w_0 = w * stride_w - pad_w;
+          unsigned char *panel_j = panel + j * kernel_dim;
+          for (int c = 0; c < in_c_g; ++c) {
+            const unsigned char *in_c_data = in_g + c * in_h * in_w;
+            for (int kh = 0; kh < kernel_size_h; ++kh) {
+              int h_in = h_0 + kh * dilation;
+              if (!check_border(h_in, in_h)) {
+                for (int kw = 0; kw < kernel_size_w; ++kw) {
+                  *(panel_j++) = zero_point;
+                }
+                continue;
+              }
+              const unsigned char *in_row = in_c_data + h_in * in_w;
+              for (int kw = 0; kw < kernel_size_w; ++kw) {
+                int w_in = w_0 + kw * dilation;
+                *(panel_j++) = check_border(w_in, in_w) ? in_row[w_in]
+                                                        : zero_point;
+              }
+            }
+          }
+        }
+        QuantizedGemm(out_c_g, pc, kernel_dim,
+                      weight_data + g * out_c_g * kernel_dim, panel,
+                      offset + g * out_c_g, multiplier + g * out_c_g,
+                      out_zero_point, low, high,
+                      out_data + (b * out_c + g * out_c_g) * out_spatial +
+                          p_begin,
+                      out_spatial, 1);
+      }
+    }
+  });
+}
+
+// One output row of a quantized depthwise filter from the padded input rows,
+// the loop over the outputs of each tap vectorizes
+SHADOW_CPU_TARGETS __attribute__((flatten))
+void quantized_depthwise_row(const unsigned char *in_rows, int in_w,
+                             const signed char *weight, int kernel_size_h,
+                             int kernel_size_w, int stride_w, int dilation,
+                             int offset, int out_w, int *acc) {
+  for (int w = 0; w < out_w; ++w) {
+    acc[w] = offset;
+  }
+  for (int kh = 0; kh < kernel_size_h; ++kh) {
+    const unsigned char *in_row = in_rows + kh * dilation * in_w;
+    for (int kw = 0; kw < kernel_size_w; ++kw) {
+      const unsigned char *in_tap = in_row + kw * dilation;
+      int weight_val = weight[kh * kernel_size_w + kw];
+      if (stride_w == 1) {
+        for (int w = 0; w < out_w; ++w) {
+          acc[w] += in_tap[w] * weight_val;
+        }
+      } else {
+        for (int w = 0; w < out_w; ++w) {
+          acc[w] += in_tap[w * stride_w] * weight_val;
+        }
+      }
+    }
+  }
+}
+
+void QuantizedDepthwise(const unsigned char *in_data, const VecInt &in_shape,
+                        const signed char *weight_data, const int *offset,
+                        const float *multiplier, int kernel_size_h,
+                        int kernel_size_w, int stride_h, int stride_w,
+                        int pad_h, int pad_w, int dilation, int in_zero_point,
+                        int out_zero_point, int low, int high,
+                        const VecInt &out_shape, unsigned char *out_data,
+                        Context *context) {
+  int batch = in_shape[0], in_c = in_shape[1], in_h = in_shape[2],
+      in_w = in_shape[3];
+  int out_h = out_shape[2], out_w = out_shape[3];
+  int kernel_dim = kernel_size_h * kernel_size_w;
+  // The planes are padded by the zero point, which covers every tap
+  int pad_in_h = std::max(in_h + 2 * pad_h,
+                          (out_h - 1) * stride_h +
+                              (kernel_size_h - 1) * dilation + 1),
+      pad_in_w = std::max(in_w + 2 * pad_w,
+                          (out_w - 1) * stride_w +
+                              (kernel_size_w - 1) * dilation + 1);
+  context->thread_pool()->parallel_for(batch * in_c, [&](int begin, int end) {
+    std::vector<unsigned char> padded(pad_in_h * pad_in_w);
+    std::vector<int> acc(out_w);
+    for (int b_c = begin; b_c < end; ++b_c) {
+      int c = b_c % in_c;
+      const unsigned char *in_plane = in_data + b_c * in_h * in_w;
+      const signed char *weight_c = weight_data + c * kernel_dim;
+      unsigned char *out_plane = out_data + b_c * out_h * out_w;
+      std::fill(padded.begin(), padded.end(),
+                static_cast<unsigned char>(in_zero_point));
+      for (int h = 0; h < in_h; ++h) {
+        memcpy(padded.data() + (h + pad_h) * pad_in_w + pad_w,
+               in_plane + h * in_w, in_w);
+      }
+      for (int h = 0; h < out_h; ++h) {
+        quantized_depthwise_row(padded.data() + h * stride_h * pad_in_w,
+                                pad_in_w, weight_c, kernel_size_h,
+                                kernel_size_w, stride_w, dilation, offset[c],
+                                out_w, acc.data());
+        unsigned char *out_row = out_plane + h * out_w;
+        for (int w = 0; w < out_w; ++w) {
+          float val = acc[w] * multiplier[c] + out_zero_point;
+          val = std::min(std::max(val, static_cast<float>(low)),
+                         static_cast<float>(high));
+          out_row[w] = saturate_u8(val);
+        }
+      }
+    }
+  });
+}
 #endif
 
 }  // namespace Vision
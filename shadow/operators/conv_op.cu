@@ -59,7 +59,7 @@ __global__ void KernelDepthwise(const T *in_data, int count,
                                 int out_w, int kernel_size_h, int kernel_size_w,
                                 int stride_h, int stride_w, int pad_h,
                                 int pad_w, int dilation, int bias_term,
-                                T *out_data) {
+                                int activate_type, T *out_data) {
   CUDA_KERNEL_LOOP(globalid, count) {
     int w = globalid % out_w;
     int h = (globalid / out_w) % out_h;
@@ -84,6 +84,11 @@ __global__ void KernelDepthwise(const T *in_data, int count,
     if (bias_term) {
       sum_val += bias_data[c];
     }
+    if (activate_type == 1) {
+      sum_val = max(sum_val, T(0));
+    } else if (activate_type == 6) {
+      sum_val = min(max(sum_val, T(0)), T(6));
+    }
     out_data[globalid] = sum_val;
   }
 }
@@ -92,8 +97,8 @@ template <typename T>
 void Depthwise(const T *in_data, const VecInt &in_shape, const T *weight_data,
                const T *bias_data, int kernel_size_h, int kernel_size_w,
                int stride_h, int stride_w, int pad_h, int pad_w, int dilation,
-               int bias_term, const VecInt &out_shape, T *out_data,
-               Context *context) {
+               int bias_term, int activate_type, const VecInt &out_shape,
+               T *out_data, Context *context) {
   int batch = in_shape[0];
   int in_c = in_shape[1], in_h = in_shape[2], in_w = in_shape[3];
   int out_h = out_shape[2], out_w = out_shape[3];
@@ -102,13 +107,13 @@ void Depthwise(const T *in_data, const VecInt &in_shape, const T *weight_data,
                        cudaStream_t(context->cuda_stream())>>>(
       in_data, count, weight_data, bias_data, in_c, in_h, in_w, out_h, out_w,
       kernel_size_h, kernel_size_w, stride_h, stride_w, pad_h, pad_w, dilation,
-      bias_term, out_data);
+      bias_term, activate_type, out_data);
   CUDA_CHECK(cudaPeekAtLastError());
 }
 
 template void Depthwise(const float *, const VecInt &, const float *,
                         const float *, int, int, int, int, int, int, int, int,
-                        const VecInt &, float *, Context *);
+                        int, const VecInt &, float *, Context *);
 
 }  // namespace Vision
 
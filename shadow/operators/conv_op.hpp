@@ -44,8 +44,16 @@ class ConvOp : public Operator {
     CHECK_EQ(num_output_ % group_, 0);
     bias_term_ = get_single_argument<bool>("bias_term", true);
     activate_type_ = get_single_argument<int>("type", -1);
-    CHECK((activate_type_ == -1 || activate_type_ == 1))
-        << "Build in activate only support Relu";
+    CHECK((activate_type_ == -1 || activate_type_ == 1 ||
+           activate_type_ == 6))
+        << "Build in activate only support Relu and Relu6";
+    in_scale_ = get_single_argument<float>("in_scale", 1);
+    in_zero_point_ = get_single_argument<int>("in_zero_point", 0);
+    out_scale_ = get_single_argument<float>("out_scale", 1);
+    out_zero_point_ = get_single_argument<int>("out_zero_point", 0);
+    weight_scale_ = get_repeated_argument<float>("weight_scale");
+    // The block of the layout the graph optimizer assigned to the bottom
+    layout_ = get_single_argument<int>("layout", 1);
 
 #if defined(USE_CUDNN)
 #if CUDNN_VERSION_MIN(7, 0, 1)
@@ -66,6 +74,8 @@ class ConvOp : public Operator {
       }
     }
 #endif
+
+    PrepareWeight();
   }
   ~ConvOp() override {
 #if defined(USE_CUDNN)
@@ -105,6 +115,38 @@ class ConvOp : public Operator {
   bool bias_term_, use_cudnn_ = false, use_nnpack_ = false,
                    use_depthwise_ = false;
 
+  // Derives the weights of the algorithm picked for large outputs at load
+  // time, when the weights are already in the workspace
+  void PrepareWeight();
+
+  // Drops the weights derived below if the weight is not the one they were
+  // derived from
+  void CheckWeight(const Blob &weight);
+
+  enum class WeightForm { kPacked, kWinograd, kBlocked };
+
+  // Derives the weight in form, block is the Winograd tile or the channel
+  // block. Operators convolving with the same weight data, as the clones of a
+  // network do, share one derived weight
+  std::shared_ptr<const VecFloat> DeriveWeight(const Blob &weight,
+                                               WeightForm form, int block);
+
+  // Winograd tile size for the output, 0 if Winograd does not apply
+  int WinogradTile(int in_c, int out_h, int out_w) const;
+
+  std::shared_ptr<const VecFloat> packed_weight_ = nullptr,
+                                  winograd_weight_2_ = nullptr,
+                                  winograd_weight_4_ = nullptr,
+                                  blocked_weight_ = nullptr;
+  int blocked_weight_block_ = 0, layout_ = 1;
+  VecInt weight_shape_;
+  DataType weight_type_ = DataType::kF32;
+
+  float in_scale_, out_scale_;
+  int in_zero_point_, out_zero_point_;
+  VecFloat weight_scale_, quantized_multiplier_;
+  VecInt quantized_offset_;
+
 #if defined(USE_CUDNN)
   cudnnConvolutionFwdAlgo_t fwd_algo_ =
       CUDNN_CONVOLUTION_FWD_ALGO_IMPLICIT_GEMM;
@@ -141,12 +183,78 @@ void Im2Col(const T *in_data, const VecInt &in_shape, int offset,
             int pad_h, int pad_w, int dilation, int zero_point,
             const VecInt &out_shape, T *col_data, Context *context);
 
+// Packs the weights of each group as blocks of output channels for Conv
+template <typename T>
+void ConvPackedWeight(const T *weight_data, int out_c, int in_c,
+                      int kernel_size_h, int kernel_size_w, int group,
+                      std::vector<T> *packed_weight);
+
+int ConvTempCount(Context *context);
+
+template <typename T>
+void Conv(const T *in_data, const VecInt &in_shape, const T *packed_weight,
+          const T *bias_data, int kernel_size_h, int kernel_size_w,
+          int stride_h, int stride_w, int pad_h, int pad_w, int dilation,
+          int group, int activate_type, const VecInt &out_shape, T *temp_data,
+          T *out_data, Context *context);
+
+int WinogradTempCount(int in_c, int tile, Context *context);
+
+template <typename T>
+void WinogradWeight(const T *weight_data, int out_c, int in_c, int tile,
+                    std::vector<T> *winograd_weight);
+
+template <typename T>
+void Winograd(const T *in_data, const VecInt &in_shape,
+              const T *winograd_weight, const T *bias_data, int tile,
+              int pad_h, int pad_w, int activate_type, const VecInt &out_shape,
+              T *temp_data, T *out_data, Context *context);
+
 template <typename T>
 void Depthwise(const T *in_data, const VecInt &in_shape, const T *weight_data,
                const T *bias_data, int kernel_size_h, int kernel_size_w,
                int stride_h, int stride_w, int pad_h, int pad_w, int dilation,
-               int bias_term, const VecInt &out_shape, T *out_data,
-               Context *context);
+               int bias_term, int activate_type, const VecInt &out_shape,
+               T *out_data, Context *context);
+
+// Packs the weights for blocked blobs, group is 1 or the number of channels
+template <typename T>
+void ConvBlockedWeight(const T *weight_data, int out_c, int in_c,
+                       int kernel_size_h, int kernel_size_w, int group,
+                       int block, std::vector<T> *blocked_weight);
+
+int ConvBlockedTempCount(int in_c, int kernel_size_h, int kernel_size_w,
+                         int block, Context *context);
+
+template <typename T>
+void ConvBlocked(const T *in_data, const VecInt &in_shape, int block,
+                 const T *blocked_weight, const T *bias_data,
+                 int kernel_size_h, int kernel_size_w, int stride_h,
+                 int stride_w, int pad_h, int pad_w, int dilation, int group,
+                 int activate_type, const VecInt &out_shape, T *temp_data,
+                 T *out_data, Context *context);
+
+int QuantizedConvTempCount(int kernel_dim, Context *context);
+
+// Int8 convolution of unsigned char blobs, offset and multiplier come from
+// QuantizedOffset
+void QuantizedConv(const unsigned char *in_data, const VecInt &in_shape,
+                   const signed char *weight_data, const int *offset,
+                   const float *multiplier, int kernel_size_h,
+                   int kernel_size_w, int stride_h, int stride_w, int pad_h,
+                   int pad_w, int dilation, int group, int in_zero_point,
+                   int out_zero_point, int low, int high,
+                   const VecInt &out_shape, unsigned char *temp_data,
+                   unsigned char *out_data, Context *context);
+
+void QuantizedDepthwise(const unsigned char *in_data, const VecInt &in_shape,
+                        const signed char *weight_data, const int *offset,
+                        const float *multiplier, int kernel_size_h,
+                        int kernel_size_w, int stride_h, int stride_w,
+                        int pad_h, int pad_w, int dilation, int in_zero_point,
+                        int out_zero_point, int low, int high,
+                        const VecInt &out_shape, unsigned char *out_data,
+                        Context *context);
 
 }  // namespace Vision
 
@@ -85,29 +85,34 @@ template <typename T>
 void DecodeSSDBoxes(const T *mbox_loc, const T *mbox_conf,
                     const T *mbox_priorbox, int batch, int num_priors,
                     int num_classes, T *decode_box, Context *context) {
-  for (int b = 0; b < batch; ++b) {
-    auto *prior_box = mbox_priorbox;
-    auto *prior_var = mbox_priorbox + num_priors * 4;
-    for (int n = 0; n < num_priors; ++n) {
-      decode<T>(mbox_loc, prior_box, prior_var, decode_box + 2);
-
-      int max_index = -1;
-      T max_score = std::numeric_limits<T>::lowest();
-      for (int c = 0; c < num_classes; ++c) {
-        T score = mbox_conf[c];
-        if (score > max_score) {
-          max_index = c;
-          max_score = score;
+  context->thread_pool()->parallel_for(batch, [&](int begin, int end) {
+    for (int b = begin; b < end; ++b) {
+      auto *prior_box = mbox_priorbox;
+      auto *prior_var = mbox_priorbox + num_priors * 4;
+      auto *loc = mbox_loc + b * num_priors * 4;
+      auto *conf = mbox_conf + b * num_priors * num_classes;
+      auto *box = decode_box + b * num_priors * 6;
+      for (int n = 0; n < num_priors; ++n) {
+        decode<T>(loc, prior_box, prior_var, box + 2);
+
+        int max_index = -1;
+        T max_score = std::numeric_limits<T>::lowest();
+        for (int c = 0; c < num_classes; ++c) {
+          T score = conf[c];
+          if (score > max_score) {
+            max_index = c;
+            max_score = score;
+          }
         }
-      }
-      decode_box[0] = max_index;
-      decode_box[1] = max_score;
+        box[0] = max_index;
+        box[1] = max_score;
 
-      prior_box += 4, prior_var += 4;
-      mbox_loc += 4, mbox_conf += num_classes;
-      decode_box += 6;
+        prior_box += 4, prior_var += 4;
+        loc += 4, conf += num_classes;
+        box += 6;
+      }
     }
-  }
+  });
 }
 
 template void DecodeSSDBoxes(const float *, const float *, const float *, int,
@@ -120,36 +125,43 @@ void DecodeRefineDetBoxes(const T *odm_loc, const T *odm_conf,
                           int num_classes, int background_label_id,
                           float objectness_score, T *decode_box,
                           Context *context) {
-  for (int b = 0; b < batch; ++b) {
-    auto *prior_box = arm_priorbox;
-    auto *prior_var = arm_priorbox + num_priors * 4;
-    for (int n = 0; n < num_priors; ++n) {
-      decode<T>(arm_loc, prior_box, prior_var, decode_box + 2);
-      decode<T>(odm_loc, decode_box + 2, prior_var, decode_box + 2);
-
-      if (arm_conf[1] < objectness_score) {
-        decode_box[0] = background_label_id;
-        decode_box[1] = 1;
-      } else {
-        int max_index = -1;
-        T max_score = std::numeric_limits<T>::lowest();
-        for (int c = 0; c < num_classes; ++c) {
-          T score = odm_conf[c];
-          if (score > max_score) {
-            max_index = c;
-            max_score = score;
+  context->thread_pool()->parallel_for(batch, [&](int begin, int end) {
+    for (int b = begin; b < end; ++b) {
+      auto *prior_box = arm_priorbox;
+      auto *prior_var = arm_priorbox + num_priors * 4;
+      auto *o_loc = odm_loc + b * num_priors * 4;
+      auto *o_conf = odm_conf + b * num_priors * num_classes;
+      auto *a_conf = arm_conf + b * num_priors * 2;
+      auto *a_loc = arm_loc + b * num_priors * 4;
+      auto *box = decode_box + b * num_priors * 6;
+      for (int n = 0; n < num_priors; ++n) {
+        decode<T>(a_loc, prior_box, prior_var, box + 2);
+        decode<T>(o_loc, box + 2, prior_var, box + 2);
+
+        if (a_conf[1] < objectness_score) {
+          box[0] = background_label_id;
+          box[1] = 1;
+        } else {
+          int max_index = -1;
+          T max_score = std::numeric_limits<T>::lowest();
+          for (int c = 0; c < num_classes; ++c) {
+            T score = o_conf[c];
+            if (score > max_score) {
+              max_index = c;
+              max_score = score;
+            }
           }
+          box[0] = max_index;
+          box[1] = max_score;
         }
-        decode_box[0] = max_index;
-        decode_box[1] = max_score;
-      }
 
-      prior_box += 4, prior_var += 4;
-      odm_loc += 4, odm_conf += num_classes;
-      arm_conf += 2, arm_loc += 4;
-      decode_box += 6;
+        prior_box += 4, prior_var += 4;
+        o_loc += 4, o_conf += num_classes;
+        a_conf += 2, a_loc += 4;
+        box += 6;
+      }
     }
-  }
+  });
 }
 
 template void DecodeRefineDetBoxes(const float *, const float *, const float *,
@@ -72,10 +72,11 @@ void DeconvOp::Forward() {
         cudnnHandle_t(ws_->Ctx()->cudnn_handle()), filter_desc_, bottom_desc_,
         conv_desc_, top_desc_, bwd_data_algo_, &workspace_bwd_size));
 
+    TempScope temp_scope(ws_);
+
     std::shared_ptr<Blob> workspace = nullptr;
     const void *workspace_ptr = nullptr;
     if (workspace_bwd_size > 0) {
-      ws_->GrowTempBuffer(workspace_bwd_size);
       workspace = ws_->CreateTempBlob({static_cast<int>(workspace_bwd_size)},
                                       DataType::kU8);
       workspace_ptr = workspace->data<unsigned char>();
@@ -104,11 +105,7 @@ void DeconvOp::Forward() {
   }
 #endif
 
-  int temp_count = kernel_dim_ * group_ * conv_out_spatial_dim_;
-  if (bias_term_) {
-    temp_count += out_spatial_dim_;
-  }
-  ws_->GrowTempBuffer(temp_count * sizeof(float));
+  TempScope temp_scope(ws_);
   auto col_image = ws_->CreateTempBlob(
       {kernel_dim_ * group_, conv_out_spatial_dim_}, DataType::kF32);
   std::shared_ptr<Blob> biases_multiplier = nullptr;
@@ -161,26 +158,30 @@ void Col2Im(const T *col_data, const VecInt &in_shape, int offset,
   in_data += offset;
   int in_c = in_shape[1], in_h = in_shape[2], in_w = in_shape[3];
   int out_h = out_shape[2], out_w = out_shape[3];
-  int spatial_dim = in_h * in_w;
-  for (int k_c = 0; k_c < in_c; ++k_c, in_data += spatial_dim) {
-    for (int k_s = 0; k_s < kernel_size_h * kernel_size_w; ++k_s) {
-      int k_h = k_s / kernel_size_w;
-      int k_w = k_s % kernel_size_w;
-      int im_row = -pad_h + k_h * dilation;
-      for (int h = 0; h < out_h; ++h, im_row += stride_h) {
-        if (check_border(im_row, in_h)) {
-          int im_col = -pad_w + k_w * dilation;
-          for (int w = 0; w < out_w; ++w, ++col_data, im_col += stride_w) {
-            if (check_border(im_col, in_w)) {
-              in_data[im_row * in_w + im_col] += *(col_data);
+  int spatial_dim = in_h * in_w, kernel_dim = kernel_size_h * kernel_size_w;
+  context->thread_pool()->parallel_for(in_c, [&](int begin, int end) {
+    for (int k_c = begin; k_c < end; ++k_c) {
+      T *in_data_c = in_data + k_c * spatial_dim;
+      const T *col_data_c = col_data + k_c * kernel_dim * out_h * out_w;
+      for (int k_s = 0; k_s < kernel_dim; ++k_s) {
+        int k_h = k_s / kernel_size_w;
+        int k_w = k_s % kernel_size_w;
+        int im_row = -pad_h + k_h * dilation;
+        for (int h = 0; h < out_h; ++h, im_row += stride_h) {
+          if (check_border(im_row, in_h)) {
+            int im_col = -pad_w + k_w * dilation;
+            for (int w = 0; w < out_w; ++w, ++col_data_c, im_col += stride_w) {
+              if (check_border(im_col, in_w)) {
+                in_data_c[im_row * in_w + im_col] += *(col_data_c);
+              }
             }
+          } else {
+            col_data_c += out_w;
           }
-        } else {
-          col_data += out_w;
         }
       }
     }
-  }
+  });
 }
 
 template void Col2Im(const float *, const VecInt &, int, int, int, int, int,
@@ -39,11 +39,7 @@ void DeformConvOp::Forward() {
   col_offset_ = kernel_dim_ * out_spatial_dim_;
   output_offset_ = num_output_ * out_spatial_dim_ / group_;
 
-  int temp_count = kernel_dim_ * group_ * out_spatial_dim_;
-  if (bias_term_) {
-    temp_count += out_spatial_dim_;
-  }
-  ws_->GrowTempBuffer(temp_count * sizeof(float));
+  TempScope temp_scope(ws_);
   auto col_image = ws_->CreateTempBlob({kernel_dim_ * group_, out_spatial_dim_},
                                        DataType::kF32);
   std::shared_ptr<Blob> biases_multiplier = nullptr;
@@ -122,46 +118,48 @@ void DeformIm2Col(const T *in_data, const VecInt &in_shape,
   int in_c = in_shape[1], in_h = in_shape[2], in_w = in_shape[3];
   int out_h = out_shape[2], out_w = out_shape[3];
   int channel_per_deform_group = in_c / deform_group;
-  for (int c_im = 0; c_im < in_c; ++c_im) {
-    for (int h_col = 0; h_col < out_h; ++h_col) {
-      for (int w_col = 0; w_col < out_w; ++w_col) {
-        int c_col = c_im * kernel_size * kernel_size;
-        int deform_group_index = c_im / channel_per_deform_group;
-        int h_in = h_col * stride - pad;
-        int w_in = w_col * stride - pad;
-        T *data_col_ptr = out_data + (c_col * out_h + h_col) * out_w + w_col;
-        const T *data_im_ptr =
-            in_data + offset + (c_im * in_h + h_in) * in_w + w_in;
-        const T *data_offset_ptr = offset_data + deform_group_index * 2 *
-                                                     kernel_size * kernel_size *
-                                                     out_h * out_w;
-        for (int i = 0; i < kernel_size; ++i) {
-          for (int j = 0; j < kernel_size; ++j) {
-            int data_offset_h_ptr =
-                ((2 * (i * kernel_size + j)) * out_h + h_col) * out_w + w_col;
-            int data_offset_w_ptr =
-                ((2 * (i * kernel_size + j) + 1) * out_h + h_col) * out_w +
-                w_col;
-            T offset_h = data_offset_ptr[data_offset_h_ptr];
-            T offset_w = data_offset_ptr[data_offset_w_ptr];
-            auto val = static_cast<T>(zero_point);
-            T h_im = h_in + i * dilation + offset_h;
-            T w_im = w_in + j * dilation + offset_w;
-            if (h_im >= 0 && w_im >= 0 && h_im < in_h && w_im < in_w) {
-              T map_h = i * dilation + offset_h;
-              T map_w = j * dilation + offset_w;
-              int cur_height = in_h - h_in;
-              int cur_width = in_w - w_in;
-              val = deform_im2col_bilinear(data_im_ptr, in_w, cur_height,
-                                           cur_width, map_h, map_w);
+  context->thread_pool()->parallel_for(in_c, [&](int begin, int end) {
+    for (int c_im = begin; c_im < end; ++c_im) {
+      for (int h_col = 0; h_col < out_h; ++h_col) {
+        for (int w_col = 0; w_col < out_w; ++w_col) {
+          int c_col = c_im * kernel_size * kernel_size;
+          int deform_group_index = c_im / channel_per_deform_group;
+          int h_in = h_col * stride - pad;
+          int w_in = w_col * stride - pad;
+          T *data_col_ptr = out_data + (c_col * out_h + h_col) * out_w + w_col;
+          const T *data_im_ptr =
+              in_data + offset + (c_im * in_h + h_in) * in_w + w_in;
+          const T *data_offset_ptr =
+              offset_data + deform_group_index * 2 * kernel_size *
+                                kernel_size * out_h * out_w;
+          for (int i = 0; i < kernel_size; ++i) {
+            for (int j = 0; j < kernel_size; ++j) {
+              int data_offset_h_ptr =
+                  ((2 * (i * kernel_size + j)) * out_h + h_col) * out_w + w_col;
+              int data_offset_w_ptr =
+                  ((2 * (i * kernel_size + j) + 1) * out_h + h_col) * out_w +
+                  w_col;
+              T offset_h = data_offset_ptr[data_offset_h_ptr];
+              T offset_w = data_offset_ptr[data_offset_w_ptr];
+              auto val = static_cast<T>(zero_point);
+              T h_im = h_in + i * dilation + offset_h;
+              T w_im = w_in + j * dilation + offset_w;
+              if (h_im >= 0 && w_im >= 0 && h_im < in_h && w_im < in_w) {
+                T map_h = i * dilation + offset_h;
+                T map_w = j * dilation + offset_w;
+                int cur_height = in_h - h_in;
+                int cur_width = in_w - w_in;
+                val = deform_im2col_bilinear(data_im_ptr, in_w, cur_height,
+                                             cur_width, map_h, map_w);
+              }
+              *data_col_ptr = val;
+              data_col_ptr += out_h * out_w;
             }
-            *data_col_ptr = val;
-            data_col_ptr += out_h * out_w;
           }
         }
       }
     }
-  }
+  });
 }
 
 template void DeformIm2Col(const float *, const VecInt &, const float *, int,
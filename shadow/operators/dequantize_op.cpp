@@ -0,0 +1,45 @@
+#include "dequantize_op.hpp"
+
+namespace Shadow {
+
+void DequantizeOp::Forward() {
+  const auto bottom = bottoms(0);
+  auto top = tops(0);
+
+  CHECK(bottom->data_type() == DataType::kU8);
+  CHECK(top->data_type() == DataType::kF32);
+
+  top->reshape(bottom->shape());
+
+#if !defined(USE_CUDA)
+  Vision::Dequantize(bottom->data<unsigned char>(), bottom->count(), scale_,
+                     zero_point_, top->mutable_data<float>(), ws_->Ctx());
+
+#else
+  LOG(FATAL) << "Quantized operators are only supported on CPU";
+#endif
+}
+
+REGISTER_OPERATOR(Dequantize, DequantizeOp);
+
+namespace Vision {
+
+#if !defined(USE_CUDA)
+template <typename T>
+void Dequantize(const unsigned char *in_data, int count, float scale,
+                int zero_point, T *out_data, Context *context) {
+  context->thread_pool()->parallel_for(
+      count, ElementGrain, [&](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+          out_data[i] = scale * (static_cast<int>(in_data[i]) - zero_point);
+        }
+      });
+}
+
+template void Dequantize(const unsigned char *, int, float, int, float *,
+                         Context *);
+#endif
+
+}  // namespace Vision
+
+}  // namespace Shadow
@@ -0,0 +1,36 @@
+#ifndef SHADOW_OPERATORS_DEQUANTIZE_OP_HPP
+#define SHADOW_OPERATORS_DEQUANTIZE_OP_HPP
+
+#include "core/operator.hpp"
+
+namespace Shadow {
+
+// Converts an unsigned char blob holding x = scale * (q - zero_point) back to
+// float
+class DequantizeOp : public Operator {
+ public:
+  DequantizeOp(const shadow::OpParam &op_param, Workspace *ws)
+      : Operator(op_param, ws) {
+    scale_ = get_single_argument<float>("scale", 1);
+    zero_point_ = get_single_argument<int>("zero_point", 0);
+    CHECK_GT(scale_, 0);
+  }
+
+  void Forward() override;
+
+ private:
+  float scale_;
+  int zero_point_;
+};
+
+namespace Vision {
+
+template <typename T>
+void Dequantize(const unsigned char *in_data, int count, float scale,
+                int zero_point, T *out_data, Context *context);
+
+}  // namespace Vision
+
+}  // namespace Shadow
+
+#endif  // SHADOW_OPERATORS_DEQUANTIZE_OP_HPP
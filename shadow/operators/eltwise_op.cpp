@@ -1,4 +1,5 @@
 #include "eltwise_op.hpp"
+#include "quantize_op.hpp"
 
 namespace Shadow {
 
@@ -9,8 +10,9 @@ void EltwiseOp::Forward() {
   CHECK_GE(bottoms_size(), 2);
   for (int n = 1; n < bottoms_size(); ++n) {
     CHECK(bottoms(n)->shape() == bottom_0->shape());
+    CHECK(bottoms(n)->layout() == bottom_0->layout());
   }
-  top->reshape(bottom_0->shape());
+  top->reshape(bottom_0->shape(), bottom_0->layout());
 
   int coeff_size = static_cast<int>(coeff_.size());
 
@@ -24,7 +26,26 @@ void EltwiseOp::Forward() {
     coeff[n] = coeff_[n];
   }
 
-  int count = bottom_0->count();
+  int count = bottom_0->storage_count();
+
+  if (bottom_0->data_type() == DataType::kU8) {
+#if !defined(USE_CUDA)
+    CHECK_EQ(static_cast<int>(in_scale_.size()), bottoms_size());
+    CHECK_EQ(static_cast<int>(in_zero_point_.size()), bottoms_size());
+    std::vector<const unsigned char *> in_datas;
+    for (int n = 0; n < bottoms_size(); ++n) {
+      CHECK(bottoms(n)->data_type() == DataType::kU8);
+      in_datas.push_back(bottoms(n)->data<unsigned char>());
+    }
+    Vision::QuantizedEltwise(in_datas, count, operation_, coeff, in_scale_,
+                             in_zero_point_, out_scale_, out_zero_point_,
+                             top->mutable_data<unsigned char>(), ws_->Ctx());
+    return;
+
+#else
+    LOG(FATAL) << "Quantized operators are only supported on CPU";
+#endif
+  }
 
   // Prod: 0, Sum: 1, Max: 2, Min: 3
   switch (operation_) {
@@ -66,4 +87,45 @@ void EltwiseOp::Forward() {
 
 REGISTER_OPERATOR(Eltwise, EltwiseOp);
 
+namespace Vision {
+
+#if !defined(USE_CUDA)
+void QuantizedEltwise(const std::vector<const unsigned char *> &in_datas,
+                      int count, int operation, const VecFloat &coeff,
+                      const VecFloat &in_scale, const VecInt &in_zero_point,
+                      float out_scale, int out_zero_point,
+                      unsigned char *out_data, Context *context) {
+  int num_bottoms = static_cast<int>(in_datas.size());
+  float inv_scale = 1 / out_scale;
+  context->thread_pool()->parallel_for(
+      count, ElementGrain, [&](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+          float val = in_scale[0] * (in_datas[0][i] - in_zero_point[0]);
+          if (operation == 1) {
+            val *= coeff[0];
+          }
+          for (int n = 1; n < num_bottoms; ++n) {
+            float x = in_scale[n] * (in_datas[n][i] - in_zero_point[n]);
+            switch (operation) {
+              case 0:
+                val *= x;
+                break;
+              case 1:
+                val += coeff[n] * x;
+                break;
+              case 2:
+                val = std::max(val, x);
+                break;
+              default:
+                val = std::min(val, x);
+            }
+          }
+          out_data[i] = saturate_u8(val * inv_scale + out_zero_point);
+        }
+      });
+}
+#endif
+
+}  // namespace Vision
+
 }  // namespace Shadow
@@ -11,6 +11,10 @@ class EltwiseOp : public Operator {
       : Operator(op_param, ws) {
     operation_ = get_single_argument<int>("operation", 1);
     coeff_ = get_repeated_argument<float>("coeff");
+    in_scale_ = get_repeated_argument<float>("in_scale");
+    in_zero_point_ = get_repeated_argument<int>("in_zero_point");
+    out_scale_ = get_single_argument<float>("out_scale", 1);
+    out_zero_point_ = get_single_argument<int>("out_zero_point", 0);
   }
 
   void Forward() override;
@@ -19,9 +23,24 @@ class EltwiseOp : public Operator {
   enum { kProd = 0, kSum = 1, kMax = 2, kMin = 3 };
 
   int operation_;
-  VecFloat coeff_;
+  VecFloat coeff_, in_scale_;
+  VecInt in_zero_point_;
+  float out_scale_;
+  int out_zero_point_;
 };
 
+namespace Vision {
+
+// Applies operation to the dequantized values of unsigned char blobs, bottom
+// n holds in_scale[n] * (q - in_zero_point[n]), and quantizes the result
+void QuantizedEltwise(const std::vector<const unsigned char *> &in_datas,
+                      int count, int operation, const VecFloat &coeff,
+                      const VecFloat &in_scale, const VecInt &in_zero_point,
+                      float out_scale, int out_zero_point,
+                      unsigned char *out_data, Context *context);
+
+}  // namespace Vision
+
 }  // namespace Shadow
 
 #endif  // SHADOW_OPERATORS_ELTWISE_OP_HPP
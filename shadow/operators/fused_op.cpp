@@ -0,0 +1,314 @@
+#include "fused_op.hpp"
+#include "activate_op.hpp"
+#include "binary_op.hpp"
+#include "unary_op.hpp"
+
+namespace Shadow {
+
+void FusedOp::Forward() {
+  const auto bottom_0 = bottoms(0);
+  auto top = tops(0);
+
+  std::vector<VecInt> bottom_shapes;
+  for (int n = 0; n < bottoms_size(); ++n) {
+    bottom_shapes.push_back(bottoms(n)->shape());
+  }
+
+  if (bottom_shapes_ != bottom_shapes) {
+    bottom_shapes_ = bottom_shapes;
+
+    // Bottoms aligned at an axis drop their trailing axes of 1
+    auto shapes = bottom_shapes;
+    int num_axes = 0;
+    for (int n = 0; n < bottoms_size(); ++n) {
+      auto &shape = shapes[n];
+      int axis = input_axis_[n];
+      if (axis >= 0) {
+        while (shape.size() > 1 && shape.back() == 1) {
+          shape.pop_back();
+        }
+      }
+      num_axes = std::max(num_axes, std::max(axis, 0) +
+                                        static_cast<int>(shape.size()));
+    }
+
+    VecInt offsets;
+    top_shape_.assign(num_axes, 1);
+    for (int n = 0; n < bottoms_size(); ++n) {
+      const auto &shape = shapes[n];
+      int num_in_axes = static_cast<int>(shape.size());
+      int offset =
+          input_axis_[n] >= 0 ? input_axis_[n] : num_axes - num_in_axes;
+      for (int d = 0; d < num_in_axes; ++d) {
+        int &out_dim = top_shape_[offset + d];
+        CHECK(out_dim == shape[d] || out_dim == 1 || shape[d] == 1)
+            << "Can not broadcast bottom " << bottoms_name(n) << " of "
+            << name();
+        out_dim = std::max(out_dim, shape[d]);
+      }
+      offsets.push_back(offset);
+    }
+
+    int count = 1;
+    for (auto dim : top_shape_) count *= dim;
+    in_strides_.clear();
+    for (int n = 0; n < bottoms_size(); ++n) {
+      const auto &shape = shapes[n];
+      VecInt strides;
+      if (bottoms(n)->count() != count) {
+        strides.assign(num_axes, 0);
+        for (int d = static_cast<int>(shape.size()) - 1, step = 1; d >= 0;
+             --d) {
+          if (shape[d] > 1) {
+            strides[offsets[n] + d] = step;
+            step *= shape[d];
+          }
+        }
+      }
+      in_strides_.push_back(strides);
+    }
+  }
+
+  if (bottom_0->layout() != Layout::kNCHW) {
+    for (int n = 0; n < bottoms_size(); ++n) {
+      CHECK(bottoms(n)->shape() == top_shape_ &&
+            bottoms(n)->layout() == bottom_0->layout())
+          << "Blocked layouts do not support broadcasting";
+    }
+  }
+  top->reshape(top_shape_, bottom_0->layout());
+
+#if !defined(USE_CUDA)
+  std::vector<const float *> in_datas;
+  for (int n = 0; n < bottoms_size(); ++n) {
+    in_datas.push_back(bottoms(n)->data<float>());
+  }
+  Vision::FusedElementwise(in_datas, in_strides_, top_shape_, code_, imm_,
+                           top->storage_count(), top->mutable_data<float>(),
+                           ws_->Ctx());
+
+#else
+  LOG(FATAL) << "Fused operators are only supported on CPU";
+#endif
+}
+
+REGISTER_OPERATOR(Fused, FusedOp);
+
+namespace Vision {
+
+#if !defined(USE_CUDA)
+// The instructions run one by one over tiles of the output, so that the
+// registers of a tile stay in cache
+const int FusedTile = 512;
+
+#define FUSED_LOOP(expression)      \
+  for (int i = 0; i < count; ++i) { \
+    y[i] = expression;              \
+  }                                 \
+  break;
+
+SHADOW_CPU_TARGETS
+void fused_unary(int operation, const float *x, int count, float *y) {
+  switch (operation) {
+    case UnaryOp::kAbs:
+      FUSED_LOOP(std::abs(x[i]))
+    case UnaryOp::kSquare:
+      FUSED_LOOP(x[i] * x[i])
+    case UnaryOp::kSqrt:
+      FUSED_LOOP(std::sqrt(x[i]))
+    case UnaryOp::kLog:
+      FUSED_LOOP(std::log(x[i]))
+    case UnaryOp::kExp:
+      FUSED_LOOP(std::exp(x[i]))
+    case UnaryOp::kSin:
+      FUSED_LOOP(std::sin(x[i]))
+    case UnaryOp::kCos:
+      FUSED_LOOP(std::cos(x[i]))
+    case UnaryOp::kTan:
+      FUSED_LOOP(std::tan(x[i]))
+    case UnaryOp::kAsin:
+      FUSED_LOOP(std::asin(x[i]))
+    case UnaryOp::kAcos:
+      FUSED_LOOP(std::acos(x[i]))
+    case UnaryOp::kAtan:
+      FUSED_LOOP(std::atan(x[i]))
+    case UnaryOp::kFloor:
+      FUSED_LOOP(std::floor(x[i]))
+    case UnaryOp::kCeil:
+      FUSED_LOOP(std::ceil(x[i]))
+    case UnaryOp::kNeg:
+      FUSED_LOOP(-x[i])
+    case UnaryOp::kReciprocal:
+      FUSED_LOOP(1 / x[i])
+    default:
+      LOG(FATAL) << "Unknown unary operation " << operation;
+  }
+}
+
+// b is nullptr when the second operand is the scalar
+#define FUSED_BINARY_LOOP(expression)   \
+  if (b != nullptr) {                   \
+    for (int i = 0; i < count; ++i) {   \
+      float b_i = b[i];                 \
+      y[i] = expression;                \
+    }                                   \
+  } else {                              \
+    for (int i = 0; i < count; ++i) {   \
+      float b_i = scalar;               \
+      y[i] = expression;                \
+    }                                   \
+  }                                     \
+  break;
+
+SHADOW_CPU_TARGETS
+void fused_binary(int operation, const float *a, const float *b, float scalar,
+                  int count, float *y) {
+  switch (operation) {
+    case BinaryOp::kAdd:
+      FUSED_BINARY_LOOP(a[i] + b_i)
+    case BinaryOp::kSub:
+      FUSED_BINARY_LOOP(a[i] - b_i)
+    case BinaryOp::kMul:
+      FUSED_BINARY_LOOP(a[i] * b_i)
+    case BinaryOp::kDiv:
+      FUSED_BINARY_LOOP(a[i] / b_i)
+    case BinaryOp::kPow:
+      FUSED_BINARY_LOOP(std::pow(a[i], b_i))
+    case BinaryOp::kMax:
+      FUSED_BINARY_LOOP(std::max(a[i], b_i))
+    case BinaryOp::kMin:
+      FUSED_BINARY_LOOP(std::min(a[i], b_i))
+    default:
+      LOG(FATAL) << "Unknown binary operation " << operation;
+  }
+}
+#undef FUSED_BINARY_LOOP
+
+SHADOW_CPU_TARGETS
+void fused_activate(int type, const float *x, const float *slope_data,
+                    float slope, int count, float *y) {
+  switch (type) {
+    case ActivateOp::kPRelu:
+      FUSED_LOOP(x[i] > 0 ? x[i] : x[i] * slope_data[i])
+    case ActivateOp::kRelu:
+      FUSED_LOOP(x[i] > 0 ? x[i] : 0)
+    case ActivateOp::kLeaky:
+      FUSED_LOOP(x[i] > 0 ? x[i] : slope * x[i])
+    case ActivateOp::kSigmoid:
+      FUSED_LOOP(1 / (1 + std::exp(-x[i])))
+    case ActivateOp::kSoftPlus:
+      FUSED_LOOP(std::log(1 + std::exp(x[i])))
+    case ActivateOp::kTanh:
+      for (int i = 0; i < count; ++i) {
+        float exp_2x = std::exp(2 * x[i]);
+        y[i] = (exp_2x - 1) / (exp_2x + 1);
+      }
+      break;
+    case ActivateOp::kRelu6:
+      FUSED_LOOP(std::min(std::max(x[i], 0.f), 6.f))
+    default:
+      LOG(FATAL) << "Unknown activate type " << type;
+  }
+}
+#undef FUSED_LOOP
+
+// Reads count values of a broadcast bottom from the output index offset on,
+// the last axis of the bottom is either broadcast or contiguous
+inline void gather_broadcast(const float *in_data, const VecInt &strides,
+                             const VecInt &shape, int offset, int count,
+                             float *out_data) {
+  int num_axes = static_cast<int>(shape.size());
+  if (num_axes == 0) {
+    std::fill(out_data, out_data + count, in_data[0]);
+    return;
+  }
+  VecInt index(num_axes);
+  int in_offset = 0;
+  for (int d = num_axes - 1, i = offset; d >= 0; --d) {
+    index[d] = i % shape[d], i /= shape[d];
+    in_offset += index[d] * strides[d];
+  }
+  int last = num_axes - 1;
+  for (int i = 0; i < count;) {
+    int run = std::min(count - i, shape[last] - index[last]);
+    if (strides[last] == 0) {
+      std::fill(out_data + i, out_data + i + run, in_data[in_offset]);
+    } else {
+      memcpy(out_data + i, in_data + in_offset, run * sizeof(float));
+    }
+    i += run, in_offset += run * strides[last], index[last] += run;
+    for (int d = last; d > 0 && index[d] == shape[d]; --d) {
+      in_offset += strides[d - 1] - index[d] * strides[d];
+      index[d] = 0, index[d - 1]++;
+    }
+  }
+}
+
+template <typename T>
+void FusedElementwise(const std::vector<const T *> &in_datas,
+                      const std::vector<VecInt> &in_strides,
+                      const VecInt &out_shape, const VecInt &code,
+                      const VecFloat &imm, int count, T *out_data,
+                      Context *context) {
+  int num_code = static_cast<int>(code.size()) / 4;
+  int num_tiles = (count + FusedTile - 1) / FusedTile;
+  context->thread_pool()->parallel_for(num_tiles, [&](int begin, int end) {
+    std::vector<float> buffer(num_code * FusedTile);
+    std::vector<const float *> regs(num_code);
+    for (int t = begin; t < end; ++t) {
+      int offset = t * FusedTile, num = std::min(FusedTile, count - offset);
+      for (int r = 0; r < num_code; ++r) {
+        const int *inst = code.data() + 4 * r;
+        // The last instruction writes the output
+        float *dst = r == num_code - 1 ? out_data + offset
+                                       : buffer.data() + r * FusedTile;
+        regs[r] = dst;
+        switch (inst[0]) {
+          case FusedOp::kInput: {
+            const auto *in_data = in_datas[inst[1]];
+            if (!in_strides[inst[1]].empty()) {
+              gather_broadcast(in_data, in_strides[inst[1]], out_shape,
+                               offset, num, dst);
+            } else if (r == num_code - 1) {
+              memcpy(dst, in_data + offset, num * sizeof(float));
+            } else {
+              regs[r] = in_data + offset;
+            }
+            break;
+          }
+          case FusedOp::kUnary:
+            fused_unary(inst[2], regs[inst[1]], num, dst);
+            break;
+          case FusedOp::kBinary:
+            fused_binary(inst[3], regs[inst[1]], regs[inst[2]], 0, num, dst);
+            break;
+          case FusedOp::kBinaryScalar:
+            fused_binary(inst[3], regs[inst[1]], nullptr, imm[inst[2]], num,
+                         dst);
+            break;
+          case FusedOp::kActivate:
+            if (inst[2] == ActivateOp::kPRelu) {
+              fused_activate(inst[2], regs[inst[1]], regs[inst[3]], 0, num,
+                             dst);
+            } else {
+              fused_activate(inst[2], regs[inst[1]], nullptr, imm[inst[3]],
+                             num, dst);
+            }
+            break;
+          default:
+            LOG(FATAL) << "Unknown fused instruction " << inst[0];
+        }
+      }
+    }
+  });
+}
+
+template void FusedElementwise(const std::vector<const float *> &,
+                               const std::vector<VecInt> &, const VecInt &,
+                               const VecInt &, const VecFloat &, int, float *,
+                               Context *);
+#endif
+
+}  // namespace Vision
+
+}  // namespace Shadow
@@ -0,0 +1,67 @@
+#ifndef SHADOW_OPERATORS_FUSED_OP_HPP
+#define SHADOW_OPERATORS_FUSED_OP_HPP
+
+#include "core/operator.hpp"
+
+namespace Shadow {
+
+/**
+ * Evaluates a chain of elementwise operators in one pass, built by the graph
+ * optimizer. The expression is a list of instructions of four integers
+ * {opcode, a, b, c} in code, instruction i writes register i and the last
+ * register is the output:
+ *   kInput:        bottom a
+ *   kUnary:        unary operation b of register a
+ *   kBinary:       binary operation c of registers a and b
+ *   kBinaryScalar: binary operation c of register a and imm[b]
+ *   kActivate:     activation b of register a, the slope is imm[c], or
+ *                  register c for PRelu
+ * Bottoms broadcast to the output, bottom n is aligned at axis
+ * input_axis[n], or to the last axes if it is -1.
+ */
+class FusedOp : public Operator {
+ public:
+  FusedOp(const shadow::OpParam &op_param, Workspace *ws)
+      : Operator(op_param, ws) {
+    code_ = get_repeated_argument<int>("code");
+    imm_ = get_repeated_argument<float>("imm");
+    input_axis_ = get_repeated_argument<int>("input_axis");
+    CHECK_GT(code_.size(), 0);
+    CHECK_EQ(code_.size() % 4, 0);
+    CHECK_EQ(static_cast<int>(input_axis_.size()), bottoms_size());
+  }
+
+  void Forward() override;
+
+  enum {
+    kInput = 0,
+    kUnary = 1,
+    kBinary = 2,
+    kBinaryScalar = 3,
+    kActivate = 4
+  };
+
+ private:
+  VecInt code_, input_axis_;
+  VecFloat imm_;
+
+  // Strides of the bottoms along the axes of the output, empty for the
+  // bottoms of the output shape, cached for the bottom shapes
+  std::vector<VecInt> bottom_shapes_, in_strides_;
+  VecInt top_shape_;
+};
+
+namespace Vision {
+
+template <typename T>
+void FusedElementwise(const std::vector<const T *> &in_datas,
+                      const std::vector<VecInt> &in_strides,
+                      const VecInt &out_shape, const VecInt &code,
+                      const VecFloat &imm, int count, T *out_data,
+                      Context *context);
+
+}  // namespace Vision
+
+}  // namespace Shadow
+
+#endif  // SHADOW_OPERATORS_FUSED_OP_HPP
@@ -8,6 +8,8 @@ void GatherOp::Forward() {
 
   CHECK_NE(bottom, top);
 
+  TempScope temp_scope(ws_);
+
   std::shared_ptr<Blob> indexes = nullptr;
   if (indexes_value_.empty()) {
     CHECK_EQ(bottoms_size(), 2);
@@ -15,7 +17,6 @@ void GatherOp::Forward() {
     CHECK_EQ(indexes->num_axes(), 1);
   } else {
     int num_indexes = static_cast<int>(indexes_value_.size());
-    ws_->GrowTempBuffer(num_indexes * sizeof(int));
     indexes = ws_->CreateTempBlob({num_indexes}, DataType::kI32);
     indexes->set_data<int>(indexes_value_.data(), indexes->count());
   }
@@ -45,12 +46,16 @@ void Gather(const T *in_data, const int *indexes_data, int num_indexes,
             int gather_dim, int inner_num, int count, T *out_data,
             Context *context) {
   int gather_num = num_indexes * inner_num;
-  for (int i = 0; i < count; ++i) {
-    int gather_index = indexes_data[(i / inner_num) % num_indexes];
-    int in_index = (gather_index + i / gather_num * gather_dim) * inner_num +
-                   i % inner_num;
-    out_data[i] = in_data[in_index];
-  }
+  context->thread_pool()->parallel_for(
+      count, ElementGrain, [&](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+          int gather_index = indexes_data[(i / inner_num) % num_indexes];
+          int in_index =
+              (gather_index + i / gather_num * gather_dim) * inner_num +
+              i % inner_num;
+          out_data[i] = in_data[in_index];
+        }
+      });
 }
 
 template void Gather(const float *, const int *, int, int, int, int, float *,
@@ -17,9 +17,17 @@ void GroupNormOp::Forward() {
 
   CHECK_EQ(channel % group_, 0);
 
-  int temp_count =
-      2 * batch * group_ + bottom->count() + batch * channel + spatial_dim;
-  ws_->GrowTempBuffer(temp_count * sizeof(float));
+  const float *scale_data = nullptr, *bias_data = nullptr;
+  if (bottoms_size() == 3) {
+    const auto scale = bottoms(1);
+    const auto bias = bottoms(2);
+    CHECK_EQ(scale->count(), channel);
+    CHECK_EQ(bias->count(), channel);
+    scale_data = scale->data<float>(), bias_data = bias->data<float>();
+  }
+
+#if defined(USE_CUDA)
+  TempScope temp_scope(ws_);
 
   auto mean = ws_->CreateTempBlob({batch, group_}, DataType::kF32);
   auto variance = ws_->CreateTempBlob({batch, group_}, DataType::kF32);
@@ -55,15 +63,17 @@ void GroupNormOp::Forward() {
                          channel, spatial_dim, group_, eps_,
                          top->mutable_data<float>(), ws_->Ctx());
 
-  if (bottoms_size() == 3) {
-    const auto scale = bottoms(1);
-    const auto bias = bottoms(2);
-    CHECK_EQ(scale->count(), channel);
-    CHECK_EQ(bias->count(), channel);
-    Vision::Scale(top->data<float>(), top->count(), scale->data<float>(),
-                  bias->data<float>(), channel, spatial_dim,
-                  top->mutable_data<float>(), ws_->Ctx());
+  if (scale_data != nullptr) {
+    Vision::Scale(top->data<float>(), top->count(), scale_data, bias_data,
+                  channel, spatial_dim, top->mutable_data<float>(),
+                  ws_->Ctx());
   }
+
+#else
+  Vision::GroupNorm(bottom->data<float>(), batch, channel, spatial_dim, group_,
+                    eps_, scale_data, bias_data, top->mutable_data<float>(),
+                    ws_->Ctx());
+#endif
 }
 
 REGISTER_OPERATOR(GroupNorm, GroupNormOp);
@@ -71,55 +81,83 @@ REGISTER_OPERATOR(GroupNorm, GroupNormOp);
 namespace Vision {
 
 #if !defined(USE_CUDA)
-template <typename T>
-void ComputeGroup(const T *in_data, int batch, int channel, int group,
-                  T *out_data, Context *context) {
-  int num_val = channel / group;
-  for (int b = 0; b < batch; ++b) {
-    for (int g = 0; g < group; ++g) {
-      T sum = T(0);
-      for (int n = 0; n < num_val; ++n, in_data++) {
-        sum += *in_data;
-      }
-      *out_data++ = sum / num_val;
+// Sums over 16 partial results
+const int NormLanes = 16;
+
+// Sum and sum of squares of in_data - shift, shifting by a value close to the
+// mean keeps the squares from cancelling
+SHADOW_CPU_TARGETS
+void shifted_sums(const float *in_data, int count, float shift, float *sum,
+                  float *square_sum) {
+  float lanes[NormLanes] = {0}, square_lanes[NormLanes] = {0};
+  int i = 0;
+  for (; i + NormLanes <= count; i += NormLanes) {
+    for (int l = 0; l < NormLanes; ++l) {
+      float diff = in_data[i + l] - shift;
+      lanes[l] += diff, square_lanes[l] += diff * diff;
     }
   }
+  float s = 0, square_s = 0;
+  for (; i < count; ++i) {
+    float diff = in_data[i] - shift;
+    s += diff, square_s += diff * diff;
+  }
+  for (int l = 0; l < NormLanes; ++l) {
+    s += lanes[l], square_s += square_lanes[l];
+  }
+  *sum = s, *square_sum = square_s;
 }
 
-template <typename T>
-void SubtractMean(const T *in_data, const T *mean_data, int batch, int channel,
-                  int spatial_dim, int group, T *out_data, Context *context) {
-  int num_val = channel / group;
-  for (int b = 0; b < batch; ++b, mean_data += group) {
-    for (int c = 0; c < channel; ++c) {
-      T mean = mean_data[c / num_val];
-      for (int n = 0; n < spatial_dim; ++n) {
-        *out_data++ = *in_data++ - mean;
-      }
-    }
+SHADOW_CPU_TARGETS
+void affine_row(const float *in_data, int count, float scale, float bias,
+                float *out_data) {
+  for (int i = 0; i < count; ++i) {
+    out_data[i] = in_data[i] * scale + bias;
   }
 }
 
 template <typename T>
-void DivideVariance(const T *in_data, const T *variance_data, int batch,
-                    int channel, int spatial_dim, int group, float eps,
-                    T *out_data, Context *context) {
-  int num_val = channel / group;
-  for (int b = 0; b < batch; ++b, variance_data += group) {
-    for (int c = 0; c < channel; ++c) {
-      T variance = variance_data[c / num_val];
-      for (int n = 0; n < spatial_dim; ++n) {
-        *out_data++ = *in_data++ / std::sqrt(variance + eps);
+void GroupNorm(const T *in_data, int batch, int channel, int spatial_dim,
+               int group, float eps, const T *scale_data, const T *bias_data,
+               T *out_data, Context *context) {
+  if (spatial_dim == 0) return;
+  int num_val = channel / group, group_dim = num_val * spatial_dim;
+  context->thread_pool()->parallel_for(batch * group, [&](int begin, int end) {
+    for (int b_g = begin; b_g < end; ++b_g) {
+      const T *in_group = in_data + b_g * group_dim;
+      T *out_group = out_data + b_g * group_dim;
+      // The mean and the squared deviations of the channels are merged one
+      // channel at a time by the parallel form of Welford's algorithm
+      double mean = 0, square_dev = 0;
+      for (int c = 0; c < num_val; ++c) {
+        const T *in_c = in_group + c * spatial_dim;
+        float sum, square_sum;
+        shifted_sums(in_c, spatial_dim, in_c[0], &sum, &square_sum);
+        double mean_c = in_c[0] + static_cast<double>(sum) / spatial_dim;
+        double square_dev_c = std::max(
+            square_sum - static_cast<double>(sum) * sum / spatial_dim, 0.);
+        double delta = mean_c - mean;
+        mean += delta / (c + 1);
+        square_dev += square_dev_c + delta * delta * c * spatial_dim / (c + 1);
+      }
+      auto variance = static_cast<float>(square_dev / group_dim);
+      float inv_std = 1 / std::sqrt(variance + eps);
+      for (int c = 0; c < num_val; ++c) {
+        int ch = b_g % group * num_val + c;
+        float scale = inv_std, bias = 0;
+        if (scale_data != nullptr) {
+          scale *= scale_data[ch], bias = bias_data[ch];
+        }
+        affine_row(in_group + c * spatial_dim, spatial_dim, scale,
+                   static_cast<float>(bias - mean * scale),
+                   out_group + c * spatial_dim);
       }
     }
-  }
+  });
 }
 
-template void ComputeGroup(const float *, int, int, int, float *, Context *);
-template void SubtractMean(const float *, const float *, int, int, int, int,
-                           float *, Context *);
-template void DivideVariance(const float *, const float *, int, int, int, int,
-                             float, float *, Context *);
+template void GroupNorm(const float *, int, int, int, int, float,
+                        const float *, const float *, float *, Context *);
 #endif
 
 }  // namespace Vision
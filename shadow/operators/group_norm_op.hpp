@@ -22,6 +22,14 @@ class GroupNormOp : public Operator {
 
 namespace Vision {
 
+// Normalizes each group of channel / group channels by its mean and variance
+// and applies the channel wise scale and bias if they are not nullptr, the
+// statistics are computed in one read and the output in one write
+template <typename T>
+void GroupNorm(const T* in_data, int batch, int channel, int spatial_dim,
+               int group, float eps, const T* scale_data, const T* bias_data,
+               T* out_data, Context* context);
+
 template <typename T>
 void ComputeGroup(const T* in_data, int batch, int channel, int group,
                   T* out_data, Context* context);
@@ -1,5 +1,6 @@
 #include "instance_norm_op.hpp"
 
+#include "group_norm_op.hpp"
 #include "scale_op.hpp"
 
 namespace Shadow {
@@ -20,7 +21,7 @@ void InstanceNormOp::Forward() {
                                 spatial_dim, 1);
   cudnn::setTensor4dDesc<float>(&param_desc_, 1, batch * channel, 1, 1);
 
-  ws_->GrowTempBuffer(2 * batch * channel * sizeof(float));
+  TempScope temp_scope(ws_);
 
   auto scale_cudnn = ws_->CreateTempBlob({1, batch * channel}, DataType::kF32);
   auto bias_cudnn = ws_->CreateTempBlob({1, batch * channel}, DataType::kF32);
@@ -53,14 +54,13 @@ void InstanceNormOp::Forward() {
       top->mutable_data<float>(), param_desc_, scale_cudnn->data<float>(),
       bias_cudnn->data<float>(), 1., nullptr, nullptr, eps, nullptr, nullptr));
 
-#else
+#elif defined(USE_CUDA)
   if (bottom != top) {
     Blas::BlasScopy(bottom->count(), bottom->data<float>(), 0,
                     top->mutable_data<float>(), 0, ws_->Ctx());
   }
 
-  int temp_count = batch * channel + bottom->count() + spatial_dim;
-  ws_->GrowTempBuffer(temp_count * sizeof(float));
+  TempScope temp_scope(ws_);
 
   auto stats = ws_->CreateTempBlob({batch, channel}, DataType::kF32);
   auto temp = ws_->CreateTempBlob(bottom->shape(), DataType::kF32);
@@ -103,6 +103,20 @@ void InstanceNormOp::Forward() {
                   bias->data<float>(), channel, spatial_dim,
                   top->mutable_data<float>(), ws_->Ctx());
   }
+
+#else
+  const float *scale_data = nullptr, *bias_data = nullptr;
+  if (bottoms_size() == 3) {
+    const auto scale = bottoms(1);
+    const auto bias = bottoms(2);
+    CHECK_EQ(scale->count(), channel);
+    CHECK_EQ(bias->count(), channel);
+    scale_data = scale->data<float>(), bias_data = bias->data<float>();
+  }
+  // Instance normalization is group normalization of one channel per group
+  Vision::GroupNorm(bottom->data<float>(), batch, channel, spatial_dim,
+                    channel, eps_, scale_data, bias_data,
+                    top->mutable_data<float>(), ws_->Ctx());
 #endif
 }
 
@@ -1,5 +1,7 @@
 #include "matmul_op.hpp"
 
+#include "cast_op.hpp"
+
 namespace Shadow {
 
 void MatMulOp::Forward() {
@@ -45,6 +47,38 @@ void MatMulOp::Forward() {
   int inner_num_a = num_axes_a >= num_axes_b ? (rows_a * cols_a) : 0;
   int inner_num_b = num_axes_a <= num_axes_b ? (rows_b * cols_b) : 0;
 
+  const auto b_type = bottom_b->data_type();
+  if (b_type == DataType::kF16 || b_type == DataType::kBF16) {
+#if !defined(USE_CUDA)
+    CHECK(!transpose_a_) << "Half and bfloat16 B needs A not transposed";
+    TempScope temp_scope(ws_);
+    int temp_count = Vision::MatMulReducedTempCount(M, N, K);
+    std::shared_ptr<Blob> reduced_temp = nullptr;
+    if (temp_count > 0) {
+      reduced_temp = ws_->CreateTempBlob({temp_count}, DataType::kF32);
+    }
+    auto *temp_data =
+        temp_count > 0 ? reduced_temp->mutable_data<float>() : nullptr;
+    for (int n = 0; n < outer_num; ++n) {
+      const auto *a = bottom_a->data<float>() + n * inner_num_a;
+      auto *c = top->mutable_data<float>() + n * inner_num;
+      if (b_type == DataType::kF16) {
+        Vision::MatMulReduced(transpose_b_, M, N, K, a,
+                              bottom_b->data<Half>() + n * inner_num_b,
+                              temp_data, c, ws_->Ctx());
+      } else {
+        Vision::MatMulReduced(transpose_b_, M, N, K, a,
+                              bottom_b->data<BFloat16>() + n * inner_num_b,
+                              temp_data, c, ws_->Ctx());
+      }
+    }
+    return;
+
+#else
+    LOG(FATAL) << "Half and bfloat16 operators are only supported on CPU";
+#endif
+  }
+
   for (int n = 0; n < outer_num; ++n) {
     Blas::BlasSgemm(transpose_a_, transpose_b_, M, N, K, 1,
                     bottom_a->data<float>(), n * inner_num_a,
@@ -55,4 +89,91 @@ void MatMulOp::Forward() {
 
 REGISTER_OPERATOR(MatMul, MatMulOp);
 
+namespace Vision {
+
+#if !defined(USE_CUDA)
+// Up to MatMulReducedMaxM rows of A stream B, MatMulReducedNB columns of C
+// share one widened panel when B is not transposed
+const int MatMulReducedMaxM = 8, MatMulReducedNB = 256;
+
+SHADOW_CPU_TARGETS
+float dot_row(const float *a, const float *b, int K) {
+  // Sixteen partial sums fill one AVX512 or two AVX2 registers
+  float sums[16] = {};
+  int k = 0;
+  for (; k + 16 <= K; k += 16) {
+    for (int i = 0; i < 16; ++i) {
+      sums[i] += a[k + i] * b[k + i];
+    }
+  }
+  float sum = 0;
+  for (int i = 0; i < 16; ++i) {
+    sum += sums[i];
+  }
+  for (; k < K; ++k) {
+    sum += a[k] * b[k];
+  }
+  return sum;
+}
+
+SHADOW_CPU_TARGETS
+void axpy_row(float alpha, const float *x, int count, float *y) {
+  for (int n = 0; n < count; ++n) {
+    y[n] += alpha * x[n];
+  }
+}
+
+int MatMulReducedTempCount(int M, int N, int K) {
+  return M > MatMulReducedMaxM ? N * K : 0;
+}
+
+template <typename T>
+void MatMulReduced(int transpose_b, int M, int N, int K, const float *a,
+                   const T *b, float *temp_data, float *c, Context *context) {
+  if (M > MatMulReducedMaxM) {
+    CHECK_NOTNULL(temp_data);
+    Cast(b, N * K, temp_data, context);
+    Blas::BlasSgemm(0, transpose_b, M, N, K, 1, a, 0, temp_data, 0, 0, c, 0,
+                    context);
+    return;
+  }
+  if (transpose_b) {
+    context->thread_pool()->parallel_for(N, [&](int begin, int end) {
+      std::vector<float> b_row(K);
+      for (int n = begin; n < end; ++n) {
+        CastRow(b + n * K, K, b_row.data());
+        for (int m = 0; m < M; ++m) {
+          c[m * N + n] = dot_row(a + m * K, b_row.data(), K);
+        }
+      }
+    });
+  } else {
+    int num_blocks = (N + MatMulReducedNB - 1) / MatMulReducedNB;
+    context->thread_pool()->parallel_for(num_blocks, [&](int begin, int end) {
+      float b_row[MatMulReducedNB];
+      for (int block = begin; block < end; ++block) {
+        int n_0 = block * MatMulReducedNB;
+        int num_n = std::min(MatMulReducedNB, N - n_0);
+        for (int m = 0; m < M; ++m) {
+          std::fill(c + m * N + n_0, c + m * N + n_0 + num_n, 0.f);
+        }
+        for (int k = 0; k < K; ++k) {
+          CastRow(b + k * N + n_0, num_n, b_row);
+          for (int m = 0; m < M; ++m) {
+            axpy_row(a[m * K + k], b_row, num_n, c + m * N + n_0);
+          }
+        }
+      }
+    });
+  }
+}
+
+template void MatMulReduced(int, int, int, int, const float *, const Half *,
+                            float *, float *, Context *);
+template void MatMulReduced(int, int, int, int, const float *,
+                            const BFloat16 *, float *, float *, Context *);
+#endif
+
+}  // namespace Vision
+
 }  // namespace Shadow
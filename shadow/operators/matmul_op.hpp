@@ -19,6 +19,21 @@ class MatMulOp : public Operator {
   bool transpose_a_, transpose_b_;
 };
 
+namespace Vision {
+
+// Number of floats the temp of MatMulReduced needs, zero for small M
+int MatMulReducedTempCount(int M, int N, int K);
+
+// C = A * op(B) with B in half or bfloat16 and the sums in float, A is M x K
+// and C is M x N, op(B) transposes B of N x K if transpose_b. For small M the
+// rows of B are widened on the fly so that B is read once at half the
+// bandwidth, otherwise B is widened into temp_data for a float GEMM
+template <typename T>
+void MatMulReduced(int transpose_b, int M, int N, int K, const float *a,
+                   const T *b, float *temp_data, float *c, Context *context);
+
+}  // namespace Vision
+
 }  // namespace Shadow
 
 #endif  // SHADOW_OPERATORS_MATMUL_OP_HPP
@@ -12,15 +12,7 @@ void NormalizeOp::Forward() {
 
   top->reshape(bottom->shape());
 
-  int temp_count = in_c * spatial_dim;
-  if (!across_spatial_) {
-    temp_count += spatial_dim;
-    temp_count += in_c;
-  }
-  if (!channel_shared_ && bottoms_size() > 1) {
-    temp_count += spatial_dim;
-  }
-  ws_->GrowTempBuffer(temp_count * sizeof(float));
+  TempScope temp_scope(ws_);
 
   std::shared_ptr<Blob> norm = nullptr, sum_channel_multiplier = nullptr;
   if (!across_spatial_) {
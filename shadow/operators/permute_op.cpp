@@ -2,6 +2,45 @@
 
 namespace Shadow {
 
+// Drops the axes of size 1 and merges the input axes that stay adjacent in
+// the output, so that NCHW to NHWC becomes a batch of 2D transposes
+inline void collapse_permute(const VecInt &shape, const VecInt &order,
+                             VecInt *merged_shape, VecInt *merged_order) {
+  int num_axes = static_cast<int>(shape.size());
+  VecInt kept_index(num_axes, -1);
+  int num_kept = 0;
+  for (int d = 0; d < num_axes; ++d) {
+    if (shape[d] > 1) {
+      kept_index[d] = num_kept++;
+    }
+  }
+  // Runs of output axes reading consecutive input axes, by the first of them
+  VecInt run_first, run_size;
+  int last = -2;
+  for (int j = 0; j < num_axes; ++j) {
+    int index = kept_index[order[j]];
+    if (index < 0) continue;
+    if (index == last + 1) {
+      run_size.back() *= shape[order[j]];
+    } else {
+      run_first.push_back(index);
+      run_size.push_back(shape[order[j]]);
+    }
+    last = index;
+  }
+  int num_runs = static_cast<int>(run_first.size());
+  merged_shape->assign(num_runs, 1);
+  merged_order->assign(num_runs, 0);
+  for (int j = 0; j < num_runs; ++j) {
+    int rank = 0;
+    for (int i = 0; i < num_runs; ++i) {
+      rank += run_first[i] < run_first[j];
+    }
+    (*merged_shape)[rank] = run_size[j];
+    (*merged_order)[j] = rank;
+  }
+}
+
 void PermuteOp::Forward() {
   const auto bottom = bottoms(0);
   auto top = tops(0);
@@ -11,36 +50,65 @@ void PermuteOp::Forward() {
   int num_axes = static_cast<int>(permute_order_value_.size());
   CHECK_EQ(num_axes, bottom->num_axes());
 
-  VecInt top_shape, old_steps_value(num_axes), new_steps_value(num_axes);
-  for (const auto &order : permute_order_value_) {
-    top_shape.push_back(bottom->shape(order));
-  }
-  top->reshape(top_shape);
+  if (bottom_shape_ != bottom->shape()) {
+    bottom_shape_ = bottom->shape();
 
-  for (int d = 0; d < num_axes; ++d) {
-    if (d == num_axes - 1) {
-      old_steps_value[d] = 1;
-      new_steps_value[d] = 1;
-    } else {
-      old_steps_value[d] = bottom->count(d + 1);
-      new_steps_value[d] = top->count(d + 1);
+    top_shape_.clear();
+    for (const auto &order : permute_order_value_) {
+      top_shape_.push_back(bottom->shape(order));
+    }
+
+    VecInt merged_shape;
+    collapse_permute(bottom_shape_, permute_order_value_, &merged_shape,
+                     &order_);
+    int num_merged = static_cast<int>(order_.size());
+    old_steps_.assign(num_merged, 1), new_steps_.assign(num_merged, 1);
+    for (int d = num_merged - 2; d >= 0; --d) {
+      old_steps_[d] = old_steps_[d + 1] * merged_shape[d + 1];
+      new_steps_[d] = new_steps_[d + 1] * merged_shape[order_[d + 1]];
     }
   }
+  top->reshape(top_shape_);
 
-  ws_->GrowTempBuffer(3 * num_axes * sizeof(int));
+  int count = bottom->count(), num_merged = static_cast<int>(order_.size());
 
-  auto permute_order = ws_->CreateTempBlob({num_axes}, DataType::kI32);
-  auto old_steps = ws_->CreateTempBlob({num_axes}, DataType::kI32);
-  auto new_steps = ws_->CreateTempBlob({num_axes}, DataType::kI32);
+  if (num_merged <= 1) {
+    Blas::BlasScopy(count, bottom->data<float>(), 0,
+                    top->mutable_data<float>(), 0, ws_->Ctx());
+    return;
+  }
+
+#if defined(USE_CUDA)
+  TempScope temp_scope(ws_);
+
+  auto permute_order = ws_->CreateTempBlob({num_merged}, DataType::kI32);
+  auto old_steps = ws_->CreateTempBlob({num_merged}, DataType::kI32);
+  auto new_steps = ws_->CreateTempBlob({num_merged}, DataType::kI32);
 
-  permute_order->set_data<int>(permute_order_value_.data(), num_axes);
-  old_steps->set_data<int>(old_steps_value.data(), num_axes);
-  new_steps->set_data<int>(new_steps_value.data(), num_axes);
+  permute_order->set_data<int>(order_.data(), num_merged);
+  old_steps->set_data<int>(old_steps_.data(), num_merged);
+  new_steps->set_data<int>(new_steps_.data(), num_merged);
 
-  Vision::Permute(bottom->data<float>(), bottom->count(), bottom->num_axes(),
+  Vision::Permute(bottom->data<float>(), count, num_merged,
                   permute_order->data<int>(), old_steps->data<int>(),
                   new_steps->data<int>(), top->mutable_data<float>(),
                   ws_->Ctx());
+
+#else
+  if (num_merged == 2) {
+    Vision::BatchTranspose(bottom->data<float>(), 1, new_steps_[0],
+                           old_steps_[0], top->mutable_data<float>(),
+                           ws_->Ctx());
+  } else if (num_merged == 3 && order_[0] == 0) {
+    Vision::BatchTranspose(bottom->data<float>(), count / old_steps_[0],
+                           old_steps_[0] / old_steps_[1], old_steps_[1],
+                           top->mutable_data<float>(), ws_->Ctx());
+  } else {
+    Vision::Permute(bottom->data<float>(), count, num_merged, order_.data(),
+                    old_steps_.data(), new_steps_.data(),
+                    top->mutable_data<float>(), ws_->Ctx());
+  }
+#endif
 }
 
 REGISTER_OPERATOR(Permute, PermuteOp);
@@ -48,20 +116,106 @@ REGISTER_OPERATOR(Permute, PermuteOp);
 namespace Vision {
 
 #if !defined(USE_CUDA)
+// Tiles of PermuteTile x PermuteTile are transposed by blocks of 8 x 8, so
+// that both the rows read and the rows written stay in cache
+const int PermuteTile = 32;
+
+inline void transpose_8x8(const float *in_data, int ld_in, float *out_data,
+                          int ld_out) {
+  float block[8][8];
+  for (int r = 0; r < 8; ++r) {
+    for (int c = 0; c < 8; ++c) {
+      block[c][r] = in_data[r * ld_in + c];
+    }
+  }
+  for (int c = 0; c < 8; ++c) {
+    for (int r = 0; r < 8; ++r) {
+      out_data[c * ld_out + r] = block[c][r];
+    }
+  }
+}
+
+// Transposes rows [row_begin, row_end) of a rows x cols matrix
+SHADOW_CPU_TARGETS
+void transpose_rows(const float *in_data, int rows, int cols, int row_begin,
+                    int row_end, float *out_data) {
+  for (int c_0 = 0; c_0 < cols; c_0 += PermuteTile) {
+    int c_end = std::min(c_0 + PermuteTile, cols);
+    int r = row_begin;
+    for (; r + 8 <= row_end; r += 8) {
+      int c = c_0;
+      for (; c + 8 <= c_end; c += 8) {
+        transpose_8x8(in_data + r * cols + c, cols, out_data + c * rows + r,
+                      rows);
+      }
+      for (; c < c_end; ++c) {
+        for (int i = 0; i < 8; ++i) {
+          out_data[c * rows + r + i] = in_data[(r + i) * cols + c];
+        }
+      }
+    }
+    for (; r < row_end; ++r) {
+      for (int c = c_0; c < c_end; ++c) {
+        out_data[c * rows + r] = in_data[r * cols + c];
+      }
+    }
+  }
+}
+
+template <typename T>
+void BatchTranspose(const T *in_data, int batch, int rows, int cols,
+                    T *out_data, Context *context) {
+  int num_tiles = (rows + PermuteTile - 1) / PermuteTile;
+  context->thread_pool()->parallel_for(
+      batch * num_tiles, [&](int begin, int end) {
+        for (int t = begin; t < end; ++t) {
+          int b = t / num_tiles, r_0 = (t % num_tiles) * PermuteTile;
+          int offset = b * rows * cols;
+          transpose_rows(in_data + offset, rows, cols, r_0,
+                         std::min(r_0 + PermuteTile, rows),
+                         out_data + offset);
+        }
+      });
+}
+
+template void BatchTranspose(const float *, int, int, int, float *,
+                             Context *);
+
 template <typename T>
 void Permute(const T *in_data, int count, int num_axes,
              const int *permute_order, const int *old_steps,
              const int *new_steps, T *out_data, Context *context) {
-  for (int i = 0; i < count; ++i) {
-    int old_idx = 0;
-    int idx = i;
-    for (int j = 0; j < num_axes; ++j) {
-      int order = permute_order[j];
-      old_idx += (idx / new_steps[j]) * old_steps[order];
-      idx %= new_steps[j];
-    }
-    out_data[i] = in_data[old_idx];
+  if (count == 0) return;
+  // Shape of the output and the input stride along each output axis
+  VecInt shape(num_axes), strides(num_axes);
+  for (int j = 0; j < num_axes; ++j) {
+    shape[j] = (j == 0 ? count : new_steps[j - 1]) / new_steps[j];
+    strides[j] = old_steps[permute_order[j]];
   }
+  // A last axis that stays contiguous is copied in runs, the other axes step
+  // an index incrementally instead of dividing for every element
+  int run = strides[num_axes - 1] == 1 ? shape[num_axes - 1] : 1;
+  int num_index = run > 1 ? num_axes - 1 : num_axes;
+  context->thread_pool()->parallel_for(count / run, [&](int begin, int end) {
+    VecInt index(num_index);
+    int offset = 0;
+    for (int j = num_index - 1, i = begin; j >= 0; --j) {
+      index[j] = i % shape[j], i /= shape[j];
+      offset += index[j] * strides[j];
+    }
+    for (int i = begin; i < end; ++i) {
+      if (run > 1) {
+        memcpy(out_data + i * run, in_data + offset, run * sizeof(T));
+      } else {
+        out_data[i] = in_data[offset];
+      }
+      for (int j = num_index - 1; j >= 0; --j) {
+        offset += strides[j];
+        if (++index[j] < shape[j]) break;
+        offset -= strides[j] * shape[j], index[j] = 0;
+      }
+    }
+  });
 }
 
 template void Permute(const float *, int, int, const int *, const int *,
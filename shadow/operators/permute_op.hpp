@@ -15,11 +15,19 @@ class PermuteOp : public Operator {
   void Forward() override;
 
  private:
-  VecInt permute_order_value_;
+  VecInt permute_order_value_, bottom_shape_, top_shape_;
+  // The plan of the cached bottom shape, axes of size 1 are dropped and axes
+  // that stay adjacent are merged
+  VecInt order_, old_steps_, new_steps_;
 };
 
 namespace Vision {
 
+// Transposes batch matrices of rows x cols into batch matrices of cols x rows
+template <typename T>
+void BatchTranspose(const T *in_data, int batch, int rows, int cols,
+                    T *out_data, Context *context);
+
 template <typename T>
 void Permute(const T *in_data, int count, int num_axes,
              const int *permute_order, const int *old_steps,
@@ -1,4 +1,5 @@
 #include "pooling_op.hpp"
+#include "quantize_op.hpp"
 
 namespace Shadow {
 
@@ -31,7 +32,33 @@ void PoolingOp::Forward() {
   auto top_shape = bottom->shape();
   top_shape[2] = out_h;
   top_shape[3] = out_w;
-  top->reshape(top_shape);
+  top->reshape(top_shape, bottom->layout());
+
+  if (bottom->data_type() == DataType::kU8) {
+#if !defined(USE_CUDA)
+    CHECK(bottom->layout() == Layout::kNCHW);
+    Vision::QuantizedPooling(
+        bottom->data<unsigned char>(), bottom->shape(), kernel_size_h_,
+        kernel_size_w_, stride_h_, stride_w_, pad_h_, pad_w_, pool_type_,
+        in_zero_point_, in_scale_ / out_scale_, out_zero_point_, top->shape(),
+        top->mutable_data<unsigned char>(), ws_->Ctx());
+    return;
+
+#else
+    LOG(FATAL) << "Quantized operators are only supported on CPU";
+#endif
+  }
+
+#if !defined(USE_CUDA)
+  if (bottom->layout() != Layout::kNCHW) {
+    Vision::PoolingBlocked(bottom->data<float>(), bottom->shape(),
+                           bottom->block(), kernel_size_h_, kernel_size_w_,
+                           stride_h_, stride_w_, pad_h_, pad_w_, pool_type_,
+                           top->shape(), top->mutable_data<float>(),
+                           ws_->Ctx());
+    return;
+  }
+#endif
 
 #if defined(USE_CUDNN)
   cudnn::setPooling2dDesc<float>(&pooling_desc_, pool_type_, kernel_size_h_,
@@ -58,6 +85,168 @@ REGISTER_OPERATOR(Pooling, PoolingOp);
 namespace Vision {
 
 #if !defined(USE_CUDA)
+// Combines one input row into the accumulators of the outputs [begin, end),
+// whose windows lie inside the row after the left padding. K and S of 0 take
+// the kernel size and the stride at run time
+template <bool Max, int K, int S>
+inline void pool_row(const float *in_row, int kernel_w, int stride_w,
+                     int pad_w, int begin, int end, float *acc) {
+  if (K > 0) kernel_w = K;
+  if (S > 0) stride_w = S;
+  for (int w = begin; w < end; ++w) {
+    const float *in_val = in_row + w * stride_w - pad_w;
+    float val = in_val[0];
+    for (int kj = 1; kj < kernel_w; ++kj) {
+      if (Max) {
+        val = in_val[kj] > val ? in_val[kj] : val;
+      } else {
+        val += in_val[kj];
+      }
+    }
+    if (Max) {
+      acc[w] = val > acc[w] ? val : acc[w];
+    } else {
+      acc[w] += val;
+    }
+  }
+}
+
+template <bool Max>
+inline void pool_row_dispatch(const float *in_row, int kernel_w, int stride_w,
+                              int pad_w, int begin, int end, float *acc) {
+  if (kernel_w == 2 && stride_w == 2) {
+    pool_row<Max, 2, 2>(in_row, kernel_w, stride_w, pad_w, begin, end, acc);
+  } else if (kernel_w == 3 && stride_w == 2) {
+    pool_row<Max, 3, 2>(in_row, kernel_w, stride_w, pad_w, begin, end, acc);
+  } else if (kernel_w == 3 && stride_w == 1) {
+    pool_row<Max, 3, 1>(in_row, kernel_w, stride_w, pad_w, begin, end, acc);
+  } else {
+    pool_row<Max, 0, 0>(in_row, kernel_w, stride_w, pad_w, begin, end, acc);
+  }
+}
+
+SHADOW_CPU_TARGETS
+void max_pool_row(const float *in_row, int kernel_w, int stride_w, int pad_w,
+                  int begin, int end, float *acc) {
+  pool_row_dispatch<true>(in_row, kernel_w, stride_w, pad_w, begin, end, acc);
+}
+
+SHADOW_CPU_TARGETS
+void sum_pool_row(const float *in_row, int kernel_w, int stride_w, int pad_w,
+                  int begin, int end, float *acc) {
+  pool_row_dispatch<false>(in_row, kernel_w, stride_w, pad_w, begin, end, acc);
+}
+
+// Global pooling reduces each plane over 16 partial results
+const int PoolingLanes = 16;
+
+SHADOW_CPU_TARGETS
+float plane_max(const float *in_data, int count) {
+  float lanes[PoolingLanes];
+  for (int l = 0; l < PoolingLanes; ++l) {
+    lanes[l] = std::numeric_limits<float>::lowest();
+  }
+  int i = 0;
+  for (; i + PoolingLanes <= count; i += PoolingLanes) {
+    for (int l = 0; l < PoolingLanes; ++l) {
+      lanes[l] = in_data[i + l] > lanes[l] ? in_data[i + l] : lanes[l];
+    }
+  }
+  for (; i < count; ++i) {
+    lanes[0] = in_data[i] > lanes[0] ? in_data[i] : lanes[0];
+  }
+  float max = lanes[0];
+  for (int l = 1; l < PoolingLanes; ++l) {
+    max = lanes[l] > max ? lanes[l] : max;
+  }
+  return max;
+}
+
+SHADOW_CPU_TARGETS
+float plane_sum(const float *in_data, int count) {
+  float lanes[PoolingLanes] = {0};
+  int i = 0;
+  for (; i + PoolingLanes <= count; i += PoolingLanes) {
+    for (int l = 0; l < PoolingLanes; ++l) {
+      lanes[l] += in_data[i + l];
+    }
+  }
+  for (; i < count; ++i) {
+    lanes[0] += in_data[i];
+  }
+  float sum = 0;
+  for (int l = 0; l < PoolingLanes; ++l) {
+    sum += lanes[l];
+  }
+  return sum;
+}
+
+// Pools one output at the border, where the window is clipped by the input
+template <bool Max>
+inline float pool_border(const float *in_plane, int in_w, int kistart,
+                         int kiend, int pool_h, int w, int kernel_size_w,
+                         int stride_w, int pad_w) {
+  int kjstart = w * stride_w - pad_w;
+  int kjend = std::min(kjstart + kernel_size_w, in_w + pad_w);
+  int pool_size = pool_h * (kjend - kjstart);
+  kjstart = std::max(kjstart, 0), kjend = std::min(kjend, in_w);
+  float val = Max ? std::numeric_limits<float>::lowest() : 0.f;
+  for (int ki = kistart; ki < kiend; ++ki) {
+    const float *in_row = in_plane + ki * in_w;
+    for (int kj = kjstart; kj < kjend; ++kj) {
+      if (Max) {
+        val = in_row[kj] > val ? in_row[kj] : val;
+      } else {
+        val += in_row[kj];
+      }
+    }
+  }
+  return Max ? val : val / pool_size;
+}
+
+// The outputs [w_begin, w_end) of each row have their windows inside the
+// input width, they accumulate whole input rows at once in out_row
+template <bool Max>
+inline void pool_plane(const float *in_plane, int in_h, int in_w,
+                       int kernel_size_h, int kernel_size_w, int stride_h,
+                       int stride_w, int pad_h, int pad_w, int out_h,
+                       int out_w, int w_begin, int w_end, float *out_plane) {
+  for (int h = 0; h < out_h; ++h) {
+    float *out_row = out_plane + h * out_w;
+    int kistart = h * stride_h - pad_h;
+    int kiend = std::min(kistart + kernel_size_h, in_h + pad_h);
+    int pool_h = kiend - kistart;
+    kistart = std::max(kistart, 0), kiend = std::min(kiend, in_h);
+    for (int w = 0; w < w_begin; ++w) {
+      out_row[w] = pool_border<Max>(in_plane, in_w, kistart, kiend, pool_h,
+                                    w, kernel_size_w, stride_w, pad_w);
+    }
+    for (int w = w_end; w < out_w; ++w) {
+      out_row[w] = pool_border<Max>(in_plane, in_w, kistart, kiend, pool_h,
+                                    w, kernel_size_w, stride_w, pad_w);
+    }
+    if (w_begin >= w_end) continue;
+    std::fill(out_row + w_begin, out_row + w_end,
+              Max ? std::numeric_limits<float>::lowest() : 0.f);
+    for (int ki = kistart; ki < kiend; ++ki) {
+      const float *in_row = in_plane + ki * in_w;
+      if (Max) {
+        max_pool_row(in_row, kernel_size_w, stride_w, pad_w, w_begin, w_end,
+                     out_row);
+      } else {
+        sum_pool_row(in_row, kernel_size_w, stride_w, pad_w, w_begin, w_end,
+                     out_row);
+      }
+    }
+    if (!Max) {
+      float pool_size = static_cast<float>(pool_h * kernel_size_w);
+      for (int w = w_begin; w < w_end; ++w) {
+        out_row[w] /= pool_size;
+      }
+    }
+  }
+}
+
 template <typename T>
 void Pooling(const T *in_data, const VecInt &in_shape, int kernel_size_h,
              int kernel_size_w, int stride_h, int stride_w, int pad_h,
@@ -66,36 +255,163 @@ void Pooling(const T *in_data, const VecInt &in_shape, int kernel_size_h,
   int batch = in_shape[0];
   int in_c = in_shape[1], in_h = in_shape[2], in_w = in_shape[3];
   int out_h = out_shape[2], out_w = out_shape[3];
-  for (int b = 0; b < batch; ++b) {
-    for (int c = 0; c < in_c; ++c) {
+  int in_num = in_h * in_w, out_num = out_h * out_w;
+  if (out_num == 1 && kernel_size_h == in_h && kernel_size_w == in_w &&
+      pad_h == 0 && pad_w == 0) {
+    context->thread_pool()->parallel_for(batch * in_c, [&](int begin,
+                                                           int end) {
+      for (int b_c = begin; b_c < end; ++b_c) {
+        const T *in_plane = in_data + b_c * in_num;
+        out_data[b_c] = mode == 0 ? plane_max(in_plane, in_num)
+                                  : plane_sum(in_plane, in_num) / in_num;
+      }
+    });
+    return;
+  }
+  // Outputs whose windows start at or after the left padding and end before
+  // the right one
+  int w_begin = std::min((pad_w + stride_w - 1) / stride_w, out_w);
+  int w_end = in_w + pad_w >= kernel_size_w
+                  ? (in_w + pad_w - kernel_size_w) / stride_w + 1
+                  : 0;
+  w_end = std::max(std::min(w_end, out_w), w_begin);
+  context->thread_pool()->parallel_for(batch * in_c, [&](int begin, int end) {
+    for (int b_c = begin; b_c < end; ++b_c) {
+      const T *in_plane = in_data + b_c * in_num;
+      T *out_plane = out_data + b_c * out_num;
+      if (mode == 0) {
+        pool_plane<true>(in_plane, in_h, in_w, kernel_size_h, kernel_size_w,
+                         stride_h, stride_w, pad_h, pad_w, out_h, out_w,
+                         w_begin, w_end, out_plane);
+      } else {
+        pool_plane<false>(in_plane, in_h, in_w, kernel_size_h, kernel_size_w,
+                          stride_h, stride_w, pad_h, pad_w, out_h, out_w,
+                          w_begin, w_end, out_plane);
+      }
+    }
+  });
+}
+
+// Pools all channels of a block at once, by output rows
+template <typename T, int B>
+inline void pooling_blocked_rows(int begin, int end, const T *in_data,
+                                 int in_h, int in_w, int kernel_size_h,
+                                 int kernel_size_w, int stride_h, int stride_w,
+                                 int pad_h, int pad_w, int mode, int out_h,
+                                 int out_w, T *out_data) {
+  for (int row = begin; row < end; ++row) {
+    int b_cb = row / out_h, h = row % out_h;
+    const T *in_block = in_data + b_cb * in_h * in_w * B;
+    T *out_row = out_data + row * out_w * B;
+    int kistart = h * stride_h - pad_h;
+    int kiend = std::min(kistart + kernel_size_h, in_h + pad_h);
+    int pool_h = kiend - kistart;
+    kistart = std::max(kistart, 0), kiend = std::min(kiend, in_h);
+    for (int w = 0; w < out_w; ++w) {
+      int kjstart = w * stride_w - pad_w;
+      int kjend = std::min(kjstart + kernel_size_w, in_w + pad_w);
+      int pool_size = pool_h * (kjend - kjstart);
+      kjstart = std::max(kjstart, 0), kjend = std::min(kjend, in_w);
+      T acc[B];
+      for (int l = 0; l < B; ++l) {
+        acc[l] = mode == 0 ? std::numeric_limits<T>::lowest() : T(0);
+      }
+      for (int ki = kistart; ki < kiend; ++ki) {
+        const T *in_row = in_block + ki * in_w * B;
+        for (int kj = kjstart; kj < kjend; ++kj) {
+          const T *in_val = in_row + kj * B;
+          if (mode == 0) {
+            for (int l = 0; l < B; ++l) {
+              acc[l] = in_val[l] > acc[l] ? in_val[l] : acc[l];
+            }
+          } else {
+            for (int l = 0; l < B; ++l) {
+              acc[l] += in_val[l];
+            }
+          }
+        }
+      }
+      T *out_val = out_row + w * B;
+      T norm = mode == 0 ? T(1) : T(1) / pool_size;
+      for (int l = 0; l < B; ++l) {
+        out_val[l] = acc[l] * norm;
+      }
+    }
+  }
+}
+
+template <typename T>
+void PoolingBlocked(const T *in_data, const VecInt &in_shape, int block,
+                    int kernel_size_h, int kernel_size_w, int stride_h,
+                    int stride_w, int pad_h, int pad_w, int mode,
+                    const VecInt &out_shape, T *out_data, Context *context) {
+  int batch = in_shape[0], num_blocks = (in_shape[1] + block - 1) / block;
+  int in_h = in_shape[2], in_w = in_shape[3];
+  int out_h = out_shape[2], out_w = out_shape[3];
+  context->thread_pool()->parallel_for(
+      batch * num_blocks * out_h, [&](int begin, int end) {
+        if (block == 8) {
+          pooling_blocked_rows<T, 8>(begin, end, in_data, in_h, in_w,
+                                     kernel_size_h, kernel_size_w, stride_h,
+                                     stride_w, pad_h, pad_w, mode, out_h,
+                                     out_w, out_data);
+        } else {
+          CHECK_EQ(block, 16);
+          pooling_blocked_rows<T, 16>(begin, end, in_data, in_h, in_w,
+                                      kernel_size_h, kernel_size_w, stride_h,
+                                      stride_w, pad_h, pad_w, mode, out_h,
+                                      out_w, out_data);
+        }
+      });
+}
+
+template void Pooling(const float *, const VecInt &, int, int, int, int, int,
+                      int, int, const VecInt &, float *, Context *);
+template void PoolingBlocked(const float *, const VecInt &, int, int, int, int,
+                             int, int, int, int, const VecInt &, float *,
+                             Context *);
+
+void QuantizedPooling(const unsigned char *in_data, const VecInt &in_shape,
+                      int kernel_size_h, int kernel_size_w, int stride_h,
+                      int stride_w, int pad_h, int pad_w, int mode,
+                      int in_zero_point, float multiplier, int out_zero_point,
+                      const VecInt &out_shape, unsigned char *out_data,
+                      Context *context) {
+  int batch = in_shape[0];
+  int in_c = in_shape[1], in_h = in_shape[2], in_w = in_shape[3];
+  int out_h = out_shape[2], out_w = out_shape[3];
+  context->thread_pool()->parallel_for(batch * in_c, [&](int begin, int end) {
+    for (int b_c = begin; b_c < end; ++b_c) {
+      const unsigned char *in_plane = in_data + b_c * in_h * in_w;
+      unsigned char *out_plane = out_data + b_c * out_h * out_w;
       for (int h = 0; h < out_h; ++h) {
+        int kistart = h * stride_h - pad_h;
+        int kiend = std::min(kistart + kernel_size_h, in_h + pad_h);
+        int pool_h = kiend - kistart;
+        kistart = std::max(kistart, 0), kiend = std::min(kiend, in_h);
         for (int w = 0; w < out_w; ++w) {
-          int kistart = h * stride_h - pad_h, kjstart = w * stride_w - pad_w;
-          int kiend = std::min(kistart + kernel_size_h, in_h + pad_h);
+          int kjstart = w * stride_w - pad_w;
           int kjend = std::min(kjstart + kernel_size_w, in_w + pad_w);
-          int pool_size = (kiend - kistart) * (kjend - kjstart);
-          kistart = std::max(kistart, 0), kjstart = std::max(kjstart, 0);
-          kiend = std::min(kiend, in_h), kjend = std::min(kjend, in_w);
-          T max = std::numeric_limits<T>::lowest();
-          auto sum = T(0);
+          int pool_size = pool_h * (kjend - kjstart);
+          kjstart = std::max(kjstart, 0), kjend = std::min(kjend, in_w);
+          // Padding reads zero, which is the zero point
+          int max = 0, sum = 0;
           for (int ki = kistart; ki < kiend; ++ki) {
+            const unsigned char *in_row = in_plane + ki * in_w;
             for (int kj = kjstart; kj < kjend; ++kj) {
-              int index = kj + in_w * (ki + in_h * (c + in_c * b));
-              T value = in_data[index];
-              max = (value > max) ? value : max;
-              sum += value;
+              max = std::max(max, static_cast<int>(in_row[kj]));
+              sum += in_row[kj] - in_zero_point;
             }
           }
-          int out_index = w + out_w * (h + out_h * (c + in_c * b));
-          out_data[out_index] = (mode == 0) ? max : sum / pool_size;
+          float val = mode == 0 ? static_cast<float>(max - in_zero_point)
+                                : static_cast<float>(sum) / pool_size;
+          out_plane[h * out_w + w] =
+              saturate_u8(val * multiplier + out_zero_point);
         }
       }
     }
-  }
+  });
 }
-
-template void Pooling(const float *, const VecInt &, int, int, int, int, int,
-                      int, int, const VecInt &, float *, Context *);
 #endif
 
 }  // namespace Vision
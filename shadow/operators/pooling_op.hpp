@@ -42,6 +42,10 @@ class PoolingOp : public Operator {
       }
     }
     full_pooling_ = get_single_argument<bool>("full_pooling", true);
+    in_scale_ = get_single_argument<float>("in_scale", 1);
+    in_zero_point_ = get_single_argument<int>("in_zero_point", 0);
+    out_scale_ = get_single_argument<float>("out_scale", 1);
+    out_zero_point_ = get_single_argument<int>("out_zero_point", 0);
 
 #if defined(USE_CUDNN)
     cudnn::createPoolingDesc<float>(&pooling_desc_);
@@ -72,6 +76,8 @@ class PoolingOp : public Operator {
   int pool_type_, kernel_size_h_, kernel_size_w_, stride_h_, stride_w_, pad_h_,
       pad_w_;
   bool global_pooling_, full_pooling_;
+  float in_scale_, out_scale_;
+  int in_zero_point_, out_zero_point_;
 
 #if defined(USE_CUDNN)
   cudnnPoolingDescriptor_t pooling_desc_ = nullptr;
@@ -98,6 +104,21 @@ void Pooling(const T *in_data, const VecInt &in_shape, int kernel_size_h,
              int pad_w, int mode, const VecInt &out_shape, T *out_data,
              Context *context);
 
+template <typename T>
+void PoolingBlocked(const T *in_data, const VecInt &in_shape, int block,
+                    int kernel_size_h, int kernel_size_w, int stride_h,
+                    int stride_w, int pad_h, int pad_w, int mode,
+                    const VecInt &out_shape, T *out_data, Context *context);
+
+// Pools the quantized values of unsigned char blobs and requantizes them by
+// multiplier, the input scale over the output scale
+void QuantizedPooling(const unsigned char *in_data, const VecInt &in_shape,
+                      int kernel_size_h, int kernel_size_w, int stride_h,
+                      int stride_w, int pad_h, int pad_w, int mode,
+                      int in_zero_point, float multiplier, int out_zero_point,
+                      const VecInt &out_shape, unsigned char *out_data,
+                      Context *context);
+
 }  // namespace Vision
 
 }  // namespace Shadow
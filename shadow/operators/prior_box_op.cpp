@@ -7,13 +7,17 @@ void PriorBoxOp::Forward() {
   const auto bottom_im = bottoms(1);
   auto top = tops(0);
 
-  if (is_initial_) {
-    return;
-  }
-
   int in_h = bottom->shape(2), in_w = bottom->shape(3);
   int im_h = bottom_im->shape(2), im_w = bottom_im->shape(3);
 
+  // The priors only depend on the shapes, the top keeps them until the
+  // shapes change
+  VecInt prior_shape{in_h, in_w, im_h, im_w};
+  if (prior_shape_ == prior_shape) {
+    return;
+  }
+  prior_shape_ = prior_shape;
+
   VecInt top_shape{1, 2, 0};
   top_shape[2] = in_h * in_w * num_priors_ * 4;
   CHECK_GT(top_shape[2], 0);
@@ -93,7 +97,6 @@ void PriorBoxOp::Forward() {
     }
   }
   top->set_data<float>(top_data_.data(), top_data_.size());
-  is_initial_ = true;
 }
 
 REGISTER_OPERATOR(PriorBox, PriorBoxOp);
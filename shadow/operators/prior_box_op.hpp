@@ -59,7 +59,8 @@ class PriorBoxOp : public Operator {
  private:
   int num_priors_;
   float step_, offset_;
-  bool flip_, clip_, is_initial_ = false;
+  bool flip_, clip_;
+  VecInt prior_shape_;
   VecFloat min_sizes_, max_sizes_, aspect_ratios_, variance_, top_data_;
 };
 
@@ -63,8 +63,7 @@ void ProposalOp::Forward() {
   CHECK_EQ(num_regs, 4 * num_anchors_);
   CHECK_EQ(num_info, 3);
 
-  int temp_count = num_anchors_ * 4 + in_h * in_w * num_anchors_ * 6;
-  ws_->GrowTempBuffer(temp_count * sizeof(float));
+  TempScope temp_scope(ws_);
 
   auto anchors = ws_->CreateTempBlob({num_anchors_, 4}, DataType::kF32);
   anchors->set_data<float>(anchors_.data(), anchors->count());
@@ -132,43 +131,46 @@ void Proposal(const T *anchor_data, const T *score_data, const T *delta_data,
   int num_proposals = spatial_dim * num_anchors;
   T im_h = info_data[0], im_w = info_data[1], im_scale = info_data[2];
   T min_box_size = min_size * im_scale;
-  for (int n = 0; n < num_anchors; ++n) {
-    const auto *anchor_ptr = anchor_data + n * 4;
-    const auto *score_ptr = score_data + num_proposals + n * spatial_dim;
-    const auto *dx_ptr = delta_data + (n * 4 + 0) * spatial_dim;
-    const auto *dy_ptr = delta_data + (n * 4 + 1) * spatial_dim;
-    const auto *dw_ptr = delta_data + (n * 4 + 2) * spatial_dim;
-    const auto *dh_ptr = delta_data + (n * 4 + 3) * spatial_dim;
-    T anchor_w = anchor_ptr[2] - anchor_ptr[0] + 1;
-    T anchor_h = anchor_ptr[3] - anchor_ptr[1] + 1;
-    for (int h = 0; h < in_h; ++h) {
-      for (int w = 0; w < in_w; ++w) {
-        int spatial_offset = h * in_w + w;
-        T anchor_x = anchor_ptr[0] + w * feat_stride;
-        T anchor_y = anchor_ptr[1] + h * feat_stride;
-        T anchor_cx = anchor_x + (anchor_w - 1) * T(0.5);
-        T anchor_cy = anchor_y + (anchor_h - 1) * T(0.5);
-        T dx = dx_ptr[spatial_offset], dy = dy_ptr[spatial_offset];
-        T dw = dw_ptr[spatial_offset], dh = dh_ptr[spatial_offset];
-        T pb_cx = anchor_cx + anchor_w * dx;
-        T pb_cy = anchor_cy + anchor_h * dy;
-        T pb_w = anchor_w * std::exp(dw), pb_h = anchor_h * std::exp(dh);
-        T pb_xmin = pb_cx - (pb_w - 1) * T(0.5);
-        T pb_ymin = pb_cy - (pb_h - 1) * T(0.5);
-        T pb_xmax = pb_cx + (pb_w - 1) * T(0.5);
-        T pb_ymax = pb_cy + (pb_h - 1) * T(0.5);
-        auto *prop_ptr = proposal_data + (spatial_offset * num_anchors + n) * 6;
-        prop_ptr[0] = std::min(std::max(pb_xmin, T(0)), im_w - 1);
-        prop_ptr[1] = std::min(std::max(pb_ymin, T(0)), im_h - 1);
-        prop_ptr[2] = std::min(std::max(pb_xmax, T(0)), im_w - 1);
-        prop_ptr[3] = std::min(std::max(pb_ymax, T(0)), im_h - 1);
-        prop_ptr[4] = score_ptr[spatial_offset];
-        pb_w = prop_ptr[2] - prop_ptr[0] + 1;
-        pb_h = prop_ptr[3] - prop_ptr[1] + 1;
-        prop_ptr[5] = (pb_w >= min_box_size) && (pb_h >= min_box_size);
+  context->thread_pool()->parallel_for(num_anchors, [&](int begin, int end) {
+    for (int n = begin; n < end; ++n) {
+      const auto *anchor_ptr = anchor_data + n * 4;
+      const auto *score_ptr = score_data + num_proposals + n * spatial_dim;
+      const auto *dx_ptr = delta_data + (n * 4 + 0) * spatial_dim;
+      const auto *dy_ptr = delta_data + (n * 4 + 1) * spatial_dim;
+      const auto *dw_ptr = delta_data + (n * 4 + 2) * spatial_dim;
+      const auto *dh_ptr = delta_data + (n * 4 + 3) * spatial_dim;
+      T anchor_w = anchor_ptr[2] - anchor_ptr[0] + 1;
+      T anchor_h = anchor_ptr[3] - anchor_ptr[1] + 1;
+      for (int h = 0; h < in_h; ++h) {
+        for (int w = 0; w < in_w; ++w) {
+          int spatial_offset = h * in_w + w;
+          T anchor_x = anchor_ptr[0] + w * feat_stride;
+          T anchor_y = anchor_ptr[1] + h * feat_stride;
+          T anchor_cx = anchor_x + (anchor_w - 1) * T(0.5);
+          T anchor_cy = anchor_y + (anchor_h - 1) * T(0.5);
+          T dx = dx_ptr[spatial_offset], dy = dy_ptr[spatial_offset];
+          T dw = dw_ptr[spatial_offset], dh = dh_ptr[spatial_offset];
+          T pb_cx = anchor_cx + anchor_w * dx;
+          T pb_cy = anchor_cy + anchor_h * dy;
+          T pb_w = anchor_w * std::exp(dw), pb_h = anchor_h * std::exp(dh);
+          T pb_xmin = pb_cx - (pb_w - 1) * T(0.5);
+          T pb_ymin = pb_cy - (pb_h - 1) * T(0.5);
+          T pb_xmax = pb_cx + (pb_w - 1) * T(0.5);
+          T pb_ymax = pb_cy + (pb_h - 1) * T(0.5);
+          auto *prop_ptr =
+              proposal_data + (spatial_offset * num_anchors + n) * 6;
+          prop_ptr[0] = std::min(std::max(pb_xmin, T(0)), im_w - 1);
+          prop_ptr[1] = std::min(std::max(pb_ymin, T(0)), im_h - 1);
+          prop_ptr[2] = std::min(std::max(pb_xmax, T(0)), im_w - 1);
+          prop_ptr[3] = std::min(std::max(pb_ymax, T(0)), im_h - 1);
+          prop_ptr[4] = score_ptr[spatial_offset];
+          pb_w = prop_ptr[2] - prop_ptr[0] + 1;
+          pb_h = prop_ptr[3] - prop_ptr[1] + 1;
+          prop_ptr[5] = (pb_w >= min_box_size) && (pb_h >= min_box_size);
+        }
       }
     }
-  }
+  });
 }
 
 template void Proposal(const float *, const float *, const float *,
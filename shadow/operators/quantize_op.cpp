@@ -0,0 +1,165 @@
+#include "quantize_op.hpp"
+
+#include <cmath>
+
+namespace Shadow {
+
+void QuantizeOp::Forward() {
+  const auto bottom = bottoms(0);
+  auto top = tops(0);
+
+  CHECK(bottom->data_type() == DataType::kF32);
+  CHECK(top->data_type() == DataType::kU8);
+  CHECK(bottom->layout() == Layout::kNCHW);
+
+  top->reshape(bottom->shape());
+
+#if !defined(USE_CUDA)
+  Vision::Quantize(bottom->data<float>(), bottom->count(), scale_, zero_point_,
+                   top->mutable_data<unsigned char>(), ws_->Ctx());
+
+#else
+  LOG(FATAL) << "Quantized operators are only supported on CPU";
+#endif
+}
+
+REGISTER_OPERATOR(Quantize, QuantizeOp);
+
+namespace Vision {
+
+#if !defined(USE_CUDA)
+template <typename T>
+void Quantize(const T *in_data, int count, float scale, int zero_point,
+              unsigned char *out_data, Context *context) {
+  float inv_scale = 1 / scale;
+  context->thread_pool()->parallel_for(
+      count, ElementGrain, [&](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+          out_data[i] = saturate_u8(in_data[i] * inv_scale + zero_point);
+        }
+      });
+}
+
+template void Quantize(const float *, int, float, int, unsigned char *,
+                       Context *);
+
+// Blocks of QGemmMR x QGemmNR outputs accumulate along the contiguous k of
+// both operands, which compilers turn into dot product instructions, VNNI on
+// AVX512 CPUs. Edge blocks repeat the last row and drop the extra outputs
+const int QGemmMR = 4, QGemmNR = 4;
+
+inline void quantized_gemm(int M, int N, int K, const signed char *a,
+                           const unsigned char *b, const int *offset,
+                           const float *multiplier, int zero_point, int low,
+                           int high, unsigned char *c, int ldc_m, int ldc_n) {
+  for (int i_0 = 0; i_0 < M; i_0 += QGemmMR) {
+    const signed char *a_rows[QGemmMR];
+    for (int i = 0; i < QGemmMR; ++i) {
+      a_rows[i] = a + std::min(i_0 + i, M - 1) * K;
+    }
+    for (int j_0 = 0; j_0 < N; j_0 += QGemmNR) {
+      const unsigned char *b_rows[QGemmNR];
+      for (int j = 0; j < QGemmNR; ++j) {
+        b_rows[j] = b + std::min(j_0 + j, N - 1) * K;
+      }
+      int acc[QGemmMR][QGemmNR] = {};
+      for (int k = 0; k < K; ++k) {
+        for (int i = 0; i < QGemmMR; ++i) {
+          for (int j = 0; j < QGemmNR; ++j) {
+            acc[i][j] += static_cast<int>(a_rows[i][k]) * b_rows[j][k];
+          }
+        }
+      }
+      int m = std::min(QGemmMR, M - i_0), n = std::min(QGemmNR, N - j_0);
+      for (int i = 0; i < m; ++i) {
+        float mult = multiplier[i_0 + i];
+        int base = offset[i_0 + i];
+        unsigned char *c_i = c + (i_0 + i) * ldc_m + j_0 * ldc_n;
+        for (int j = 0; j < n; ++j) {
+          float val = (acc[i][j] + base) * mult + zero_point;
+          val = std::min(std::max(val, static_cast<float>(low)),
+                         static_cast<float>(high));
+          c_i[j * ldc_n] = saturate_u8(val);
+        }
+      }
+    }
+  }
+}
+
+using QuantizedGemmFunc = void (*)(int, int, int, const signed char *,
+                                   const unsigned char *, const int *,
+                                   const float *, int, int, int,
+                                   unsigned char *, int, int);
+
+// Compiled for AVX512 VNNI and AVX2 as well and picked once at run time by
+// the features of the CPU where the compiler supports it
+#if defined(HAVE_TARGET_CLONES)
+__attribute__((target("avx512f,avx512bw,avx512vl,avx512vnni,avx2,fma"),
+               flatten))
+void quantized_gemm_vnni(int M, int N, int K, const signed char *a,
+                         const unsigned char *b, const int *offset,
+                         const float *multiplier, int zero_point, int low,
+                         int high, unsigned char *c, int ldc_m, int ldc_n) {
+  quantized_gemm(M, N, K, a, b, offset, multiplier, zero_point, low, high, c,
+                 ldc_m, ldc_n);
+}
+
+__attribute__((target("avx2,fma"), flatten))
+void quantized_gemm_avx2(int M, int N, int K, const signed char *a,
+                         const unsigned char *b, const int *offset,
+                         const float *multiplier, int zero_point, int low,
+                         int high, unsigned char *c, int ldc_m, int ldc_n) {
+  quantized_gemm(M, N, K, a, b, offset, multiplier, zero_point, low, high, c,
+                 ldc_m, ldc_n);
+}
+
+inline QuantizedGemmFunc select_quantized_gemm() {
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512vnni") &&
+      __builtin_cpu_supports("avx512bw") &&
+      __builtin_cpu_supports("avx512vl")) {
+    return quantized_gemm_vnni;
+  } else if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+    return quantized_gemm_avx2;
+  }
+  return quantized_gemm;
+}
+#else
+inline QuantizedGemmFunc select_quantized_gemm() { return quantized_gemm; }
+#endif
+
+void QuantizedGemm(int M, int N, int K, const signed char *a,
+                   const unsigned char *b, const int *offset,
+                   const float *multiplier, int zero_point, int low, int high,
+                   unsigned char *c, int ldc_m, int ldc_n) {
+  static const QuantizedGemmFunc func = select_quantized_gemm();
+  func(M, N, K, a, b, offset, multiplier, zero_point, low, high, c, ldc_m,
+       ldc_n);
+}
+
+void QuantizedOffset(const signed char *weight_data, const float *bias_data,
+                     int num_output, int kernel_dim, float in_scale,
+                     int in_zero_point, const VecFloat &weight_scale,
+                     float out_scale, VecInt *offset, VecFloat *multiplier) {
+  CHECK_EQ(static_cast<int>(weight_scale.size()), num_output);
+  offset->resize(num_output), multiplier->resize(num_output);
+  for (int n = 0; n < num_output; ++n) {
+    const signed char *weight_n = weight_data + n * kernel_dim;
+    int weight_sum = 0;
+    for (int k = 0; k < kernel_dim; ++k) {
+      weight_sum += weight_n[k];
+    }
+    float acc_scale = in_scale * weight_scale[n];
+    int bias = 0;
+    if (bias_data != nullptr) {
+      bias = static_cast<int>(std::lround(bias_data[n] / acc_scale));
+    }
+    (*offset)[n] = bias - in_zero_point * weight_sum;
+    (*multiplier)[n] = acc_scale / out_scale;
+  }
+}
+#endif
+
+}  // namespace Vision
+
+}  // namespace Shadow
@@ -0,0 +1,75 @@
+#ifndef SHADOW_OPERATORS_QUANTIZE_OP_HPP
+#define SHADOW_OPERATORS_QUANTIZE_OP_HPP
+
+#include "core/operator.hpp"
+
+namespace Shadow {
+
+// Quantizes a float blob to an unsigned char blob, which holds
+// x = scale * (q - zero_point)
+class QuantizeOp : public Operator {
+ public:
+  QuantizeOp(const shadow::OpParam &op_param, Workspace *ws)
+      : Operator(op_param, ws) {
+    scale_ = get_single_argument<float>("scale", 1);
+    zero_point_ = get_single_argument<int>("zero_point", 0);
+    CHECK_GT(scale_, 0);
+    CHECK(zero_point_ >= 0 && zero_point_ <= 255);
+  }
+
+  void Forward() override;
+
+ private:
+  float scale_;
+  int zero_point_;
+};
+
+// Rounds and saturates x to unsigned char
+inline unsigned char saturate_u8(float x) {
+  // Converting through int lets compilers vectorize the loops using it
+  return static_cast<unsigned char>(
+      static_cast<int>(std::min(std::max(x, 0.f), 255.f) + 0.5f));
+}
+
+// The range [low, high] of the quantized outputs, which also applies the
+// built in Relu and Relu6
+inline void quantized_activate_range(int activate_type, float scale,
+                                     int zero_point, int *low, int *high) {
+  *low = 0, *high = 255;
+  if (activate_type == 1 || activate_type == 6) {
+    *low = zero_point;
+  }
+  if (activate_type == 6) {
+    *high = std::min(zero_point + static_cast<int>(6 / scale + 0.5f), 255);
+  }
+}
+
+namespace Vision {
+
+template <typename T>
+void Quantize(const T *in_data, int count, float scale, int zero_point,
+              unsigned char *out_data, Context *context);
+
+// Int8 product with requantization for the quantized operators, a is M x K
+// int8 and b is N x K unsigned char, both rows are contiguous. Element
+// (i, j) of c is stored at c[i * ldc_m + j * ldc_n] as
+// clamp(round((offset[i] + sum_k a[i][k] * b[j][k]) * multiplier[i]) +
+// zero_point, low, high). Runs on the calling thread
+void QuantizedGemm(int M, int N, int K, const signed char *a,
+                   const unsigned char *b, const int *offset,
+                   const float *multiplier, int zero_point, int low, int high,
+                   unsigned char *c, int ldc_m, int ldc_n);
+
+// Folds the bias and the zero point of the input into the offsets of
+// QuantizedGemm, weight_data holds num_output rows of kernel_dim quantized by
+// weight_scale per row
+void QuantizedOffset(const signed char *weight_data, const float *bias_data,
+                     int num_output, int kernel_dim, float in_scale,
+                     int in_zero_point, const VecFloat &weight_scale,
+                     float out_scale, VecInt *offset, VecFloat *multiplier);
+
+}  // namespace Vision
+
+}  // namespace Shadow
+
+#endif  // SHADOW_OPERATORS_QUANTIZE_OP_HPP
@@ -77,10 +77,11 @@ void ReduceOp::Forward() {
       cudnnHandle_t(ws_->Ctx()->cudnn_handle()), reduce_desc_, bottom_desc_,
       top_desc_, &workspace_size));
 
+  TempScope temp_scope(ws_);
+
   std::shared_ptr<Blob> workspace = nullptr;
   const void *workspace_ptr = nullptr;
   if (workspace_size > 0) {
-    ws_->GrowTempBuffer(workspace_size);
     workspace =
         ws_->CreateTempBlob({static_cast<int>(workspace_size)}, DataType::kU8);
     workspace_ptr = workspace->data<unsigned char>();
@@ -96,7 +97,7 @@ void ReduceOp::Forward() {
   int num_list = static_cast<int>(list_value_.size());
   int num_offset = static_cast<int>(offset_value_.size());
 
-  ws_->GrowTempBuffer((num_list + num_offset) * sizeof(int));
+  TempScope temp_scope(ws_);
 
   auto list = ws_->CreateTempBlob({num_list}, DataType::kI32);
   auto offset = ws_->CreateTempBlob({num_offset}, DataType::kI32);
@@ -183,10 +184,12 @@ template <typename T>
 void Reduce(const T *in_data, const int *list_data, const int *offset_data,
             int num_list, int operation, int count, T *out_data,
             Context *context) {
-  for (int i = 0; i < count; ++i) {
-    out_data[i] =
-        Reduce(in_data, list_data, num_list, offset_data[i], operation);
-  }
+  context->thread_pool()->parallel_for(count, [&](int begin, int end) {
+    for (int i = begin; i < end; ++i) {
+      out_data[i] =
+          Reduce(in_data, list_data, num_list, offset_data[i], operation);
+    }
+  });
 }
 
 template void Reduce(const float *, const int *, const int *, int, int, int,
@@ -0,0 +1,110 @@
+#include "reorder_op.hpp"
+
+namespace Shadow {
+
+void ReorderOp::Forward() {
+  const auto bottom = bottoms(0);
+  auto top = tops(0);
+
+  CHECK_NE(bottom, top);
+  CHECK_GE(bottom->num_axes(), 2);
+
+  top->reshape(bottom->shape(), layout_);
+
+  if (bottom->layout() == layout_) {
+    Blas::BlasScopy(bottom->storage_count(), bottom->data<float>(), 0,
+                    top->mutable_data<float>(), 0, ws_->Ctx());
+    return;
+  }
+
+#if !defined(USE_CUDA)
+  if (bottom->layout() == Layout::kNCHW) {
+    Vision::ReorderToBlocked(bottom->data<float>(), bottom->shape(),
+                             top->block(), top->mutable_data<float>(),
+                             ws_->Ctx());
+  } else if (layout_ == Layout::kNCHW) {
+    Vision::ReorderFromBlocked(bottom->data<float>(), bottom->shape(),
+                               bottom->block(), top->mutable_data<float>(),
+                               ws_->Ctx());
+  } else {
+    TempScope temp_scope(ws_);
+    auto temp = ws_->CreateTempBlob(bottom->shape(), DataType::kF32);
+    Vision::ReorderFromBlocked(bottom->data<float>(), bottom->shape(),
+                               bottom->block(), temp->mutable_data<float>(),
+                               ws_->Ctx());
+    Vision::ReorderToBlocked(temp->data<float>(), bottom->shape(),
+                             top->block(), top->mutable_data<float>(),
+                             ws_->Ctx());
+  }
+
+#else
+  LOG(FATAL) << "Blocked layouts are only supported on CPU";
+#endif
+}
+
+REGISTER_OPERATOR(Reorder, ReorderOp);
+
+namespace Vision {
+
+#if !defined(USE_CUDA)
+template <typename T>
+void ReorderToBlocked(const T *in_data, const VecInt &in_shape, int block,
+                      T *out_data, Context *context) {
+  int batch = in_shape[0], channel = in_shape[1], inner = 1;
+  for (int n = 2; n < static_cast<int>(in_shape.size()); ++n) {
+    inner *= in_shape[n];
+  }
+  int num_blocks = (channel + block - 1) / block;
+  context->thread_pool()->parallel_for(
+      batch * num_blocks, [&](int begin, int end) {
+        for (int b_cb = begin; b_cb < end; ++b_cb) {
+          int b = b_cb / num_blocks, c_0 = b_cb % num_blocks * block;
+          T *out_block = out_data + b_cb * inner * block;
+          for (int l = 0; l < block; ++l) {
+            if (c_0 + l < channel) {
+              const T *in_plane = in_data + (b * channel + c_0 + l) * inner;
+              for (int i = 0; i < inner; ++i) {
+                out_block[i * block + l] = in_plane[i];
+              }
+            } else {
+              for (int i = 0; i < inner; ++i) {
+                out_block[i * block + l] = T(0);
+              }
+            }
+          }
+        }
+      });
+}
+
+template <typename T>
+void ReorderFromBlocked(const T *in_data, const VecInt &in_shape, int block,
+                        T *out_data, Context *context) {
+  int batch = in_shape[0], channel = in_shape[1], inner = 1;
+  for (int n = 2; n < static_cast<int>(in_shape.size()); ++n) {
+    inner *= in_shape[n];
+  }
+  int num_blocks = (channel + block - 1) / block;
+  context->thread_pool()->parallel_for(
+      batch * num_blocks, [&](int begin, int end) {
+        for (int b_cb = begin; b_cb < end; ++b_cb) {
+          int b = b_cb / num_blocks, c_0 = b_cb % num_blocks * block;
+          const T *in_block = in_data + b_cb * inner * block;
+          for (int l = 0; l < std::min(block, channel - c_0); ++l) {
+            T *out_plane = out_data + (b * channel + c_0 + l) * inner;
+            for (int i = 0; i < inner; ++i) {
+              out_plane[i] = in_block[i * block + l];
+            }
+          }
+        }
+      });
+}
+
+template void ReorderToBlocked(const float *, const VecInt &, int, float *,
+                               Context *);
+template void ReorderFromBlocked(const float *, const VecInt &, int, float *,
+                                 Context *);
+#endif
+
+}  // namespace Vision
+
+}  // namespace Shadow
@@ -0,0 +1,41 @@
+#ifndef SHADOW_OPERATORS_REORDER_OP_HPP
+#define SHADOW_OPERATORS_REORDER_OP_HPP
+
+#include "core/operator.hpp"
+
+namespace Shadow {
+
+// Converts a blob between NCHW and the blocked layouts, inserted by the
+// layout propagation of the graph optimizer
+class ReorderOp : public Operator {
+ public:
+  ReorderOp(const shadow::OpParam &op_param, Workspace *ws)
+      : Operator(op_param, ws) {
+    int block = get_single_argument<int>("layout", 1);
+    CHECK(block == 1 || block == 8 || block == 16)
+        << "Unsupported layout block " << block;
+    layout_ = static_cast<Layout>(block);
+  }
+
+  void Forward() override;
+
+ private:
+  Layout layout_;
+};
+
+namespace Vision {
+
+// The padded channels of the blocked blob are filled by zeros
+template <typename T>
+void ReorderToBlocked(const T *in_data, const VecInt &in_shape, int block,
+                      T *out_data, Context *context);
+
+template <typename T>
+void ReorderFromBlocked(const T *in_data, const VecInt &in_shape, int block,
+                        T *out_data, Context *context);
+
+}  // namespace Vision
+
+}  // namespace Shadow
+
+#endif  // SHADOW_OPERATORS_REORDER_OP_HPP
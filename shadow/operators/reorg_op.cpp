@@ -34,22 +34,23 @@ void Reorg(const T *in_data, const VecInt &in_shape, int stride, T *out_data,
   int batch = in_shape[0], in_c = in_shape[1];
   int in_h = in_shape[2], in_w = in_shape[3];
   int out_c = in_c / (stride * stride);
-  for (int b = 0; b < batch; ++b) {
-    for (int c = 0; c < in_c; ++c) {
+  context->thread_pool()->parallel_for(batch * in_c, [&](int begin, int end) {
+    for (int b_c = begin; b_c < end; ++b_c) {
+      int b = b_c / in_c, c = b_c % in_c;
       for (int h = 0; h < in_h; ++h) {
         for (int w = 0; w < in_w; ++w) {
           int c2 = c % out_c;
           int offset = c / out_c;
           int h2 = h * stride + offset / stride;
           int w2 = w * stride + offset % stride;
-          int in_index = ((b * in_c + c) * in_h + h) * in_w + w;
+          int in_index = (b_c * in_h + h) * in_w + w;
           int out_index =
               ((b * out_c + c2) * in_h * stride + h2) * in_w * stride + w2;
           out_data[in_index] = in_data[out_index];
         }
       }
     }
-  }
+  });
 }
 
 template void Reorg(const float *, const VecInt &, int, float *, Context *);
@@ -43,10 +43,26 @@ void ResizeOp::Forward() {
     Blas::BlasScopy(bottom->count(), bottom->data<float>(), 0,
                     top->mutable_data<float>(), 0, ws_->Ctx());
   } else {
+#if defined(USE_CUDA)
     // Nearest: 0, Bilinear: 1
     Vision::Resize(bottom->data<float>(), bottom->shape(), type_,
                    align_corners_, top->shape(), top->mutable_data<float>(),
                    ws_->Ctx());
+
+#else
+    VecInt table_shape{in_h, in_w, out_h, out_w};
+    if (table_shape_ != table_shape) {
+      table_shape_ = table_shape;
+      Vision::ResizeTable(in_h, out_h, type_, align_corners_, &h_index_,
+                          &h_weight_);
+      Vision::ResizeTable(in_w, out_w, type_, align_corners_, &w_index_,
+                          &w_weight_);
+    }
+    Vision::ResizeSeparable(bottom->data<float>(), bottom->shape(), type_,
+                            align_corners_, h_index_, h_weight_, w_index_,
+                            w_weight_, top->shape(),
+                            top->mutable_data<float>(), ws_->Ctx());
+#endif
   }
 }
 
@@ -55,96 +71,158 @@ REGISTER_OPERATOR(Resize, ResizeOp);
 namespace Vision {
 
 #if !defined(USE_CUDA)
-template <typename T>
-inline void ResizeNearest(const T* in_data, int batch, int channel, int in_h,
-                          int in_w, int out_h, int out_w, T* out_data) {
-  float fh = static_cast<float>(in_h) / out_h;
-  float fw = static_cast<float>(in_w) / out_w;
-  for (int b = 0; b < batch; ++b) {
-    for (int c = 0; c < channel; ++c) {
-      for (int h = 0; h < out_h; ++h) {
-        int src_h = static_cast<int>(h * fh);
-        for (int w = 0; w < out_w; ++w) {
-          int src_w = static_cast<int>(w * fw);
-          int src_index = ((b * channel + c) * in_h + src_h) * in_w + src_w;
-          *out_data++ = in_data[src_index];
-        }
+void ResizeTable(int in_size, int out_size, int type, bool align_corners,
+                 VecInt* index, VecFloat* weight) {
+  CHECK(type == 0 || type == 1) << "Unsupported resize type: " << type;
+  index->resize(out_size), weight->assign(out_size, 0.f);
+  if (type == 0) {
+    float f = static_cast<float>(in_size) / out_size;
+    for (int i = 0; i < out_size; ++i) {
+      (*index)[i] = static_cast<int>(i * f);
+    }
+    return;
+  }
+  float f = static_cast<float>(in_size) / out_size;
+  if (align_corners) {
+    f = out_size > 1 ? static_cast<float>(in_size - 1) / (out_size - 1) : 0;
+  }
+  for (int i = 0; i < out_size; ++i) {
+    float src_f = align_corners ? i * f : std::max((i + 0.5f) * f - 0.5f, 0.f);
+    int src = static_cast<int>(src_f);
+    if (src >= in_size - 1) {
+      (*index)[i] = in_size - 1;
+    } else {
+      (*index)[i] = src, (*weight)[i] = src_f - src;
+    }
+  }
+}
+
+SHADOW_CPU_TARGETS
+void resize_row_bilinear(const float* in_row, int in_w, const int* index,
+                         const float* weight, int out_w, float* out_row) {
+  for (int w = 0; w < out_w; ++w) {
+    int w_l = index[w], w_h = std::min(w_l + 1, in_w - 1);
+    out_row[w] = (1 - weight[w]) * in_row[w_l] + weight[w] * in_row[w_h];
+  }
+}
+
+// Bilinear 2x without aligned corners, the outputs are 1/4 and 3/4 between
+// the inputs
+SHADOW_CPU_TARGETS
+void resize_row_bilinear_2x(const float* in_row, int in_w, float* out_row) {
+  out_row[0] = in_row[0];
+  for (int w = 1; w < in_w; ++w) {
+    out_row[2 * w - 1] = 0.75f * in_row[w - 1] + 0.25f * in_row[w];
+    out_row[2 * w] = 0.25f * in_row[w - 1] + 0.75f * in_row[w];
+  }
+  out_row[2 * in_w - 1] = in_row[in_w - 1];
+}
+
+SHADOW_CPU_TARGETS
+void blend_rows(const float* row_0, const float* row_1, float weight,
+                int count, float* out_row) {
+  for (int i = 0; i < count; ++i) {
+    out_row[i] = (1 - weight) * row_0[i] + weight * row_1[i];
+  }
+}
+
+// Each input row is resampled horizontally once into one of two row buffers,
+// the output rows blend the buffers of their two source rows
+void resize_plane_bilinear(const float* in_data, int in_h, int in_w,
+                           const VecInt& h_index, const VecFloat& h_weight,
+                           const VecInt& w_index, const VecFloat& w_weight,
+                           bool twice_w, int out_h, int out_w, float* rows,
+                           float* out_data) {
+  float *row_0 = rows, *row_1 = rows + out_w;
+  int src_0 = -1, src_1 = -1;
+  auto resample = [&](int src, float* row) {
+    if (twice_w) {
+      resize_row_bilinear_2x(in_data + src * in_w, in_w, row);
+    } else {
+      resize_row_bilinear(in_data + src * in_w, in_w, w_index.data(),
+                          w_weight.data(), out_w, row);
+    }
+  };
+  for (int h = 0; h < out_h; ++h) {
+    int h_l = h_index[h], h_h = std::min(h_l + 1, in_h - 1);
+    if (h_l != src_0) {
+      if (h_l == src_1) {
+        std::swap(row_0, row_1), std::swap(src_0, src_1);
+      } else {
+        resample(h_l, row_0), src_0 = h_l;
+      }
+    }
+    float* out_row = out_data + h * out_w;
+    if (h_weight[h] > 0) {
+      if (h_h != src_1) {
+        resample(h_h, row_1), src_1 = h_h;
       }
+      blend_rows(row_0, row_1, h_weight[h], out_w, out_row);
+    } else {
+      memcpy(out_row, row_0, out_w * sizeof(float));
     }
   }
 }
 
-template <typename T>
-inline void ResizeBilinear(const T* in_data, int batch, int channel, int in_h,
-                           int in_w, int out_h, int out_w, bool align_corners,
-                           T* out_data) {
-  float fh = align_corners ? static_cast<float>(in_h - 1) / (out_h - 1)
-                           : static_cast<float>(in_h) / out_h;
-  float fw = align_corners ? static_cast<float>(in_w - 1) / (out_w - 1)
-                           : static_cast<float>(in_w) / out_w;
-  for (int b = 0; b < batch; ++b) {
-    for (int c = 0; c < channel; ++c) {
-      int src_index_off = (b * channel + c) * in_h;
-      for (int h = 0; h < out_h; ++h) {
-        float src_h_f;
-        if (align_corners) {
-          src_h_f = h * fh;
-        } else {
-          src_h_f = (h + 0.5f) * fh - 0.5f;
-          src_h_f = src_h_f < 0 ? 0 : src_h_f;
-        }
-        int src_h_l = static_cast<int>(src_h_f), src_h_h = src_h_l + 1;
-        if (src_h_l >= in_h - 1) {
-          src_h_h = src_h_l = in_h - 1;
-        }
-        float sh = src_h_f - src_h_l;
-        for (int w = 0; w < out_w; ++w) {
-          float src_w_f;
-          if (align_corners) {
-            src_w_f = w * fw;
-          } else {
-            src_w_f = (w + 0.5f) * fw - 0.5f;
-            src_w_f = src_w_f < 0 ? 0 : src_w_f;
-          }
-          int src_w_l = static_cast<int>(src_w_f), src_w_h = src_w_l + 1;
-          if (src_w_l >= in_w - 1) {
-            src_w_h = src_w_l = in_w - 1;
-          }
-          float sw = src_w_f - src_w_l;
-          int src_index_0 = (src_index_off + src_h_l) * in_w + src_w_l;
-          int src_index_1 = (src_index_off + src_h_h) * in_w + src_w_l;
-          int src_index_2 = (src_index_off + src_h_l) * in_w + src_w_h;
-          int src_index_3 = (src_index_off + src_h_h) * in_w + src_w_h;
-          *out_data++ =
-              static_cast<T>((1 - sh) * (1 - sw) * in_data[src_index_0] +
-                             sh * (1 - sw) * in_data[src_index_1] +
-                             (1 - sh) * sw * in_data[src_index_2] +
-                             sh * sw * in_data[src_index_3]);
-        }
+// Output rows of the same source row are copies of the first of them
+void resize_plane_nearest(const float* in_data, int in_w,
+                          const VecInt& h_index, const VecInt& w_index,
+                          bool twice_w, int out_h, int out_w,
+                          float* out_data) {
+  for (int h = 0; h < out_h; ++h) {
+    float* out_row = out_data + h * out_w;
+    if (h > 0 && h_index[h] == h_index[h - 1]) {
+      memcpy(out_row, out_row - out_w, out_w * sizeof(float));
+      continue;
+    }
+    const float* in_row = in_data + h_index[h] * in_w;
+    if (twice_w) {
+      for (int w = 0; w < in_w; ++w) {
+        out_row[2 * w] = out_row[2 * w + 1] = in_row[w];
+      }
+    } else {
+      for (int w = 0; w < out_w; ++w) {
+        out_row[w] = in_row[w_index[w]];
       }
     }
   }
 }
 
 template <typename T>
-void Resize(const T* in_data, const VecInt& in_shape, int type,
-            bool align_corners, const VecInt& out_shape, T* out_data,
-            Context* context) {
+void ResizeSeparable(const T* in_data, const VecInt& in_shape, int type,
+                     bool align_corners, const VecInt& h_index,
+                     const VecFloat& h_weight, const VecInt& w_index,
+                     const VecFloat& w_weight, const VecInt& out_shape,
+                     T* out_data, Context* context) {
   int batch = in_shape[0], channel = in_shape[1];
   int in_h = in_shape[2], in_w = in_shape[3];
   int out_h = out_shape[2], out_w = out_shape[3];
-  if (type == 0) {
-    ResizeNearest(in_data, batch, channel, in_h, in_w, out_h, out_w, out_data);
-  } else if (type == 1) {
-    ResizeBilinear(in_data, batch, channel, in_h, in_w, out_h, out_w,
-                   align_corners, out_data);
-  } else {
-    LOG(FATAL) << "Unsupported resize type: " << type;
-  }
+  CHECK_EQ(static_cast<int>(h_index.size()), out_h);
+  CHECK_EQ(static_cast<int>(w_index.size()), out_w);
+  // Exact 2x upsampling along the width skips the gathers of the tables
+  bool twice_w = out_w == 2 * in_w && (type == 0 || !align_corners);
+  int in_num = in_h * in_w, out_num = out_h * out_w;
+  context->thread_pool()->parallel_for(
+      batch * channel, [&](int begin, int end) {
+        std::vector<float> rows(type == 1 ? 2 * out_w : 0);
+        for (int b_c = begin; b_c < end; ++b_c) {
+          if (type == 0) {
+            resize_plane_nearest(in_data + b_c * in_num, in_w, h_index,
+                                 w_index, twice_w, out_h, out_w,
+                                 out_data + b_c * out_num);
+          } else {
+            resize_plane_bilinear(in_data + b_c * in_num, in_h, in_w, h_index,
+                                  h_weight, w_index, w_weight, twice_w, out_h,
+                                  out_w, rows.data(), out_data + b_c * out_num);
+          }
+        }
+      });
 }
 
-template void Resize(const float*, const VecInt&, int, bool, const VecInt&,
-                     float*, Context*);
+template void ResizeSeparable(const float*, const VecInt&, int, bool,
+                              const VecInt&, const VecFloat&, const VecInt&,
+                              const VecFloat&, const VecInt&, float*,
+                              Context*);
 #endif
 
 }  // namespace Vision
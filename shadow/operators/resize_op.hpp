@@ -42,10 +42,27 @@ class ResizeOp : public Operator {
   int out_h_, out_w_, type_;
   float scale_h_, scale_w_;
   bool align_corners_;
+  // Coefficient tables of the cached in_h, in_w, out_h and out_w
+  VecInt table_shape_, h_index_, w_index_;
+  VecFloat h_weight_, w_weight_;
 };
 
 namespace Vision {
 
+// Source index and weight of each output along one axis. Nearest outputs copy
+// the index, bilinear outputs blend the index and the next one clamped to the
+// input by the weight of the next one
+void ResizeTable(int in_size, int out_size, int type, bool align_corners,
+                 VecInt* index, VecFloat* weight);
+
+// Resizes each plane by a horizontal then a vertical pass over the tables
+template <typename T>
+void ResizeSeparable(const T* in_data, const VecInt& in_shape, int type,
+                     bool align_corners, const VecInt& h_index,
+                     const VecFloat& h_weight, const VecInt& w_index,
+                     const VecFloat& w_weight, const VecInt& out_shape,
+                     T* out_data, Context* context);
+
 template <typename T>
 void Resize(const T* in_data, const VecInt& in_shape, int type,
             bool align_corners, const VecInt& out_shape, T* out_data,
@@ -7,9 +7,11 @@ void ScaleOp::Forward() {
   auto top = tops(0);
 
   if (bottom != top) {
-    top->reshape(bottom->shape());
+    top->reshape(bottom->shape(), bottom->layout());
   }
 
+  TempScope temp_scope(ws_);
+
   std::shared_ptr<Blob> scale = nullptr, bias = nullptr;
   if (scale_value_.empty() && bias_value_.empty()) {
     CHECK_GE(bottoms_size(), 2);
@@ -18,12 +20,10 @@ void ScaleOp::Forward() {
       scale = bottoms(1), bias = bottoms(2);
     } else if (has_scale_) {
       scale = bottoms(1);
-      ws_->GrowTempBuffer(scale->raw_size());
       bias = ws_->CreateTempBlob(scale->shape(), DataType::kF32);
       Blas::Set(bias->count(), 0, bias->mutable_data<float>(), 0, ws_->Ctx());
     } else {
       bias = bottoms(1);
-      ws_->GrowTempBuffer(bias->raw_size());
       scale = ws_->CreateTempBlob(bias->shape(), DataType::kF32);
       Blas::Set(scale->count(), 1, scale->mutable_data<float>(), 0, ws_->Ctx());
     }
@@ -43,7 +43,6 @@ void ScaleOp::Forward() {
     } else {
       bias_value_ = VecFloat(dim, 0);
     }
-    ws_->GrowTempBuffer(2 * dim * sizeof(float));
     scale = ws_->CreateTempBlob({dim}, DataType::kF32);
     bias = ws_->CreateTempBlob({dim}, DataType::kF32);
     scale->set_data<float>(scale_value_.data(), dim);
@@ -67,6 +66,18 @@ void ScaleOp::Forward() {
   scale_dim_ = scale->count();
   inner_dim_ = bottom->count(axis_ + scale->num_axes());
 
+#if !defined(USE_CUDA)
+  if (bottom->layout() != Layout::kNCHW) {
+    CHECK(axis_ == 1 && scale_dim_ == bottom->shape(1))
+        << "Blocked layouts only support channel wise scale";
+    Vision::ScaleBlocked(bottom->data<float>(), bottom->shape(),
+                         bottom->block(), scale->data<float>(),
+                         bias->data<float>(), top->mutable_data<float>(),
+                         ws_->Ctx());
+    return;
+  }
+#endif
+
   Vision::Scale(bottom->data<float>(), bottom->count(), scale->data<float>(),
                 bias->data<float>(), scale_dim_, inner_dim_,
                 top->mutable_data<float>(), ws_->Ctx());
@@ -80,14 +91,50 @@ namespace Vision {
 template <typename T>
 void Scale(const T *in_data, int count, const T *scale_data, const T *bias_data,
            int scale_dim, int inner_dim, T *out_data, Context *context) {
-  for (int i = 0; i < count; ++i) {
-    int index = (i / inner_dim) % scale_dim;
-    out_data[i] = in_data[i] * scale_data[index] + bias_data[index];
+  context->thread_pool()->parallel_for(
+      count, ElementGrain, [&](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+          int index = (i / inner_dim) % scale_dim;
+          out_data[i] = in_data[i] * scale_data[index] + bias_data[index];
+        }
+      });
+}
+
+template <typename T>
+void ScaleBlocked(const T *in_data, const VecInt &in_shape, int block,
+                  const T *scale_data, const T *bias_data, T *out_data,
+                  Context *context) {
+  int channel = in_shape[1], inner = 1;
+  for (int n = 2; n < static_cast<int>(in_shape.size()); ++n) {
+    inner *= in_shape[n];
   }
+  int num_blocks = (channel + block - 1) / block;
+  int grain = ElementGrain / (block * inner);
+  context->thread_pool()->parallel_for(
+      in_shape[0] * num_blocks, grain, [&](int begin, int end) {
+        T scale[16], bias[16];
+        for (int b_cb = begin; b_cb < end; ++b_cb) {
+          int c_0 = b_cb % num_blocks * block;
+          for (int l = 0; l < block; ++l) {
+            bool valid = c_0 + l < channel;
+            scale[l] = valid ? scale_data[c_0 + l] : T(0);
+            bias[l] = valid ? bias_data[c_0 + l] : T(0);
+          }
+          const T *in_block = in_data + b_cb * inner * block;
+          T *out_block = out_data + b_cb * inner * block;
+          for (int i = 0; i < inner * block; i += block) {
+            for (int l = 0; l < block; ++l) {
+              out_block[i + l] = in_block[i + l] * scale[l] + bias[l];
+            }
+          }
+        }
+      });
 }
 
 template void Scale(const float *, int, const float *, const float *, int, int,
                     float *, Context *);
+template void ScaleBlocked(const float *, const VecInt &, int, const float *,
+                           const float *, float *, Context *);
 #endif
 
 }  // namespace Vision
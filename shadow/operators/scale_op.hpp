@@ -30,6 +30,12 @@ template <typename T>
 void Scale(const T *in_data, int count, const T *scale_data, const T *bias_data,
            int scale_dim, int inner_dim, T *out_data, Context *context);
 
+// Channel wise scale of a blocked blob, the padded channels are set to zero
+template <typename T>
+void ScaleBlocked(const T *in_data, const VecInt &in_shape, int block,
+                  const T *scale_data, const T *bias_data, T *out_data,
+                  Context *context);
+
 }  // namespace Vision
 
 }  // namespace Shadow
@@ -29,13 +29,15 @@ void ShuffleChannel(const T *in_data, int batch, int channel, int spatial_dim,
                     int group, T *out_data, Context *context) {
   int num = channel * spatial_dim;
   int group_column = channel / group;
-  for (int b = 0; b < batch; ++b, in_data += num, out_data += num) {
-    for (int c = 0; c < channel; ++c) {
-      int c_out = (c % group_column) * group + c / group_column;
-      memcpy(out_data + c_out * spatial_dim, in_data + c * spatial_dim,
-             spatial_dim * sizeof(T));
-    }
-  }
+  context->thread_pool()->parallel_for(
+      batch * channel, [&](int begin, int end) {
+        for (int b_c = begin; b_c < end; ++b_c) {
+          int b = b_c / channel, c = b_c % channel;
+          int c_out = (c % group_column) * group + c / group_column;
+          memcpy(out_data + b * num + c_out * spatial_dim,
+                 in_data + b * num + c * spatial_dim, spatial_dim * sizeof(T));
+        }
+      });
 }
 
 template void ShuffleChannel(const float *, int, int, int, int, float *,
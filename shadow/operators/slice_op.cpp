@@ -26,25 +26,27 @@ void SliceOp::Forward() {
     slices.push_back(bottom_slice_axis - prev);
   }
 
-  int count = 0;
-  auto top_shape = bottom->shape();
-  for (int n = 0; n < num_tops; ++n) {
-    auto top = tops(n);
-    top_shape[slice_axis_] = slices[n];
-    top->reshape(top_shape);
-    count += top->count();
-  }
-  CHECK_EQ(count, bottom->count());
-
   int offset_slice_axis = 0;
   int num_slices = bottom->count(0, slice_axis_);
   int slice_size = bottom->count(slice_axis_ + 1);
-  for (int n = 0; n < tops_size(); ++n) {
+  auto top_shape = bottom->shape();
+  for (int n = 0; n < num_tops; ++n) {
     auto top = tops(n);
-    int top_slice_axis = top->shape(slice_axis_);
-    Vision::Slice(bottom->data<float>(), top->count(), num_slices, slice_size,
-                  bottom_slice_axis, top_slice_axis, offset_slice_axis,
-                  top->mutable_data<float>(), ws_->Ctx());
+    CHECK_NE(bottom, top);
+    int top_slice_axis = slices[n];
+    top_shape[slice_axis_] = top_slice_axis;
+    // Slices of the outermost axis are contiguous, the tops view the bottom
+    // if the network allows it
+    if (view_ && num_slices == 1) {
+      top->share_data(bottom->data<unsigned char>() +
+                          offset_slice_axis * slice_size * bottom->elem_size(),
+                      top_shape);
+    } else {
+      top->reshape(top_shape);
+      Vision::Slice(bottom->data<float>(), top->count(), num_slices,
+                    slice_size, bottom_slice_axis, top_slice_axis,
+                    offset_slice_axis, top->mutable_data<float>(), ws_->Ctx());
+    }
     offset_slice_axis += top_slice_axis;
   }
 }
@@ -58,11 +60,14 @@ template <typename T>
 void Slice(const T *in_data, int count, int num_slices, int slice_size,
            int bottom_slice_axis, int top_slice_axis, int offset_slice_axis,
            T *out_data, Context *context) {
-  for (int n = 0; n < num_slices; ++n) {
-    memcpy(out_data + n * top_slice_axis * slice_size,
-           in_data + (n * bottom_slice_axis + offset_slice_axis) * slice_size,
-           top_slice_axis * slice_size * sizeof(T));
-  }
+  context->thread_pool()->parallel_for(num_slices, [&](int begin, int end) {
+    for (int n = begin; n < end; ++n) {
+      memcpy(
+          out_data + n * top_slice_axis * slice_size,
+          in_data + (n * bottom_slice_axis + offset_slice_axis) * slice_size,
+          top_slice_axis * slice_size * sizeof(T));
+    }
+  });
 }
 
 template void Slice(const float *, int, int, int, int, int, int, float *,
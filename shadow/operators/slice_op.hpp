@@ -11,6 +11,7 @@ class SliceOp : public Operator {
       : Operator(op_param, ws) {
     slice_axis_ = get_single_argument<int>("axis", 1);
     slice_point_ = get_repeated_argument<int>("slice_point");
+    view_ = get_single_argument<bool>("view", false);
     CHECK_GE(slice_axis_, 0);
   }
 
@@ -19,6 +20,7 @@ class SliceOp : public Operator {
  private:
   int slice_axis_;
   VecInt slice_point_;
+  bool view_;
 };
 
 namespace Vision {
@@ -24,13 +24,15 @@ void SoftmaxOp::Forward() {
       top->mutable_data<float>()));
 
 #else
-  ws_->GrowTempBuffer(outer_num * inner_num * sizeof(float));
-
+  float *val_data = nullptr;
+#if defined(USE_CUDA)
+  TempScope temp_scope(ws_);
   auto scalar = ws_->CreateTempBlob({outer_num, inner_num}, DataType::kF32);
+  val_data = scalar->mutable_data<float>();
+#endif
 
   Vision::Softmax(bottom->data<float>(), outer_num, channels, inner_num,
-                  scalar->mutable_data<float>(), top->mutable_data<float>(),
-                  ws_->Ctx());
+                  val_data, top->mutable_data<float>(), ws_->Ctx());
 #endif
 }
 
@@ -39,40 +41,124 @@ REGISTER_OPERATOR(Softmax, SoftmaxOp);
 namespace Vision {
 
 #if !defined(USE_CUDA)
-template <typename T>
-void Softmax(const T *in_data, int outer_num, int channels, int inner_num,
-             T *val_data, T *out_data, Context *context) {
-  int val_count = outer_num * inner_num, count = val_count * channels;
-
-  for (int i = 0; i < val_count; ++i) {
-    int n = i / inner_num, s = i % inner_num;
-    const T *in_data_offset = in_data + n * channels * inner_num + s;
-    T max_val = T(-FLT_MAX);
-    for (int c = 0; c < channels; ++c, in_data_offset += inner_num) {
-      max_val = std::max(*in_data_offset, max_val);
+// The maximum and the sum of exponentials relative to it are found in one
+// pass, a block of channels raises the running maximum at most once, which
+// rescales the sum by one exp. A second pass writes the outputs
+const int SoftmaxLanes = 16, SoftmaxBlock = 64, SoftmaxGroup = 8,
+          SoftmaxTile = 64;
+
+// Softmax over contiguous channels, inner_num is 1 as in classification heads
+SHADOW_CPU_TARGETS
+void softmax_contiguous(const float *in_data, int channels, float *out_data) {
+  float max_val = -FLT_MAX, sums[SoftmaxLanes] = {};
+  for (int c_0 = 0; c_0 < channels; c_0 += SoftmaxBlock) {
+    const float *in_c = in_data + c_0;
+    int num_c = std::min(SoftmaxBlock, channels - c_0), c = 0;
+    float maxs[SoftmaxLanes];
+    std::fill(maxs, maxs + SoftmaxLanes, max_val);
+    for (; c + SoftmaxLanes <= num_c; c += SoftmaxLanes) {
+      for (int i = 0; i < SoftmaxLanes; ++i) {
+        maxs[i] = std::max(maxs[i], in_c[c + i]);
+      }
+    }
+    for (; c < num_c; ++c) {
+      maxs[0] = std::max(maxs[0], in_c[c]);
+    }
+    float block_max = max_val;
+    for (int i = 0; i < SoftmaxLanes; ++i) {
+      block_max = std::max(block_max, maxs[i]);
+    }
+    if (block_max > max_val) {
+      float scale = fast_exp(max_val - block_max);
+      for (int i = 0; i < SoftmaxLanes; ++i) {
+        sums[i] *= scale;
+      }
+      max_val = block_max;
+    }
+    for (c = 0; c + SoftmaxLanes <= num_c; c += SoftmaxLanes) {
+      for (int i = 0; i < SoftmaxLanes; ++i) {
+        sums[i] += fast_exp(in_c[c + i] - max_val);
+      }
+    }
+    for (; c < num_c; ++c) {
+      sums[0] += fast_exp(in_c[c] - max_val);
     }
-    val_data[i] = max_val;
   }
-
-  for (int i = 0; i < count; ++i) {
-    int n = i / channels / inner_num, s = i % inner_num;
-    out_data[i] = std::exp(in_data[i] - val_data[n * inner_num + s]);
+  float sum = 0;
+  for (int i = 0; i < SoftmaxLanes; ++i) {
+    sum += sums[i];
+  }
+  float inv_sum = 1 / sum;
+  for (int c = 0; c < channels; ++c) {
+    out_data[c] = fast_exp(in_data[c] - max_val) * inv_sum;
   }
+}
 
-  for (int i = 0; i < val_count; ++i) {
-    int n = i / inner_num, s = i % inner_num;
-    const T *out_data_offset = out_data + n * channels * inner_num + s;
-    T sum = T(0);
-    for (int c = 0; c < channels; ++c, out_data_offset += inner_num) {
-      sum += *out_data_offset;
+// Softmax over channels strided by inner_num as in SSD confidence heads, for
+// num_s <= SoftmaxTile contiguous inner positions at once
+SHADOW_CPU_TARGETS
+void softmax_strided(const float *in_data, int channels, int inner_num,
+                     int num_s, float *out_data) {
+  float max_vals[SoftmaxTile], sums[SoftmaxTile], block_max[SoftmaxTile];
+  std::fill(max_vals, max_vals + num_s, -FLT_MAX);
+  std::fill(sums, sums + num_s, 0.f);
+  for (int c_0 = 0; c_0 < channels; c_0 += SoftmaxGroup) {
+    int c_end = std::min(c_0 + SoftmaxGroup, channels);
+    std::copy(max_vals, max_vals + num_s, block_max);
+    for (int c = c_0; c < c_end; ++c) {
+      const float *in_c = in_data + c * inner_num;
+      for (int s = 0; s < num_s; ++s) {
+        block_max[s] = std::max(block_max[s], in_c[s]);
+      }
+    }
+    for (int s = 0; s < num_s; ++s) {
+      sums[s] *= fast_exp(max_vals[s] - block_max[s]);
+      max_vals[s] = block_max[s];
+    }
+    for (int c = c_0; c < c_end; ++c) {
+      const float *in_c = in_data + c * inner_num;
+      for (int s = 0; s < num_s; ++s) {
+        sums[s] += fast_exp(in_c[s] - max_vals[s]);
+      }
+    }
+  }
+  for (int s = 0; s < num_s; ++s) {
+    sums[s] = 1 / sums[s];
+  }
+  for (int c = 0; c < channels; ++c) {
+    const float *in_c = in_data + c * inner_num;
+    float *out_c = out_data + c * inner_num;
+    for (int s = 0; s < num_s; ++s) {
+      out_c[s] = fast_exp(in_c[s] - max_vals[s]) * sums[s];
     }
-    val_data[i] = sum;
   }
+}
 
-  for (int i = 0; i < count; ++i) {
-    int n = i / channels / inner_num, s = i % inner_num;
-    out_data[i] /= val_data[n * inner_num + s];
+template <typename T>
+void Softmax(const T *in_data, int outer_num, int channels, int inner_num,
+             T * /*val_data*/, T *out_data, Context *context) {
+  int dim = channels * inner_num;
+
+  if (inner_num == 1) {
+    context->thread_pool()->parallel_for(outer_num, [&](int begin, int end) {
+      for (int n = begin; n < end; ++n) {
+        softmax_contiguous(in_data + n * dim, channels, out_data + n * dim);
+      }
+    });
+    return;
   }
+
+  int num_tiles = (inner_num + SoftmaxTile - 1) / SoftmaxTile;
+  context->thread_pool()->parallel_for(
+      outer_num * num_tiles, [&](int begin, int end) {
+        for (int t = begin; t < end; ++t) {
+          int n = t / num_tiles, s_0 = (t % num_tiles) * SoftmaxTile;
+          int offset = n * dim + s_0;
+          softmax_strided(in_data + offset, channels, inner_num,
+                          std::min(SoftmaxTile, inner_num - s_0),
+                          out_data + offset);
+        }
+      });
 }
 
 template void Softmax(const float *, int, int, int, float *, float *,
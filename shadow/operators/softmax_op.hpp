@@ -36,6 +36,37 @@ class SoftmaxOp : public Operator {
 
 namespace Vision {
 
+// exp by a polynomial on x - n * ln2 and 2^n from the exponent bits, within 2
+// ulp of std::exp for x in [-87.3, 88]. Larger x are clamped to 88, smaller x
+// give zero and NaN gives NaN. The clamps select by bit masks rather than
+// comparisons of floats, which keeps loops over it vectorizable without
+// -fno-trapping-math
+inline float fast_exp(float x) {
+  // Unsigned bits above those of -87.3 are the negative floats below it
+  uint32_t bits = float_bits(x);
+  uint32_t nan =
+      0u - static_cast<uint32_t>((bits & 0x7fffffffu) > 0x7f800000u);
+  uint32_t low = 0u - static_cast<uint32_t>(bits > 0xc2ae999au);
+  uint32_t high = 0u - static_cast<uint32_t>((bits > 0x42b00000u) &
+                                             (bits < 0x80000000u));
+  bits = (bits & ~low) | (0xc2ae999au & low);
+  x = bits_float((bits & ~high) | (0x42b00000u & high));
+  // Adding 1.5 * 2^23 rounds x / ln2 to the nearest integer
+  float n = (x * 1.44269504f + 12582912.f) - 12582912.f;
+  float r = x - n * 0.693145751953125f - n * 1.428606820e-6f;
+  float p = 1.9875691500e-4f;
+  p = p * r + 1.3981999507e-3f;
+  p = p * r + 8.3334519073e-3f;
+  p = p * r + 4.1665795894e-2f;
+  p = p * r + 1.6666665459e-1f;
+  p = p * r + 5.0000001201e-1f;
+  p = p * r * r + r + 1;
+  p *= bits_float(static_cast<uint32_t>(static_cast<int>(n) + 127) << 23);
+  return bits_float((float_bits(p) & ~(low | nan)) | (0x7fc00000u & nan));
+}
+
+// The CUDA kernel keeps the channel maximums and sums in val_data, the CPU
+// kernel needs no scratch and takes nullptr
 template <typename T>
 void Softmax(const T *in_data, int outer_num, int channels, int inner_num,
              T *val_data, T *out_data, Context *context);
@@ -37,10 +37,12 @@ template <typename T>
 void Stack(const T *in_data, int count, int num_stacks, int stack_size,
            int top_stack_axis, int offset_stack_axis, T *out_data,
            Context *context) {
-  for (int n = 0; n < num_stacks; ++n) {
-    memcpy(out_data + (n * top_stack_axis + offset_stack_axis) * stack_size,
-           in_data + n * stack_size, stack_size * sizeof(T));
-  }
+  context->thread_pool()->parallel_for(num_stacks, [&](int begin, int end) {
+    for (int n = begin; n < end; ++n) {
+      memcpy(out_data + (n * top_stack_axis + offset_stack_axis) * stack_size,
+             in_data + n * stack_size, stack_size * sizeof(T));
+    }
+  });
 }
 
 template void Stack(const float *, int, int, int, int, int, float *, Context *);
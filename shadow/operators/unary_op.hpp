@@ -16,7 +16,6 @@ class UnaryOp : public Operator {
 
   void Forward() override;
 
- private:
   enum {
     kAbs = 0,
     kSquare = 1,
@@ -35,6 +34,7 @@ class UnaryOp : public Operator {
     kReciprocal = 14
   };
 
+ private:
   int operation_;
 };
 
@@ -0,0 +1,2259 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: shadow.proto
+
+#include "shadow.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace shadow {
+PROTOBUF_CONSTEXPR Blob::Blob(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.shape_)*/{}
+  , /*decltype(_impl_.data_f_)*/{}
+  , /*decltype(_impl_.data_i_)*/{}
+  , /*decltype(_impl_._data_i_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.data_b_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.type_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct BlobDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BlobDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BlobDefaultTypeInternal() {}
+  union {
+    Blob _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BlobDefaultTypeInternal _Blob_default_instance_;
+PROTOBUF_CONSTEXPR Argument::Argument(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.v_f_)*/{}
+  , /*decltype(_impl_.v_i_)*/{}
+  , /*decltype(_impl_.v_s_)*/{}
+  , /*decltype(_impl_.v_l_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.s_s_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.s_f_)*/0
+  , /*decltype(_impl_.s_i_)*/0
+  , /*decltype(_impl_.s_l_)*/int64_t{0}} {}
+struct ArgumentDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ArgumentDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ArgumentDefaultTypeInternal() {}
+  union {
+    Argument _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ArgumentDefaultTypeInternal _Argument_default_instance_;
+PROTOBUF_CONSTEXPR OpParam::OpParam(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.bottom_)*/{}
+  , /*decltype(_impl_.top_)*/{}
+  , /*decltype(_impl_.arg_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.type_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct OpParamDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR OpParamDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~OpParamDefaultTypeInternal() {}
+  union {
+    OpParam _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OpParamDefaultTypeInternal _OpParam_default_instance_;
+PROTOBUF_CONSTEXPR NetParam::NetParam(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.blob_)*/{}
+  , /*decltype(_impl_.op_)*/{}
+  , /*decltype(_impl_.arg_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct NetParamDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NetParamDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NetParamDefaultTypeInternal() {}
+  union {
+    NetParam _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NetParamDefaultTypeInternal _NetParam_default_instance_;
+PROTOBUF_CONSTEXPR MetaNetParam::MetaNetParam(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.network_)*/{}
+  , /*decltype(_impl_.arg_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct MetaNetParamDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MetaNetParamDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MetaNetParamDefaultTypeInternal() {}
+  union {
+    MetaNetParam _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MetaNetParamDefaultTypeInternal _MetaNetParam_default_instance_;
+}  // namespace shadow
+static ::_pb::Metadata file_level_metadata_shadow_2eproto[5];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_shadow_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_shadow_2eproto = nullptr;
+
+const uint32_t TableStruct_shadow_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::shadow::Blob, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::shadow::Blob, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::shadow::Blob, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::shadow::Blob, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::shadow::Blob, _impl_.shape_),
+  PROTOBUF_FIELD_OFFSET(::shadow::Blob, _impl_.data_f_),
+  PROTOBUF_FIELD_OFFSET(::shadow::Blob, _impl_.data_i_),
+  PROTOBUF_FIELD_OFFSET(::shadow::Blob, _impl_.data_b_),
+  0,
+  1,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::shadow::Argument, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::shadow::Argument, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::shadow::Argument, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::shadow::Argument, _impl_.s_f_),
+  PROTOBUF_FIELD_OFFSET(::shadow::Argument, _impl_.s_i_),
+  PROTOBUF_FIELD_OFFSET(::shadow::Argument, _impl_.s_s_),
+  PROTOBUF_FIELD_OFFSET(::shadow::Argument, _impl_.v_f_),
+  PROTOBUF_FIELD_OFFSET(::shadow::Argument, _impl_.v_i_),
+  PROTOBUF_FIELD_OFFSET(::shadow::Argument, _impl_.v_s_),
+  PROTOBUF_FIELD_OFFSET(::shadow::Argument, _impl_.s_l_),
+  PROTOBUF_FIELD_OFFSET(::shadow::Argument, _impl_.v_l_),
+  0,
+  2,
+  3,
+  1,
+  ~0u,
+  ~0u,
+  ~0u,
+  4,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::shadow::OpParam, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::shadow::OpParam, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::shadow::OpParam, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::shadow::OpParam, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::shadow::OpParam, _impl_.bottom_),
+  PROTOBUF_FIELD_OFFSET(::shadow::OpParam, _impl_.top_),
+  PROTOBUF_FIELD_OFFSET(::shadow::OpParam, _impl_.arg_),
+  0,
+  1,
+  ~0u,
+  ~0u,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::shadow::NetParam, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::shadow::NetParam, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::shadow::NetParam, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::shadow::NetParam, _impl_.blob_),
+  PROTOBUF_FIELD_OFFSET(::shadow::NetParam, _impl_.op_),
+  PROTOBUF_FIELD_OFFSET(::shadow::NetParam, _impl_.arg_),
+  0,
+  ~0u,
+  ~0u,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::shadow::MetaNetParam, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::shadow::MetaNetParam, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::shadow::MetaNetParam, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::shadow::MetaNetParam, _impl_.network_),
+  PROTOBUF_FIELD_OFFSET(::shadow::MetaNetParam, _impl_.arg_),
+  0,
+  ~0u,
+  ~0u,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 12, -1, sizeof(::shadow::Blob)},
+  { 18, 33, -1, sizeof(::shadow::Argument)},
+  { 42, 53, -1, sizeof(::shadow::OpParam)},
+  { 58, 68, -1, sizeof(::shadow::NetParam)},
+  { 72, 81, -1, sizeof(::shadow::MetaNetParam)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::shadow::_Blob_default_instance_._instance,
+  &::shadow::_Argument_default_instance_._instance,
+  &::shadow::_OpParam_default_instance_._instance,
+  &::shadow::_NetParam_default_instance_._instance,
+  &::shadow::_MetaNetParam_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_shadow_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\014shadow.proto\022\006shadow\"i\n\004Blob\022\014\n\004name\030\001"
+  " \001(\t\022\014\n\004type\030\002 \001(\t\022\r\n\005shape\030\003 \003(\005\022\022\n\006dat"
+  "a_f\030\004 \003(\002B\002\020\001\022\022\n\006data_i\030\005 \003(\005B\002\020\001\022\016\n\006dat"
+  "a_b\030\006 \003(\014\"\200\001\n\010Argument\022\014\n\004name\030\001 \001(\t\022\013\n\003"
+  "s_f\030\002 \001(\002\022\013\n\003s_i\030\003 \001(\005\022\013\n\003s_s\030\004 \001(\t\022\013\n\003v"
+  "_f\030\005 \003(\002\022\013\n\003v_i\030\006 \003(\005\022\013\n\003v_s\030\007 \003(\t\022\013\n\003s_"
+  "l\030\010 \001(\003\022\013\n\003v_l\030\t \003(\003\"a\n\007OpParam\022\014\n\004name\030"
+  "\001 \001(\t\022\014\n\004type\030\002 \001(\t\022\016\n\006bottom\030\003 \003(\t\022\013\n\003t"
+  "op\030\004 \003(\t\022\035\n\003arg\030\013 \003(\0132\020.shadow.Argument\""
+  "p\n\010NetParam\022\014\n\004name\030\001 \001(\t\022\032\n\004blob\030\005 \003(\0132"
+  "\014.shadow.Blob\022\033\n\002op\030\013 \003(\0132\017.shadow.OpPar"
+  "am\022\035\n\003arg\030\014 \003(\0132\020.shadow.Argument\"^\n\014Met"
+  "aNetParam\022\014\n\004name\030\001 \001(\t\022!\n\007network\030\013 \003(\013"
+  "2\020.shadow.NetParam\022\035\n\003arg\030\014 \003(\0132\020.shadow"
+  ".Argument"
+  ;
+static ::_pbi::once_flag descriptor_table_shadow_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_shadow_2eproto = {
+    false, false, 569, descriptor_table_protodef_shadow_2eproto,
+    "shadow.proto",
+    &descriptor_table_shadow_2eproto_once, nullptr, 0, 5,
+    schemas, file_default_instances, TableStruct_shadow_2eproto::offsets,
+    file_level_metadata_shadow_2eproto, file_level_enum_descriptors_shadow_2eproto,
+    file_level_service_descriptors_shadow_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_shadow_2eproto_getter() {
+  return &descriptor_table_shadow_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_shadow_2eproto(&descriptor_table_shadow_2eproto);
+namespace shadow {
+
+// ===================================================================
+
+class Blob::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Blob>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+Blob::Blob(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:shadow.Blob)
+}
+Blob::Blob(const Blob& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Blob* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.shape_){from._impl_.shape_}
+    , decltype(_impl_.data_f_){from._impl_.data_f_}
+    , decltype(_impl_.data_i_){from._impl_.data_i_}
+    , /*decltype(_impl_._data_i_cached_byte_size_)*/{0}
+    , decltype(_impl_.data_b_){from._impl_.data_b_}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.type_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_type()) {
+    _this->_impl_.type_.Set(from._internal_type(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:shadow.Blob)
+}
+
+inline void Blob::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.shape_){arena}
+    , decltype(_impl_.data_f_){arena}
+    , decltype(_impl_.data_i_){arena}
+    , /*decltype(_impl_._data_i_cached_byte_size_)*/{0}
+    , decltype(_impl_.data_b_){arena}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.type_){}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Blob::~Blob() {
+  // @@protoc_insertion_point(destructor:shadow.Blob)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Blob::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.shape_.~RepeatedField();
+  _impl_.data_f_.~RepeatedField();
+  _impl_.data_i_.~RepeatedField();
+  _impl_.data_b_.~RepeatedPtrField();
+  _impl_.name_.Destroy();
+  _impl_.type_.Destroy();
+}
+
+void Blob::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Blob::Clear() {
+// @@protoc_insertion_point(message_clear_start:shadow.Blob)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.shape_.Clear();
+  _impl_.data_f_.Clear();
+  _impl_.data_i_.Clear();
+  _impl_.data_b_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.type_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Blob::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "shadow.Blob.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string type = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_type();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "shadow.Blob.type");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 shape = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_shape(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<24>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 26) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_shape(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float data_f = 4 [packed = true];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_data_f(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 37) {
+          _internal_add_data_f(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 data_i = 5 [packed = true];
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_data_i(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 40) {
+          _internal_add_data_i(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated bytes data_b = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_data_b();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Blob::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:shadow.Blob)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "shadow.Blob.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // optional string type = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_type().data(), static_cast<int>(this->_internal_type().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "shadow.Blob.type");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_type(), target);
+  }
+
+  // repeated int32 shape = 3;
+  for (int i = 0, n = this->_internal_shape_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_shape(i), target);
+  }
+
+  // repeated float data_f = 4 [packed = true];
+  if (this->_internal_data_f_size() > 0) {
+    target = stream->WriteFixedPacked(4, _internal_data_f(), target);
+  }
+
+  // repeated int32 data_i = 5 [packed = true];
+  {
+    int byte_size = _impl_._data_i_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          5, _internal_data_i(), byte_size, target);
+    }
+  }
+
+  // repeated bytes data_b = 6;
+  for (int i = 0, n = this->_internal_data_b_size(); i < n; i++) {
+    const auto& s = this->_internal_data_b(i);
+    target = stream->WriteBytes(6, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:shadow.Blob)
+  return target;
+}
+
+size_t Blob::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:shadow.Blob)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int32 shape = 3;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.shape_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_shape_size());
+    total_size += data_size;
+  }
+
+  // repeated float data_f = 4 [packed = true];
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_data_f_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated int32 data_i = 5 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.data_i_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._data_i_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated bytes data_b = 6;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.data_b_.size());
+  for (int i = 0, n = _impl_.data_b_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.data_b_.Get(i));
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional string name = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_name());
+    }
+
+    // optional string type = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_type());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Blob::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Blob::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Blob::GetClassData() const { return &_class_data_; }
+
+
+void Blob::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Blob*>(&to_msg);
+  auto& from = static_cast<const Blob&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:shadow.Blob)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.shape_.MergeFrom(from._impl_.shape_);
+  _this->_impl_.data_f_.MergeFrom(from._impl_.data_f_);
+  _this->_impl_.data_i_.MergeFrom(from._impl_.data_i_);
+  _this->_impl_.data_b_.MergeFrom(from._impl_.data_b_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_type(from._internal_type());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Blob::CopyFrom(const Blob& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:shadow.Blob)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Blob::IsInitialized() const {
+  return true;
+}
+
+void Blob::InternalSwap(Blob* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.shape_.InternalSwap(&other->_impl_.shape_);
+  _impl_.data_f_.InternalSwap(&other->_impl_.data_f_);
+  _impl_.data_i_.InternalSwap(&other->_impl_.data_i_);
+  _impl_.data_b_.InternalSwap(&other->_impl_.data_b_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.type_, lhs_arena,
+      &other->_impl_.type_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Blob::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_shadow_2eproto_getter, &descriptor_table_shadow_2eproto_once,
+      file_level_metadata_shadow_2eproto[0]);
+}
+
+// ===================================================================
+
+class Argument::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Argument>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_s_f(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_s_i(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_s_s(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_s_l(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+};
+
+Argument::Argument(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:shadow.Argument)
+}
+Argument::Argument(const Argument& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Argument* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.v_f_){from._impl_.v_f_}
+    , decltype(_impl_.v_i_){from._impl_.v_i_}
+    , decltype(_impl_.v_s_){from._impl_.v_s_}
+    , decltype(_impl_.v_l_){from._impl_.v_l_}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.s_s_){}
+    , decltype(_impl_.s_f_){}
+    , decltype(_impl_.s_i_){}
+    , decltype(_impl_.s_l_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.s_s_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.s_s_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_s_s()) {
+    _this->_impl_.s_s_.Set(from._internal_s_s(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.s_f_, &from._impl_.s_f_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.s_l_) -
+    reinterpret_cast<char*>(&_impl_.s_f_)) + sizeof(_impl_.s_l_));
+  // @@protoc_insertion_point(copy_constructor:shadow.Argument)
+}
+
+inline void Argument::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.v_f_){arena}
+    , decltype(_impl_.v_i_){arena}
+    , decltype(_impl_.v_s_){arena}
+    , decltype(_impl_.v_l_){arena}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.s_s_){}
+    , decltype(_impl_.s_f_){0}
+    , decltype(_impl_.s_i_){0}
+    , decltype(_impl_.s_l_){int64_t{0}}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.s_s_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.s_s_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Argument::~Argument() {
+  // @@protoc_insertion_point(destructor:shadow.Argument)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Argument::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.v_f_.~RepeatedField();
+  _impl_.v_i_.~RepeatedField();
+  _impl_.v_s_.~RepeatedPtrField();
+  _impl_.v_l_.~RepeatedField();
+  _impl_.name_.Destroy();
+  _impl_.s_s_.Destroy();
+}
+
+void Argument::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Argument::Clear() {
+// @@protoc_insertion_point(message_clear_start:shadow.Argument)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.v_f_.Clear();
+  _impl_.v_i_.Clear();
+  _impl_.v_s_.Clear();
+  _impl_.v_l_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.s_s_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x0000001cu) {
+    ::memset(&_impl_.s_f_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.s_l_) -
+        reinterpret_cast<char*>(&_impl_.s_f_)) + sizeof(_impl_.s_l_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Argument::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "shadow.Argument.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float s_f = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _Internal::set_has_s_f(&has_bits);
+          _impl_.s_f_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 s_i = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_s_i(&has_bits);
+          _impl_.s_i_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string s_s = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_s_s();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "shadow.Argument.s_s");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float v_f = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 45)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_v_f(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+            ptr += sizeof(float);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<45>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 42) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_v_f(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 v_i = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_v_i(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<48>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 50) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_v_i(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string v_s = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_v_s();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "shadow.Argument.v_s");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<58>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int64 s_l = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_s_l(&has_bits);
+          _impl_.s_l_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int64 v_l = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_v_l(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<72>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 74) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt64Parser(_internal_mutable_v_l(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Argument::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:shadow.Argument)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "shadow.Argument.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // optional float s_f = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_s_f(), target);
+  }
+
+  // optional int32 s_i = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_s_i(), target);
+  }
+
+  // optional string s_s = 4;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_s_s().data(), static_cast<int>(this->_internal_s_s().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "shadow.Argument.s_s");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_s_s(), target);
+  }
+
+  // repeated float v_f = 5;
+  for (int i = 0, n = this->_internal_v_f_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(5, this->_internal_v_f(i), target);
+  }
+
+  // repeated int32 v_i = 6;
+  for (int i = 0, n = this->_internal_v_i_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_v_i(i), target);
+  }
+
+  // repeated string v_s = 7;
+  for (int i = 0, n = this->_internal_v_s_size(); i < n; i++) {
+    const auto& s = this->_internal_v_s(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "shadow.Argument.v_s");
+    target = stream->WriteString(7, s, target);
+  }
+
+  // optional int64 s_l = 8;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(8, this->_internal_s_l(), target);
+  }
+
+  // repeated int64 v_l = 9;
+  for (int i = 0, n = this->_internal_v_l_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(9, this->_internal_v_l(i), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:shadow.Argument)
+  return target;
+}
+
+size_t Argument::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:shadow.Argument)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated float v_f = 5;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_v_f_size());
+    size_t data_size = 4UL * count;
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_v_f_size());
+    total_size += data_size;
+  }
+
+  // repeated int32 v_i = 6;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.v_i_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_v_i_size());
+    total_size += data_size;
+  }
+
+  // repeated string v_s = 7;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.v_s_.size());
+  for (int i = 0, n = _impl_.v_s_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.v_s_.Get(i));
+  }
+
+  // repeated int64 v_l = 9;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int64Size(this->_impl_.v_l_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_v_l_size());
+    total_size += data_size;
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    // optional string name = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_name());
+    }
+
+    // optional string s_s = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_s_s());
+    }
+
+    // optional float s_f = 2;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 4;
+    }
+
+    // optional int32 s_i = 3;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_s_i());
+    }
+
+    // optional int64 s_l = 8;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_s_l());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Argument::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Argument::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Argument::GetClassData() const { return &_class_data_; }
+
+
+void Argument::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Argument*>(&to_msg);
+  auto& from = static_cast<const Argument&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:shadow.Argument)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.v_f_.MergeFrom(from._impl_.v_f_);
+  _this->_impl_.v_i_.MergeFrom(from._impl_.v_i_);
+  _this->_impl_.v_s_.MergeFrom(from._impl_.v_s_);
+  _this->_impl_.v_l_.MergeFrom(from._impl_.v_l_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_s_s(from._internal_s_s());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.s_f_ = from._impl_.s_f_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.s_i_ = from._impl_.s_i_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.s_l_ = from._impl_.s_l_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Argument::CopyFrom(const Argument& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:shadow.Argument)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Argument::IsInitialized() const {
+  return true;
+}
+
+void Argument::InternalSwap(Argument* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.v_f_.InternalSwap(&other->_impl_.v_f_);
+  _impl_.v_i_.InternalSwap(&other->_impl_.v_i_);
+  _impl_.v_s_.InternalSwap(&other->_impl_.v_s_);
+  _impl_.v_l_.InternalSwap(&other->_impl_.v_l_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.s_s_, lhs_arena,
+      &other->_impl_.s_s_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Argument, _impl_.s_l_)
+      + sizeof(Argument::_impl_.s_l_)
+      - PROTOBUF_FIELD_OFFSET(Argument, _impl_.s_f_)>(
+          reinterpret_cast<char*>(&_impl_.s_f_),
+          reinterpret_cast<char*>(&other->_impl_.s_f_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Argument::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_shadow_2eproto_getter, &descriptor_table_shadow_2eproto_once,
+      file_level_metadata_shadow_2eproto[1]);
+}
+
+// ===================================================================
+
+class OpParam::_Internal {
+ public:
+  using HasBits = decltype(std::declval<OpParam>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+OpParam::OpParam(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:shadow.OpParam)
+}
+OpParam::OpParam(const OpParam& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  OpParam* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.bottom_){from._impl_.bottom_}
+    , decltype(_impl_.top_){from._impl_.top_}
+    , decltype(_impl_.arg_){from._impl_.arg_}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.type_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_type()) {
+    _this->_impl_.type_.Set(from._internal_type(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:shadow.OpParam)
+}
+
+inline void OpParam::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.bottom_){arena}
+    , decltype(_impl_.top_){arena}
+    , decltype(_impl_.arg_){arena}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.type_){}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+OpParam::~OpParam() {
+  // @@protoc_insertion_point(destructor:shadow.OpParam)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void OpParam::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.bottom_.~RepeatedPtrField();
+  _impl_.top_.~RepeatedPtrField();
+  _impl_.arg_.~RepeatedPtrField();
+  _impl_.name_.Destroy();
+  _impl_.type_.Destroy();
+}
+
+void OpParam::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void OpParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:shadow.OpParam)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.bottom_.Clear();
+  _impl_.top_.Clear();
+  _impl_.arg_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.type_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* OpParam::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "shadow.OpParam.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string type = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_type();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "shadow.OpParam.type");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string bottom = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_bottom();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "shadow.OpParam.bottom");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string top = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_top();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "shadow.OpParam.top");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .shadow.Argument arg = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_arg(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<90>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* OpParam::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:shadow.OpParam)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "shadow.OpParam.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // optional string type = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_type().data(), static_cast<int>(this->_internal_type().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "shadow.OpParam.type");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_type(), target);
+  }
+
+  // repeated string bottom = 3;
+  for (int i = 0, n = this->_internal_bottom_size(); i < n; i++) {
+    const auto& s = this->_internal_bottom(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "shadow.OpParam.bottom");
+    target = stream->WriteString(3, s, target);
+  }
+
+  // repeated string top = 4;
+  for (int i = 0, n = this->_internal_top_size(); i < n; i++) {
+    const auto& s = this->_internal_top(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "shadow.OpParam.top");
+    target = stream->WriteString(4, s, target);
+  }
+
+  // repeated .shadow.Argument arg = 11;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_arg_size()); i < n; i++) {
+    const auto& repfield = this->_internal_arg(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(11, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:shadow.OpParam)
+  return target;
+}
+
+size_t OpParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:shadow.OpParam)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string bottom = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.bottom_.size());
+  for (int i = 0, n = _impl_.bottom_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.bottom_.Get(i));
+  }
+
+  // repeated string top = 4;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.top_.size());
+  for (int i = 0, n = _impl_.top_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.top_.Get(i));
+  }
+
+  // repeated .shadow.Argument arg = 11;
+  total_size += 1UL * this->_internal_arg_size();
+  for (const auto& msg : this->_impl_.arg_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional string name = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_name());
+    }
+
+    // optional string type = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_type());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData OpParam::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    OpParam::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*OpParam::GetClassData() const { return &_class_data_; }
+
+
+void OpParam::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<OpParam*>(&to_msg);
+  auto& from = static_cast<const OpParam&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:shadow.OpParam)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.bottom_.MergeFrom(from._impl_.bottom_);
+  _this->_impl_.top_.MergeFrom(from._impl_.top_);
+  _this->_impl_.arg_.MergeFrom(from._impl_.arg_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_type(from._internal_type());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void OpParam::CopyFrom(const OpParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:shadow.OpParam)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool OpParam::IsInitialized() const {
+  return true;
+}
+
+void OpParam::InternalSwap(OpParam* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.bottom_.InternalSwap(&other->_impl_.bottom_);
+  _impl_.top_.InternalSwap(&other->_impl_.top_);
+  _impl_.arg_.InternalSwap(&other->_impl_.arg_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.type_, lhs_arena,
+      &other->_impl_.type_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata OpParam::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_shadow_2eproto_getter, &descriptor_table_shadow_2eproto_once,
+      file_level_metadata_shadow_2eproto[2]);
+}
+
+// ===================================================================
+
+class NetParam::_Internal {
+ public:
+  using HasBits = decltype(std::declval<NetParam>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+NetParam::NetParam(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:shadow.NetParam)
+}
+NetParam::NetParam(const NetParam& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  NetParam* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.blob_){from._impl_.blob_}
+    , decltype(_impl_.op_){from._impl_.op_}
+    , decltype(_impl_.arg_){from._impl_.arg_}
+    , decltype(_impl_.name_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:shadow.NetParam)
+}
+
+inline void NetParam::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.blob_){arena}
+    , decltype(_impl_.op_){arena}
+    , decltype(_impl_.arg_){arena}
+    , decltype(_impl_.name_){}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+NetParam::~NetParam() {
+  // @@protoc_insertion_point(destructor:shadow.NetParam)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void NetParam::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.blob_.~RepeatedPtrField();
+  _impl_.op_.~RepeatedPtrField();
+  _impl_.arg_.~RepeatedPtrField();
+  _impl_.name_.Destroy();
+}
+
+void NetParam::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void NetParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:shadow.NetParam)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.blob_.Clear();
+  _impl_.op_.Clear();
+  _impl_.arg_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.name_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* NetParam::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "shadow.NetParam.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .shadow.Blob blob = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_blob(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .shadow.OpParam op = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_op(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<90>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .shadow.Argument arg = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_arg(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<98>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* NetParam::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:shadow.NetParam)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "shadow.NetParam.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // repeated .shadow.Blob blob = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_blob_size()); i < n; i++) {
+    const auto& repfield = this->_internal_blob(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .shadow.OpParam op = 11;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_op_size()); i < n; i++) {
+    const auto& repfield = this->_internal_op(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(11, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .shadow.Argument arg = 12;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_arg_size()); i < n; i++) {
+    const auto& repfield = this->_internal_arg(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(12, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:shadow.NetParam)
+  return target;
+}
+
+size_t NetParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:shadow.NetParam)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .shadow.Blob blob = 5;
+  total_size += 1UL * this->_internal_blob_size();
+  for (const auto& msg : this->_impl_.blob_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .shadow.OpParam op = 11;
+  total_size += 1UL * this->_internal_op_size();
+  for (const auto& msg : this->_impl_.op_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .shadow.Argument arg = 12;
+  total_size += 1UL * this->_internal_arg_size();
+  for (const auto& msg : this->_impl_.arg_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // optional string name = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NetParam::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    NetParam::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NetParam::GetClassData() const { return &_class_data_; }
+
+
+void NetParam::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<NetParam*>(&to_msg);
+  auto& from = static_cast<const NetParam&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:shadow.NetParam)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.blob_.MergeFrom(from._impl_.blob_);
+  _this->_impl_.op_.MergeFrom(from._impl_.op_);
+  _this->_impl_.arg_.MergeFrom(from._impl_.arg_);
+  if (from._internal_has_name()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void NetParam::CopyFrom(const NetParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:shadow.NetParam)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool NetParam::IsInitialized() const {
+  return true;
+}
+
+void NetParam::InternalSwap(NetParam* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.blob_.InternalSwap(&other->_impl_.blob_);
+  _impl_.op_.InternalSwap(&other->_impl_.op_);
+  _impl_.arg_.InternalSwap(&other->_impl_.arg_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata NetParam::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_shadow_2eproto_getter, &descriptor_table_shadow_2eproto_once,
+      file_level_metadata_shadow_2eproto[3]);
+}
+
+// ===================================================================
+
+class MetaNetParam::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MetaNetParam>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+MetaNetParam::MetaNetParam(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:shadow.MetaNetParam)
+}
+MetaNetParam::MetaNetParam(const MetaNetParam& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MetaNetParam* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.network_){from._impl_.network_}
+    , decltype(_impl_.arg_){from._impl_.arg_}
+    , decltype(_impl_.name_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:shadow.MetaNetParam)
+}
+
+inline void MetaNetParam::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.network_){arena}
+    , decltype(_impl_.arg_){arena}
+    , decltype(_impl_.name_){}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+MetaNetParam::~MetaNetParam() {
+  // @@protoc_insertion_point(destructor:shadow.MetaNetParam)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MetaNetParam::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.network_.~RepeatedPtrField();
+  _impl_.arg_.~RepeatedPtrField();
+  _impl_.name_.Destroy();
+}
+
+void MetaNetParam::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MetaNetParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:shadow.MetaNetParam)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.network_.Clear();
+  _impl_.arg_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.name_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MetaNetParam::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "shadow.MetaNetParam.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .shadow.NetParam network = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_network(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<90>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .shadow.Argument arg = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_arg(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<98>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MetaNetParam::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:shadow.MetaNetParam)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "shadow.MetaNetParam.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // repeated .shadow.NetParam network = 11;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_network_size()); i < n; i++) {
+    const auto& repfield = this->_internal_network(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(11, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .shadow.Argument arg = 12;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_arg_size()); i < n; i++) {
+    const auto& repfield = this->_internal_arg(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(12, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:shadow.MetaNetParam)
+  return target;
+}
+
+size_t MetaNetParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:shadow.MetaNetParam)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .shadow.NetParam network = 11;
+  total_size += 1UL * this->_internal_network_size();
+  for (const auto& msg : this->_impl_.network_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .shadow.Argument arg = 12;
+  total_size += 1UL * this->_internal_arg_size();
+  for (const auto& msg : this->_impl_.arg_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // optional string name = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MetaNetParam::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MetaNetParam::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MetaNetParam::GetClassData() const { return &_class_data_; }
+
+
+void MetaNetParam::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MetaNetParam*>(&to_msg);
+  auto& from = static_cast<const MetaNetParam&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:shadow.MetaNetParam)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.network_.MergeFrom(from._impl_.network_);
+  _this->_impl_.arg_.MergeFrom(from._impl_.arg_);
+  if (from._internal_has_name()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MetaNetParam::CopyFrom(const MetaNetParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:shadow.MetaNetParam)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MetaNetParam::IsInitialized() const {
+  return true;
+}
+
+void MetaNetParam::InternalSwap(MetaNetParam* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.network_.InternalSwap(&other->_impl_.network_);
+  _impl_.arg_.InternalSwap(&other->_impl_.arg_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MetaNetParam::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_shadow_2eproto_getter, &descriptor_table_shadow_2eproto_once,
+      file_level_metadata_shadow_2eproto[4]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace shadow
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::shadow::Blob*
+Arena::CreateMaybeMessage< ::shadow::Blob >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::shadow::Blob >(arena);
+}
+template<> PROTOBUF_NOINLINE ::shadow::Argument*
+Arena::CreateMaybeMessage< ::shadow::Argument >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::shadow::Argument >(arena);
+}
+template<> PROTOBUF_NOINLINE ::shadow::OpParam*
+Arena::CreateMaybeMessage< ::shadow::OpParam >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::shadow::OpParam >(arena);
+}
+template<> PROTOBUF_NOINLINE ::shadow::NetParam*
+Arena::CreateMaybeMessage< ::shadow::NetParam >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::shadow::NetParam >(arena);
+}
+template<> PROTOBUF_NOINLINE ::shadow::MetaNetParam*
+Arena::CreateMaybeMessage< ::shadow::MetaNetParam >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::shadow::MetaNetParam >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,2868 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: shadow.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_shadow_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_shadow_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_shadow_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_shadow_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_shadow_2eproto;
+namespace shadow {
+class Argument;
+struct ArgumentDefaultTypeInternal;
+extern ArgumentDefaultTypeInternal _Argument_default_instance_;
+class Blob;
+struct BlobDefaultTypeInternal;
+extern BlobDefaultTypeInternal _Blob_default_instance_;
+class MetaNetParam;
+struct MetaNetParamDefaultTypeInternal;
+extern MetaNetParamDefaultTypeInternal _MetaNetParam_default_instance_;
+class NetParam;
+struct NetParamDefaultTypeInternal;
+extern NetParamDefaultTypeInternal _NetParam_default_instance_;
+class OpParam;
+struct OpParamDefaultTypeInternal;
+extern OpParamDefaultTypeInternal _OpParam_default_instance_;
+}  // namespace shadow
+PROTOBUF_NAMESPACE_OPEN
+template<> ::shadow::Argument* Arena::CreateMaybeMessage<::shadow::Argument>(Arena*);
+template<> ::shadow::Blob* Arena::CreateMaybeMessage<::shadow::Blob>(Arena*);
+template<> ::shadow::MetaNetParam* Arena::CreateMaybeMessage<::shadow::MetaNetParam>(Arena*);
+template<> ::shadow::NetParam* Arena::CreateMaybeMessage<::shadow::NetParam>(Arena*);
+template<> ::shadow::OpParam* Arena::CreateMaybeMessage<::shadow::OpParam>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace shadow {
+
+// ===================================================================
+
+class Blob final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:shadow.Blob) */ {
+ public:
+  inline Blob() : Blob(nullptr) {}
+  ~Blob() override;
+  explicit PROTOBUF_CONSTEXPR Blob(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Blob(const Blob& from);
+  Blob(Blob&& from) noexcept
+    : Blob() {
+    *this = ::std::move(from);
+  }
+
+  inline Blob& operator=(const Blob& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Blob& operator=(Blob&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Blob& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Blob* internal_default_instance() {
+    return reinterpret_cast<const Blob*>(
+               &_Blob_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Blob& a, Blob& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Blob* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Blob* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Blob* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Blob>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Blob& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Blob& from) {
+    Blob::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Blob* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "shadow.Blob";
+  }
+  protected:
+  explicit Blob(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kShapeFieldNumber = 3,
+    kDataFFieldNumber = 4,
+    kDataIFieldNumber = 5,
+    kDataBFieldNumber = 6,
+    kNameFieldNumber = 1,
+    kTypeFieldNumber = 2,
+  };
+  // repeated int32 shape = 3;
+  int shape_size() const;
+  private:
+  int _internal_shape_size() const;
+  public:
+  void clear_shape();
+  private:
+  int32_t _internal_shape(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_shape() const;
+  void _internal_add_shape(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_shape();
+  public:
+  int32_t shape(int index) const;
+  void set_shape(int index, int32_t value);
+  void add_shape(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      shape() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_shape();
+
+  // repeated float data_f = 4 [packed = true];
+  int data_f_size() const;
+  private:
+  int _internal_data_f_size() const;
+  public:
+  void clear_data_f();
+  private:
+  float _internal_data_f(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_data_f() const;
+  void _internal_add_data_f(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_data_f();
+  public:
+  float data_f(int index) const;
+  void set_data_f(int index, float value);
+  void add_data_f(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      data_f() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_data_f();
+
+  // repeated int32 data_i = 5 [packed = true];
+  int data_i_size() const;
+  private:
+  int _internal_data_i_size() const;
+  public:
+  void clear_data_i();
+  private:
+  int32_t _internal_data_i(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_data_i() const;
+  void _internal_add_data_i(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_data_i();
+  public:
+  int32_t data_i(int index) const;
+  void set_data_i(int index, int32_t value);
+  void add_data_i(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      data_i() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_data_i();
+
+  // repeated bytes data_b = 6;
+  int data_b_size() const;
+  private:
+  int _internal_data_b_size() const;
+  public:
+  void clear_data_b();
+  const std::string& data_b(int index) const;
+  std::string* mutable_data_b(int index);
+  void set_data_b(int index, const std::string& value);
+  void set_data_b(int index, std::string&& value);
+  void set_data_b(int index, const char* value);
+  void set_data_b(int index, const void* value, size_t size);
+  std::string* add_data_b();
+  void add_data_b(const std::string& value);
+  void add_data_b(std::string&& value);
+  void add_data_b(const char* value);
+  void add_data_b(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& data_b() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_data_b();
+  private:
+  const std::string& _internal_data_b(int index) const;
+  std::string* _internal_add_data_b();
+  public:
+
+  // optional string name = 1;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // optional string type = 2;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  const std::string& type() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_type(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_type();
+  PROTOBUF_NODISCARD std::string* release_type();
+  void set_allocated_type(std::string* type);
+  private:
+  const std::string& _internal_type() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_type(const std::string& value);
+  std::string* _internal_mutable_type();
+  public:
+
+  // @@protoc_insertion_point(class_scope:shadow.Blob)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > shape_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > data_f_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > data_i_;
+    mutable std::atomic<int> _data_i_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> data_b_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr type_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_shadow_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Argument final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:shadow.Argument) */ {
+ public:
+  inline Argument() : Argument(nullptr) {}
+  ~Argument() override;
+  explicit PROTOBUF_CONSTEXPR Argument(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Argument(const Argument& from);
+  Argument(Argument&& from) noexcept
+    : Argument() {
+    *this = ::std::move(from);
+  }
+
+  inline Argument& operator=(const Argument& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Argument& operator=(Argument&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Argument& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Argument* internal_default_instance() {
+    return reinterpret_cast<const Argument*>(
+               &_Argument_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Argument& a, Argument& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Argument* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Argument* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Argument* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Argument>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Argument& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Argument& from) {
+    Argument::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Argument* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "shadow.Argument";
+  }
+  protected:
+  explicit Argument(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kVFFieldNumber = 5,
+    kVIFieldNumber = 6,
+    kVSFieldNumber = 7,
+    kVLFieldNumber = 9,
+    kNameFieldNumber = 1,
+    kSSFieldNumber = 4,
+    kSFFieldNumber = 2,
+    kSIFieldNumber = 3,
+    kSLFieldNumber = 8,
+  };
+  // repeated float v_f = 5;
+  int v_f_size() const;
+  private:
+  int _internal_v_f_size() const;
+  public:
+  void clear_v_f();
+  private:
+  float _internal_v_f(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_v_f() const;
+  void _internal_add_v_f(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_v_f();
+  public:
+  float v_f(int index) const;
+  void set_v_f(int index, float value);
+  void add_v_f(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      v_f() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_v_f();
+
+  // repeated int32 v_i = 6;
+  int v_i_size() const;
+  private:
+  int _internal_v_i_size() const;
+  public:
+  void clear_v_i();
+  private:
+  int32_t _internal_v_i(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_v_i() const;
+  void _internal_add_v_i(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_v_i();
+  public:
+  int32_t v_i(int index) const;
+  void set_v_i(int index, int32_t value);
+  void add_v_i(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      v_i() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_v_i();
+
+  // repeated string v_s = 7;
+  int v_s_size() const;
+  private:
+  int _internal_v_s_size() const;
+  public:
+  void clear_v_s();
+  const std::string& v_s(int index) const;
+  std::string* mutable_v_s(int index);
+  void set_v_s(int index, const std::string& value);
+  void set_v_s(int index, std::string&& value);
+  void set_v_s(int index, const char* value);
+  void set_v_s(int index, const char* value, size_t size);
+  std::string* add_v_s();
+  void add_v_s(const std::string& value);
+  void add_v_s(std::string&& value);
+  void add_v_s(const char* value);
+  void add_v_s(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& v_s() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_v_s();
+  private:
+  const std::string& _internal_v_s(int index) const;
+  std::string* _internal_add_v_s();
+  public:
+
+  // repeated int64 v_l = 9;
+  int v_l_size() const;
+  private:
+  int _internal_v_l_size() const;
+  public:
+  void clear_v_l();
+  private:
+  int64_t _internal_v_l(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      _internal_v_l() const;
+  void _internal_add_v_l(int64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      _internal_mutable_v_l();
+  public:
+  int64_t v_l(int index) const;
+  void set_v_l(int index, int64_t value);
+  void add_v_l(int64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      v_l() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      mutable_v_l();
+
+  // optional string name = 1;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // optional string s_s = 4;
+  bool has_s_s() const;
+  private:
+  bool _internal_has_s_s() const;
+  public:
+  void clear_s_s();
+  const std::string& s_s() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_s_s(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_s_s();
+  PROTOBUF_NODISCARD std::string* release_s_s();
+  void set_allocated_s_s(std::string* s_s);
+  private:
+  const std::string& _internal_s_s() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_s_s(const std::string& value);
+  std::string* _internal_mutable_s_s();
+  public:
+
+  // optional float s_f = 2;
+  bool has_s_f() const;
+  private:
+  bool _internal_has_s_f() const;
+  public:
+  void clear_s_f();
+  float s_f() const;
+  void set_s_f(float value);
+  private:
+  float _internal_s_f() const;
+  void _internal_set_s_f(float value);
+  public:
+
+  // optional int32 s_i = 3;
+  bool has_s_i() const;
+  private:
+  bool _internal_has_s_i() const;
+  public:
+  void clear_s_i();
+  int32_t s_i() const;
+  void set_s_i(int32_t value);
+  private:
+  int32_t _internal_s_i() const;
+  void _internal_set_s_i(int32_t value);
+  public:
+
+  // optional int64 s_l = 8;
+  bool has_s_l() const;
+  private:
+  bool _internal_has_s_l() const;
+  public:
+  void clear_s_l();
+  int64_t s_l() const;
+  void set_s_l(int64_t value);
+  private:
+  int64_t _internal_s_l() const;
+  void _internal_set_s_l(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:shadow.Argument)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > v_f_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > v_i_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> v_s_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t > v_l_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr s_s_;
+    float s_f_;
+    int32_t s_i_;
+    int64_t s_l_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_shadow_2eproto;
+};
+// -------------------------------------------------------------------
+
+class OpParam final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:shadow.OpParam) */ {
+ public:
+  inline OpParam() : OpParam(nullptr) {}
+  ~OpParam() override;
+  explicit PROTOBUF_CONSTEXPR OpParam(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  OpParam(const OpParam& from);
+  OpParam(OpParam&& from) noexcept
+    : OpParam() {
+    *this = ::std::move(from);
+  }
+
+  inline OpParam& operator=(const OpParam& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline OpParam& operator=(OpParam&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const OpParam& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const OpParam* internal_default_instance() {
+    return reinterpret_cast<const OpParam*>(
+               &_OpParam_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(OpParam& a, OpParam& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(OpParam* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(OpParam* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  OpParam* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<OpParam>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const OpParam& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const OpParam& from) {
+    OpParam::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(OpParam* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "shadow.OpParam";
+  }
+  protected:
+  explicit OpParam(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBottomFieldNumber = 3,
+    kTopFieldNumber = 4,
+    kArgFieldNumber = 11,
+    kNameFieldNumber = 1,
+    kTypeFieldNumber = 2,
+  };
+  // repeated string bottom = 3;
+  int bottom_size() const;
+  private:
+  int _internal_bottom_size() const;
+  public:
+  void clear_bottom();
+  const std::string& bottom(int index) const;
+  std::string* mutable_bottom(int index);
+  void set_bottom(int index, const std::string& value);
+  void set_bottom(int index, std::string&& value);
+  void set_bottom(int index, const char* value);
+  void set_bottom(int index, const char* value, size_t size);
+  std::string* add_bottom();
+  void add_bottom(const std::string& value);
+  void add_bottom(std::string&& value);
+  void add_bottom(const char* value);
+  void add_bottom(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& bottom() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_bottom();
+  private:
+  const std::string& _internal_bottom(int index) const;
+  std::string* _internal_add_bottom();
+  public:
+
+  // repeated string top = 4;
+  int top_size() const;
+  private:
+  int _internal_top_size() const;
+  public:
+  void clear_top();
+  const std::string& top(int index) const;
+  std::string* mutable_top(int index);
+  void set_top(int index, const std::string& value);
+  void set_top(int index, std::string&& value);
+  void set_top(int index, const char* value);
+  void set_top(int index, const char* value, size_t size);
+  std::string* add_top();
+  void add_top(const std::string& value);
+  void add_top(std::string&& value);
+  void add_top(const char* value);
+  void add_top(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& top() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_top();
+  private:
+  const std::string& _internal_top(int index) const;
+  std::string* _internal_add_top();
+  public:
+
+  // repeated .shadow.Argument arg = 11;
+  int arg_size() const;
+  private:
+  int _internal_arg_size() const;
+  public:
+  void clear_arg();
+  ::shadow::Argument* mutable_arg(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::shadow::Argument >*
+      mutable_arg();
+  private:
+  const ::shadow::Argument& _internal_arg(int index) const;
+  ::shadow::Argument* _internal_add_arg();
+  public:
+  const ::shadow::Argument& arg(int index) const;
+  ::shadow::Argument* add_arg();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::shadow::Argument >&
+      arg() const;
+
+  // optional string name = 1;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // optional string type = 2;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  const std::string& type() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_type(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_type();
+  PROTOBUF_NODISCARD std::string* release_type();
+  void set_allocated_type(std::string* type);
+  private:
+  const std::string& _internal_type() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_type(const std::string& value);
+  std::string* _internal_mutable_type();
+  public:
+
+  // @@protoc_insertion_point(class_scope:shadow.OpParam)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> bottom_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> top_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::shadow::Argument > arg_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr type_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_shadow_2eproto;
+};
+// -------------------------------------------------------------------
+
+class NetParam final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:shadow.NetParam) */ {
+ public:
+  inline NetParam() : NetParam(nullptr) {}
+  ~NetParam() override;
+  explicit PROTOBUF_CONSTEXPR NetParam(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  NetParam(const NetParam& from);
+  NetParam(NetParam&& from) noexcept
+    : NetParam() {
+    *this = ::std::move(from);
+  }
+
+  inline NetParam& operator=(const NetParam& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline NetParam& operator=(NetParam&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NetParam& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const NetParam* internal_default_instance() {
+    return reinterpret_cast<const NetParam*>(
+               &_NetParam_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(NetParam& a, NetParam& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(NetParam* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NetParam* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  NetParam* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<NetParam>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const NetParam& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const NetParam& from) {
+    NetParam::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(NetParam* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "shadow.NetParam";
+  }
+  protected:
+  explicit NetParam(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBlobFieldNumber = 5,
+    kOpFieldNumber = 11,
+    kArgFieldNumber = 12,
+    kNameFieldNumber = 1,
+  };
+  // repeated .shadow.Blob blob = 5;
+  int blob_size() const;
+  private:
+  int _internal_blob_size() const;
+  public:
+  void clear_blob();
+  ::shadow::Blob* mutable_blob(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::shadow::Blob >*
+      mutable_blob();
+  private:
+  const ::shadow::Blob& _internal_blob(int index) const;
+  ::shadow::Blob* _internal_add_blob();
+  public:
+  const ::shadow::Blob& blob(int index) const;
+  ::shadow::Blob* add_blob();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::shadow::Blob >&
+      blob() const;
+
+  // repeated .shadow.OpParam op = 11;
+  int op_size() const;
+  private:
+  int _internal_op_size() const;
+  public:
+  void clear_op();
+  ::shadow::OpParam* mutable_op(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::shadow::OpParam >*
+      mutable_op();
+  private:
+  const ::shadow::OpParam& _internal_op(int index) const;
+  ::shadow::OpParam* _internal_add_op();
+  public:
+  const ::shadow::OpParam& op(int index) const;
+  ::shadow::OpParam* add_op();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::shadow::OpParam >&
+      op() const;
+
+  // repeated .shadow.Argument arg = 12;
+  int arg_size() const;
+  private:
+  int _internal_arg_size() const;
+  public:
+  void clear_arg();
+  ::shadow::Argument* mutable_arg(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::shadow::Argument >*
+      mutable_arg();
+  private:
+  const ::shadow::Argument& _internal_arg(int index) const;
+  ::shadow::Argument* _internal_add_arg();
+  public:
+  const ::shadow::Argument& arg(int index) const;
+  ::shadow::Argument* add_arg();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::shadow::Argument >&
+      arg() const;
+
+  // optional string name = 1;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // @@protoc_insertion_point(class_scope:shadow.NetParam)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::shadow::Blob > blob_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::shadow::OpParam > op_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::shadow::Argument > arg_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_shadow_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MetaNetParam final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:shadow.MetaNetParam) */ {
+ public:
+  inline MetaNetParam() : MetaNetParam(nullptr) {}
+  ~MetaNetParam() override;
+  explicit PROTOBUF_CONSTEXPR MetaNetParam(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MetaNetParam(const MetaNetParam& from);
+  MetaNetParam(MetaNetParam&& from) noexcept
+    : MetaNetParam() {
+    *this = ::std::move(from);
+  }
+
+  inline MetaNetParam& operator=(const MetaNetParam& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MetaNetParam& operator=(MetaNetParam&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MetaNetParam& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MetaNetParam* internal_default_instance() {
+    return reinterpret_cast<const MetaNetParam*>(
+               &_MetaNetParam_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(MetaNetParam& a, MetaNetParam& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MetaNetParam* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MetaNetParam* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MetaNetParam* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MetaNetParam>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MetaNetParam& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MetaNetParam& from) {
+    MetaNetParam::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MetaNetParam* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "shadow.MetaNetParam";
+  }
+  protected:
+  explicit MetaNetParam(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNetworkFieldNumber = 11,
+    kArgFieldNumber = 12,
+    kNameFieldNumber = 1,
+  };
+  // repeated .shadow.NetParam network = 11;
+  int network_size() const;
+  private:
+  int _internal_network_size() const;
+  public:
+  void clear_network();
+  ::shadow::NetParam* mutable_network(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::shadow::NetParam >*
+      mutable_network();
+  private:
+  const ::shadow::NetParam& _internal_network(int index) const;
+  ::shadow::NetParam* _internal_add_network();
+  public:
+  const ::shadow::NetParam& network(int index) const;
+  ::shadow::NetParam* add_network();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::shadow::NetParam >&
+      network() const;
+
+  // repeated .shadow.Argument arg = 12;
+  int arg_size() const;
+  private:
+  int _internal_arg_size() const;
+  public:
+  void clear_arg();
+  ::shadow::Argument* mutable_arg(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::shadow::Argument >*
+      mutable_arg();
+  private:
+  const ::shadow::Argument& _internal_arg(int index) const;
+  ::shadow::Argument* _internal_add_arg();
+  public:
+  const ::shadow::Argument& arg(int index) const;
+  ::shadow::Argument* add_arg();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::shadow::Argument >&
+      arg() const;
+
+  // optional string name = 1;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // @@protoc_insertion_point(class_scope:shadow.MetaNetParam)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::shadow::NetParam > network_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::shadow::Argument > arg_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_shadow_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Blob
+
+// optional string name = 1;
+inline bool Blob::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Blob::has_name() const {
+  return _internal_has_name();
+}
+inline void Blob::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Blob::name() const {
+  // @@protoc_insertion_point(field_get:shadow.Blob.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Blob::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:shadow.Blob.name)
+}
+inline std::string* Blob::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:shadow.Blob.name)
+  return _s;
+}
+inline const std::string& Blob::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void Blob::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Blob::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Blob::release_name() {
+  // @@protoc_insertion_point(field_release:shadow.Blob.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Blob::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:shadow.Blob.name)
+}
+
+// optional string type = 2;
+inline bool Blob::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Blob::has_type() const {
+  return _internal_has_type();
+}
+inline void Blob::clear_type() {
+  _impl_.type_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Blob::type() const {
+  // @@protoc_insertion_point(field_get:shadow.Blob.type)
+  return _internal_type();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Blob::set_type(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.type_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:shadow.Blob.type)
+}
+inline std::string* Blob::mutable_type() {
+  std::string* _s = _internal_mutable_type();
+  // @@protoc_insertion_point(field_mutable:shadow.Blob.type)
+  return _s;
+}
+inline const std::string& Blob::_internal_type() const {
+  return _impl_.type_.Get();
+}
+inline void Blob::_internal_set_type(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.type_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Blob::_internal_mutable_type() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.type_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Blob::release_type() {
+  // @@protoc_insertion_point(field_release:shadow.Blob.type)
+  if (!_internal_has_type()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.type_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.type_.IsDefault()) {
+    _impl_.type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Blob::set_allocated_type(std::string* type) {
+  if (type != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.type_.SetAllocated(type, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.type_.IsDefault()) {
+    _impl_.type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:shadow.Blob.type)
+}
+
+// repeated int32 shape = 3;
+inline int Blob::_internal_shape_size() const {
+  return _impl_.shape_.size();
+}
+inline int Blob::shape_size() const {
+  return _internal_shape_size();
+}
+inline void Blob::clear_shape() {
+  _impl_.shape_.Clear();
+}
+inline int32_t Blob::_internal_shape(int index) const {
+  return _impl_.shape_.Get(index);
+}
+inline int32_t Blob::shape(int index) const {
+  // @@protoc_insertion_point(field_get:shadow.Blob.shape)
+  return _internal_shape(index);
+}
+inline void Blob::set_shape(int index, int32_t value) {
+  _impl_.shape_.Set(index, value);
+  // @@protoc_insertion_point(field_set:shadow.Blob.shape)
+}
+inline void Blob::_internal_add_shape(int32_t value) {
+  _impl_.shape_.Add(value);
+}
+inline void Blob::add_shape(int32_t value) {
+  _internal_add_shape(value);
+  // @@protoc_insertion_point(field_add:shadow.Blob.shape)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+Blob::_internal_shape() const {
+  return _impl_.shape_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+Blob::shape() const {
+  // @@protoc_insertion_point(field_list:shadow.Blob.shape)
+  return _internal_shape();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+Blob::_internal_mutable_shape() {
+  return &_impl_.shape_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+Blob::mutable_shape() {
+  // @@protoc_insertion_point(field_mutable_list:shadow.Blob.shape)
+  return _internal_mutable_shape();
+}
+
+// repeated float data_f = 4 [packed = true];
+inline int Blob::_internal_data_f_size() const {
+  return _impl_.data_f_.size();
+}
+inline int Blob::data_f_size() const {
+  return _internal_data_f_size();
+}
+inline void Blob::clear_data_f() {
+  _impl_.data_f_.Clear();
+}
+inline float Blob::_internal_data_f(int index) const {
+  return _impl_.data_f_.Get(index);
+}
+inline float Blob::data_f(int index) const {
+  // @@protoc_insertion_point(field_get:shadow.Blob.data_f)
+  return _internal_data_f(index);
+}
+inline void Blob::set_data_f(int index, float value) {
+  _impl_.data_f_.Set(index, value);
+  // @@protoc_insertion_point(field_set:shadow.Blob.data_f)
+}
+inline void Blob::_internal_add_data_f(float value) {
+  _impl_.data_f_.Add(value);
+}
+inline void Blob::add_data_f(float value) {
+  _internal_add_data_f(value);
+  // @@protoc_insertion_point(field_add:shadow.Blob.data_f)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+Blob::_internal_data_f() const {
+  return _impl_.data_f_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+Blob::data_f() const {
+  // @@protoc_insertion_point(field_list:shadow.Blob.data_f)
+  return _internal_data_f();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+Blob::_internal_mutable_data_f() {
+  return &_impl_.data_f_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+Blob::mutable_data_f() {
+  // @@protoc_insertion_point(field_mutable_list:shadow.Blob.data_f)
+  return _internal_mutable_data_f();
+}
+
+// repeated int32 data_i = 5 [packed = true];
+inline int Blob::_internal_data_i_size() const {
+  return _impl_.data_i_.size();
+}
+inline int Blob::data_i_size() const {
+  return _internal_data_i_size();
+}
+inline void Blob::clear_data_i() {
+  _impl_.data_i_.Clear();
+}
+inline int32_t Blob::_internal_data_i(int index) const {
+  return _impl_.data_i_.Get(index);
+}
+inline int32_t Blob::data_i(int index) const {
+  // @@protoc_insertion_point(field_get:shadow.Blob.data_i)
+  return _internal_data_i(index);
+}
+inline void Blob::set_data_i(int index, int32_t value) {
+  _impl_.data_i_.Set(index, value);
+  // @@protoc_insertion_point(field_set:shadow.Blob.data_i)
+}
+inline void Blob::_internal_add_data_i(int32_t value) {
+  _impl_.data_i_.Add(value);
+}
+inline void Blob::add_data_i(int32_t value) {
+  _internal_add_data_i(value);
+  // @@protoc_insertion_point(field_add:shadow.Blob.data_i)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+Blob::_internal_data_i() const {
+  return _impl_.data_i_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+Blob::data_i() const {
+  // @@protoc_insertion_point(field_list:shadow.Blob.data_i)
+  return _internal_data_i();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+Blob::_internal_mutable_data_i() {
+  return &_impl_.data_i_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+Blob::mutable_data_i() {
+  // @@protoc_insertion_point(field_mutable_list:shadow.Blob.data_i)
+  return _internal_mutable_data_i();
+}
+
+// repeated bytes data_b = 6;
+inline int Blob::_internal_data_b_size() const {
+  return _impl_.data_b_.size();
+}
+inline int Blob::data_b_size() const {
+  return _internal_data_b_size();
+}
+inline void Blob::clear_data_b() {
+  _impl_.data_b_.Clear();
+}
+inline std::string* Blob::add_data_b() {
+  std::string* _s = _internal_add_data_b();
+  // @@protoc_insertion_point(field_add_mutable:shadow.Blob.data_b)
+  return _s;
+}
+inline const std::string& Blob::_internal_data_b(int index) const {
+  return _impl_.data_b_.Get(index);
+}
+inline const std::string& Blob::data_b(int index) const {
+  // @@protoc_insertion_point(field_get:shadow.Blob.data_b)
+  return _internal_data_b(index);
+}
+inline std::string* Blob::mutable_data_b(int index) {
+  // @@protoc_insertion_point(field_mutable:shadow.Blob.data_b)
+  return _impl_.data_b_.Mutable(index);
+}
+inline void Blob::set_data_b(int index, const std::string& value) {
+  _impl_.data_b_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:shadow.Blob.data_b)
+}
+inline void Blob::set_data_b(int index, std::string&& value) {
+  _impl_.data_b_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:shadow.Blob.data_b)
+}
+inline void Blob::set_data_b(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.data_b_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:shadow.Blob.data_b)
+}
+inline void Blob::set_data_b(int index, const void* value, size_t size) {
+  _impl_.data_b_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:shadow.Blob.data_b)
+}
+inline std::string* Blob::_internal_add_data_b() {
+  return _impl_.data_b_.Add();
+}
+inline void Blob::add_data_b(const std::string& value) {
+  _impl_.data_b_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:shadow.Blob.data_b)
+}
+inline void Blob::add_data_b(std::string&& value) {
+  _impl_.data_b_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:shadow.Blob.data_b)
+}
+inline void Blob::add_data_b(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.data_b_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:shadow.Blob.data_b)
+}
+inline void Blob::add_data_b(const void* value, size_t size) {
+  _impl_.data_b_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:shadow.Blob.data_b)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+Blob::data_b() const {
+  // @@protoc_insertion_point(field_list:shadow.Blob.data_b)
+  return _impl_.data_b_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+Blob::mutable_data_b() {
+  // @@protoc_insertion_point(field_mutable_list:shadow.Blob.data_b)
+  return &_impl_.data_b_;
+}
+
+// -------------------------------------------------------------------
+
+// Argument
+
+// optional string name = 1;
+inline bool Argument::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Argument::has_name() const {
+  return _internal_has_name();
+}
+inline void Argument::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Argument::name() const {
+  // @@protoc_insertion_point(field_get:shadow.Argument.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Argument::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:shadow.Argument.name)
+}
+inline std::string* Argument::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:shadow.Argument.name)
+  return _s;
+}
+inline const std::string& Argument::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void Argument::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Argument::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Argument::release_name() {
+  // @@protoc_insertion_point(field_release:shadow.Argument.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Argument::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:shadow.Argument.name)
+}
+
+// optional float s_f = 2;
+inline bool Argument::_internal_has_s_f() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Argument::has_s_f() const {
+  return _internal_has_s_f();
+}
+inline void Argument::clear_s_f() {
+  _impl_.s_f_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline float Argument::_internal_s_f() const {
+  return _impl_.s_f_;
+}
+inline float Argument::s_f() const {
+  // @@protoc_insertion_point(field_get:shadow.Argument.s_f)
+  return _internal_s_f();
+}
+inline void Argument::_internal_set_s_f(float value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.s_f_ = value;
+}
+inline void Argument::set_s_f(float value) {
+  _internal_set_s_f(value);
+  // @@protoc_insertion_point(field_set:shadow.Argument.s_f)
+}
+
+// optional int32 s_i = 3;
+inline bool Argument::_internal_has_s_i() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Argument::has_s_i() const {
+  return _internal_has_s_i();
+}
+inline void Argument::clear_s_i() {
+  _impl_.s_i_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t Argument::_internal_s_i() const {
+  return _impl_.s_i_;
+}
+inline int32_t Argument::s_i() const {
+  // @@protoc_insertion_point(field_get:shadow.Argument.s_i)
+  return _internal_s_i();
+}
+inline void Argument::_internal_set_s_i(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.s_i_ = value;
+}
+inline void Argument::set_s_i(int32_t value) {
+  _internal_set_s_i(value);
+  // @@protoc_insertion_point(field_set:shadow.Argument.s_i)
+}
+
+// optional string s_s = 4;
+inline bool Argument::_internal_has_s_s() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Argument::has_s_s() const {
+  return _internal_has_s_s();
+}
+inline void Argument::clear_s_s() {
+  _impl_.s_s_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Argument::s_s() const {
+  // @@protoc_insertion_point(field_get:shadow.Argument.s_s)
+  return _internal_s_s();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Argument::set_s_s(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.s_s_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:shadow.Argument.s_s)
+}
+inline std::string* Argument::mutable_s_s() {
+  std::string* _s = _internal_mutable_s_s();
+  // @@protoc_insertion_point(field_mutable:shadow.Argument.s_s)
+  return _s;
+}
+inline const std::string& Argument::_internal_s_s() const {
+  return _impl_.s_s_.Get();
+}
+inline void Argument::_internal_set_s_s(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.s_s_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Argument::_internal_mutable_s_s() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.s_s_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Argument::release_s_s() {
+  // @@protoc_insertion_point(field_release:shadow.Argument.s_s)
+  if (!_internal_has_s_s()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.s_s_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.s_s_.IsDefault()) {
+    _impl_.s_s_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Argument::set_allocated_s_s(std::string* s_s) {
+  if (s_s != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.s_s_.SetAllocated(s_s, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.s_s_.IsDefault()) {
+    _impl_.s_s_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:shadow.Argument.s_s)
+}
+
+// repeated float v_f = 5;
+inline int Argument::_internal_v_f_size() const {
+  return _impl_.v_f_.size();
+}
+inline int Argument::v_f_size() const {
+  return _internal_v_f_size();
+}
+inline void Argument::clear_v_f() {
+  _impl_.v_f_.Clear();
+}
+inline float Argument::_internal_v_f(int index) const {
+  return _impl_.v_f_.Get(index);
+}
+inline float Argument::v_f(int index) const {
+  // @@protoc_insertion_point(field_get:shadow.Argument.v_f)
+  return _internal_v_f(index);
+}
+inline void Argument::set_v_f(int index, float value) {
+  _impl_.v_f_.Set(index, value);
+  // @@protoc_insertion_point(field_set:shadow.Argument.v_f)
+}
+inline void Argument::_internal_add_v_f(float value) {
+  _impl_.v_f_.Add(value);
+}
+inline void Argument::add_v_f(float value) {
+  _internal_add_v_f(value);
+  // @@protoc_insertion_point(field_add:shadow.Argument.v_f)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+Argument::_internal_v_f() const {
+  return _impl_.v_f_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+Argument::v_f() const {
+  // @@protoc_insertion_point(field_list:shadow.Argument.v_f)
+  return _internal_v_f();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+Argument::_internal_mutable_v_f() {
+  return &_impl_.v_f_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+Argument::mutable_v_f() {
+  // @@protoc_insertion_point(field_mutable_list:shadow.Argument.v_f)
+  return _internal_mutable_v_f();
+}
+
+// repeated int32 v_i = 6;
+inline int Argument::_internal_v_i_size() const {
+  return _impl_.v_i_.size();
+}
+inline int Argument::v_i_size() const {
+  return _internal_v_i_size();
+}
+inline void Argument::clear_v_i() {
+  _impl_.v_i_.Clear();
+}
+inline int32_t Argument::_internal_v_i(int index) const {
+  return _impl_.v_i_.Get(index);
+}
+inline int32_t Argument::v_i(int index) const {
+  // @@protoc_insertion_point(field_get:shadow.Argument.v_i)
+  return _internal_v_i(index);
+}
+inline void Argument::set_v_i(int index, int32_t value) {
+  _impl_.v_i_.Set(index, value);
+  // @@protoc_insertion_point(field_set:shadow.Argument.v_i)
+}
+inline void Argument::_internal_add_v_i(int32_t value) {
+  _impl_.v_i_.Add(value);
+}
+inline void Argument::add_v_i(int32_t value) {
+  _internal_add_v_i(value);
+  // @@protoc_insertion_point(field_add:shadow.Argument.v_i)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+Argument::_internal_v_i() const {
+  return _impl_.v_i_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+Argument::v_i() const {
+  // @@protoc_insertion_point(field_list:shadow.Argument.v_i)
+  return _internal_v_i();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+Argument::_internal_mutable_v_i() {
+  return &_impl_.v_i_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+Argument::mutable_v_i() {
+  // @@protoc_insertion_point(field_mutable_list:shadow.Argument.v_i)
+  return _internal_mutable_v_i();
+}
+
+// repeated string v_s = 7;
+inline int Argument::_internal_v_s_size() const {
+  return _impl_.v_s_.size();
+}
+inline int Argument::v_s_size() const {
+  return _internal_v_s_size();
+}
+inline void Argument::clear_v_s() {
+  _impl_.v_s_.Clear();
+}
+inline std::string* Argument::add_v_s() {
+  std::string* _s = _internal_add_v_s();
+  // @@protoc_insertion_point(field_add_mutable:shadow.Argument.v_s)
+  return _s;
+}
+inline const std::string& Argument::_internal_v_s(int index) const {
+  return _impl_.v_s_.Get(index);
+}
+inline const std::string& Argument::v_s(int index) const {
+  // @@protoc_insertion_point(field_get:shadow.Argument.v_s)
+  return _internal_v_s(index);
+}
+inline std::string* Argument::mutable_v_s(int index) {
+  // @@protoc_insertion_point(field_mutable:shadow.Argument.v_s)
+  return _impl_.v_s_.Mutable(index);
+}
+inline void Argument::set_v_s(int index, const std::string& value) {
+  _impl_.v_s_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:shadow.Argument.v_s)
+}
+inline void Argument::set_v_s(int index, std::string&& value) {
+  _impl_.v_s_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:shadow.Argument.v_s)
+}
+inline void Argument::set_v_s(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.v_s_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:shadow.Argument.v_s)
+}
+inline void Argument::set_v_s(int index, const char* value, size_t size) {
+  _impl_.v_s_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:shadow.Argument.v_s)
+}
+inline std::string* Argument::_internal_add_v_s() {
+  return _impl_.v_s_.Add();
+}
+inline void Argument::add_v_s(const std::string& value) {
+  _impl_.v_s_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:shadow.Argument.v_s)
+}
+inline void Argument::add_v_s(std::string&& value) {
+  _impl_.v_s_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:shadow.Argument.v_s)
+}
+inline void Argument::add_v_s(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.v_s_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:shadow.Argument.v_s)
+}
+inline void Argument::add_v_s(const char* value, size_t size) {
+  _impl_.v_s_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:shadow.Argument.v_s)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+Argument::v_s() const {
+  // @@protoc_insertion_point(field_list:shadow.Argument.v_s)
+  return _impl_.v_s_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+Argument::mutable_v_s() {
+  // @@protoc_insertion_point(field_mutable_list:shadow.Argument.v_s)
+  return &_impl_.v_s_;
+}
+
+// optional int64 s_l = 8;
+inline bool Argument::_internal_has_s_l() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Argument::has_s_l() const {
+  return _internal_has_s_l();
+}
+inline void Argument::clear_s_l() {
+  _impl_.s_l_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline int64_t Argument::_internal_s_l() const {
+  return _impl_.s_l_;
+}
+inline int64_t Argument::s_l() const {
+  // @@protoc_insertion_point(field_get:shadow.Argument.s_l)
+  return _internal_s_l();
+}
+inline void Argument::_internal_set_s_l(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.s_l_ = value;
+}
+inline void Argument::set_s_l(int64_t value) {
+  _internal_set_s_l(value);
+  // @@protoc_insertion_point(field_set:shadow.Argument.s_l)
+}
+
+// repeated int64 v_l = 9;
+inline int Argument::_internal_v_l_size() const {
+  return _impl_.v_l_.size();
+}
+inline int Argument::v_l_size() const {
+  return _internal_v_l_size();
+}
+inline void Argument::clear_v_l() {
+  _impl_.v_l_.Clear();
+}
+inline int64_t Argument::_internal_v_l(int index) const {
+  return _impl_.v_l_.Get(index);
+}
+inline int64_t Argument::v_l(int index) const {
+  // @@protoc_insertion_point(field_get:shadow.Argument.v_l)
+  return _internal_v_l(index);
+}
+inline void Argument::set_v_l(int index, int64_t value) {
+  _impl_.v_l_.Set(index, value);
+  // @@protoc_insertion_point(field_set:shadow.Argument.v_l)
+}
+inline void Argument::_internal_add_v_l(int64_t value) {
+  _impl_.v_l_.Add(value);
+}
+inline void Argument::add_v_l(int64_t value) {
+  _internal_add_v_l(value);
+  // @@protoc_insertion_point(field_add:shadow.Argument.v_l)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+Argument::_internal_v_l() const {
+  return _impl_.v_l_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+Argument::v_l() const {
+  // @@protoc_insertion_point(field_list:shadow.Argument.v_l)
+  return _internal_v_l();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+Argument::_internal_mutable_v_l() {
+  return &_impl_.v_l_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+Argument::mutable_v_l() {
+  // @@protoc_insertion_point(field_mutable_list:shadow.Argument.v_l)
+  return _internal_mutable_v_l();
+}
+
+// -------------------------------------------------------------------
+
+// OpParam
+
+// optional string name = 1;
+inline bool OpParam::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool OpParam::has_name() const {
+  return _internal_has_name();
+}
+inline void OpParam::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& OpParam::name() const {
+  // @@protoc_insertion_point(field_get:shadow.OpParam.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void OpParam::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:shadow.OpParam.name)
+}
+inline std::string* OpParam::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:shadow.OpParam.name)
+  return _s;
+}
+inline const std::string& OpParam::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void OpParam::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* OpParam::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* OpParam::release_name() {
+  // @@protoc_insertion_point(field_release:shadow.OpParam.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void OpParam::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:shadow.OpParam.name)
+}
+
+// optional string type = 2;
+inline bool OpParam::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool OpParam::has_type() const {
+  return _internal_has_type();
+}
+inline void OpParam::clear_type() {
+  _impl_.type_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& OpParam::type() const {
+  // @@protoc_insertion_point(field_get:shadow.OpParam.type)
+  return _internal_type();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void OpParam::set_type(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.type_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:shadow.OpParam.type)
+}
+inline std::string* OpParam::mutable_type() {
+  std::string* _s = _internal_mutable_type();
+  // @@protoc_insertion_point(field_mutable:shadow.OpParam.type)
+  return _s;
+}
+inline const std::string& OpParam::_internal_type() const {
+  return _impl_.type_.Get();
+}
+inline void OpParam::_internal_set_type(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.type_.Set(value, GetArenaForAllocation());
+}
+inline std::string* OpParam::_internal_mutable_type() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.type_.Mutable(GetArenaForAllocation());
+}
+inline std::string* OpParam::release_type() {
+  // @@protoc_insertion_point(field_release:shadow.OpParam.type)
+  if (!_internal_has_type()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.type_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.type_.IsDefault()) {
+    _impl_.type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void OpParam::set_allocated_type(std::string* type) {
+  if (type != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.type_.SetAllocated(type, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.type_.IsDefault()) {
+    _impl_.type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:shadow.OpParam.type)
+}
+
+// repeated string bottom = 3;
+inline int OpParam::_internal_bottom_size() const {
+  return _impl_.bottom_.size();
+}
+inline int OpParam::bottom_size() const {
+  return _internal_bottom_size();
+}
+inline void OpParam::clear_bottom() {
+  _impl_.bottom_.Clear();
+}
+inline std::string* OpParam::add_bottom() {
+  std::string* _s = _internal_add_bottom();
+  // @@protoc_insertion_point(field_add_mutable:shadow.OpParam.bottom)
+  return _s;
+}
+inline const std::string& OpParam::_internal_bottom(int index) const {
+  return _impl_.bottom_.Get(index);
+}
+inline const std::string& OpParam::bottom(int index) const {
+  // @@protoc_insertion_point(field_get:shadow.OpParam.bottom)
+  return _internal_bottom(index);
+}
+inline std::string* OpParam::mutable_bottom(int index) {
+  // @@protoc_insertion_point(field_mutable:shadow.OpParam.bottom)
+  return _impl_.bottom_.Mutable(index);
+}
+inline void OpParam::set_bottom(int index, const std::string& value) {
+  _impl_.bottom_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:shadow.OpParam.bottom)
+}
+inline void OpParam::set_bottom(int index, std::string&& value) {
+  _impl_.bottom_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:shadow.OpParam.bottom)
+}
+inline void OpParam::set_bottom(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.bottom_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:shadow.OpParam.bottom)
+}
+inline void OpParam::set_bottom(int index, const char* value, size_t size) {
+  _impl_.bottom_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:shadow.OpParam.bottom)
+}
+inline std::string* OpParam::_internal_add_bottom() {
+  return _impl_.bottom_.Add();
+}
+inline void OpParam::add_bottom(const std::string& value) {
+  _impl_.bottom_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:shadow.OpParam.bottom)
+}
+inline void OpParam::add_bottom(std::string&& value) {
+  _impl_.bottom_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:shadow.OpParam.bottom)
+}
+inline void OpParam::add_bottom(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.bottom_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:shadow.OpParam.bottom)
+}
+inline void OpParam::add_bottom(const char* value, size_t size) {
+  _impl_.bottom_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:shadow.OpParam.bottom)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+OpParam::bottom() const {
+  // @@protoc_insertion_point(field_list:shadow.OpParam.bottom)
+  return _impl_.bottom_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+OpParam::mutable_bottom() {
+  // @@protoc_insertion_point(field_mutable_list:shadow.OpParam.bottom)
+  return &_impl_.bottom_;
+}
+
+// repeated string top = 4;
+inline int OpParam::_internal_top_size() const {
+  return _impl_.top_.size();
+}
+inline int OpParam::top_size() const {
+  return _internal_top_size();
+}
+inline void OpParam::clear_top() {
+  _impl_.top_.Clear();
+}
+inline std::string* OpParam::add_top() {
+  std::string* _s = _internal_add_top();
+  // @@protoc_insertion_point(field_add_mutable:shadow.OpParam.top)
+  return _s;
+}
+inline const std::string& OpParam::_internal_top(int index) const {
+  return _impl_.top_.Get(index);
+}
+inline const std::string& OpParam::top(int index) const {
+  // @@protoc_insertion_point(field_get:shadow.OpParam.top)
+  return _internal_top(index);
+}
+inline std::string* OpParam::mutable_top(int index) {
+  // @@protoc_insertion_point(field_mutable:shadow.OpParam.top)
+  return _impl_.top_.Mutable(index);
+}
+inline void OpParam::set_top(int index, const std::string& value) {
+  _impl_.top_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:shadow.OpParam.top)
+}
+inline void OpParam::set_top(int index, std::string&& value) {
+  _impl_.top_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:shadow.OpParam.top)
+}
+inline void OpParam::set_top(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.top_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:shadow.OpParam.top)
+}
+inline void OpParam::set_top(int index, const char* value, size_t size) {
+  _impl_.top_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:shadow.OpParam.top)
+}
+inline std::string* OpParam::_internal_add_top() {
+  return _impl_.top_.Add();
+}
+inline void OpParam::add_top(const std::string& value) {
+  _impl_.top_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:shadow.OpParam.top)
+}
+inline void OpParam::add_top(std::string&& value) {
+  _impl_.top_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:shadow.OpParam.top)
+}
+inline void OpParam::add_top(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.top_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:shadow.OpParam.top)
+}
+inline void OpParam::add_top(const char* value, size_t size) {
+  _impl_.top_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:shadow.OpParam.top)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+OpParam::top() const {
+  // @@protoc_insertion_point(field_list:shadow.OpParam.top)
+  return _impl_.top_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+OpParam::mutable_top() {
+  // @@protoc_insertion_point(field_mutable_list:shadow.OpParam.top)
+  return &_impl_.top_;
+}
+
+// repeated .shadow.Argument arg = 11;
+inline int OpParam::_internal_arg_size() const {
+  return _impl_.arg_.size();
+}
+inline int OpParam::arg_size() const {
+  return _internal_arg_size();
+}
+inline void OpParam::clear_arg() {
+  _impl_.arg_.Clear();
+}
+inline ::shadow::Argument* OpParam::mutable_arg(int index) {
+  // @@protoc_insertion_point(field_mutable:shadow.OpParam.arg)
+  return _impl_.arg_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::shadow::Argument >*
+OpParam::mutable_arg() {
+  // @@protoc_insertion_point(field_mutable_list:shadow.OpParam.arg)
+  return &_impl_.arg_;
+}
+inline const ::shadow::Argument& OpParam::_internal_arg(int index) const {
+  return _impl_.arg_.Get(index);
+}
+inline const ::shadow::Argument& OpParam::arg(int index) const {
+  // @@protoc_insertion_point(field_get:shadow.OpParam.arg)
+  return _internal_arg(index);
+}
+inline ::shadow::Argument* OpParam::_internal_add_arg() {
+  return _impl_.arg_.Add();
+}
+inline ::shadow::Argument* OpParam::add_arg() {
+  ::shadow::Argument* _add = _internal_add_arg();
+  // @@protoc_insertion_point(field_add:shadow.OpParam.arg)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::shadow::Argument >&
+OpParam::arg() const {
+  // @@protoc_insertion_point(field_list:shadow.OpParam.arg)
+  return _impl_.arg_;
+}
+
+// -------------------------------------------------------------------
+
+// NetParam
+
+// optional string name = 1;
+inline bool NetParam::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool NetParam::has_name() const {
+  return _internal_has_name();
+}
+inline void NetParam::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& NetParam::name() const {
+  // @@protoc_insertion_point(field_get:shadow.NetParam.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void NetParam::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:shadow.NetParam.name)
+}
+inline std::string* NetParam::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:shadow.NetParam.name)
+  return _s;
+}
+inline const std::string& NetParam::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void NetParam::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* NetParam::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* NetParam::release_name() {
+  // @@protoc_insertion_point(field_release:shadow.NetParam.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void NetParam::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:shadow.NetParam.name)
+}
+
+// repeated .shadow.Blob blob = 5;
+inline int NetParam::_internal_blob_size() const {
+  return _impl_.blob_.size();
+}
+inline int NetParam::blob_size() const {
+  return _internal_blob_size();
+}
+inline void NetParam::clear_blob() {
+  _impl_.blob_.Clear();
+}
+inline ::shadow::Blob* NetParam::mutable_blob(int index) {
+  // @@protoc_insertion_point(field_mutable:shadow.NetParam.blob)
+  return _impl_.blob_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::shadow::Blob >*
+NetParam::mutable_blob() {
+  // @@protoc_insertion_point(field_mutable_list:shadow.NetParam.blob)
+  return &_impl_.blob_;
+}
+inline const ::shadow::Blob& NetParam::_internal_blob(int index) const {
+  return _impl_.blob_.Get(index);
+}
+inline const ::shadow::Blob& NetParam::blob(int index) const {
+  // @@protoc_insertion_point(field_get:shadow.NetParam.blob)
+  return _internal_blob(index);
+}
+inline ::shadow::Blob* NetParam::_internal_add_blob() {
+  return _impl_.blob_.Add();
+}
+inline ::shadow::Blob* NetParam::add_blob() {
+  ::shadow::Blob* _add = _internal_add_blob();
+  // @@protoc_insertion_point(field_add:shadow.NetParam.blob)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::shadow::Blob >&
+NetParam::blob() const {
+  // @@protoc_insertion_point(field_list:shadow.NetParam.blob)
+  return _impl_.blob_;
+}
+
+// repeated .shadow.OpParam op = 11;
+inline int NetParam::_internal_op_size() const {
+  return _impl_.op_.size();
+}
+inline int NetParam::op_size() const {
+  return _internal_op_size();
+}
+inline void NetParam::clear_op() {
+  _impl_.op_.Clear();
+}
+inline ::shadow::OpParam* NetParam::mutable_op(int index) {
+  // @@protoc_insertion_point(field_mutable:shadow.NetParam.op)
+  return _impl_.op_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::shadow::OpParam >*
+NetParam::mutable_op() {
+  // @@protoc_insertion_point(field_mutable_list:shadow.NetParam.op)
+  return &_impl_.op_;
+}
+inline const ::shadow::OpParam& NetParam::_internal_op(int index) const {
+  return _impl_.op_.Get(index);
+}
+inline const ::shadow::OpParam& NetParam::op(int index) const {
+  // @@protoc_insertion_point(field_get:shadow.NetParam.op)
+  return _internal_op(index);
+}
+inline ::shadow::OpParam* NetParam::_internal_add_op() {
+  return _impl_.op_.Add();
+}
+inline ::shadow::OpParam* NetParam::add_op() {
+  ::shadow::OpParam* _add = _internal_add_op();
+  // @@protoc_insertion_point(field_add:shadow.NetParam.op)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::shadow::OpParam >&
+NetParam::op() const {
+  // @@protoc_insertion_point(field_list:shadow.NetParam.op)
+  return _impl_.op_;
+}
+
+// repeated .shadow.Argument arg = 12;
+inline int NetParam::_internal_arg_size() const {
+  return _impl_.arg_.size();
+}
+inline int NetParam::arg_size() const {
+  return _internal_arg_size();
+}
+inline void NetParam::clear_arg() {
+  _impl_.arg_.Clear();
+}
+inline ::shadow::Argument* NetParam::mutable_arg(int index) {
+  // @@protoc_insertion_point(field_mutable:shadow.NetParam.arg)
+  return _impl_.arg_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::shadow::Argument >*
+NetParam::mutable_arg() {
+  // @@protoc_insertion_point(field_mutable_list:shadow.NetParam.arg)
+  return &_impl_.arg_;
+}
+inline const ::shadow::Argument& NetParam::_internal_arg(int index) const {
+  return _impl_.arg_.Get(index);
+}
+inline const ::shadow::Argument& NetParam::arg(int index) const {
+  // @@protoc_insertion_point(field_get:shadow.NetParam.arg)
+  return _internal_arg(index);
+}
+inline ::shadow::Argument* NetParam::_internal_add_arg() {
+  return _impl_.arg_.Add();
+}
+inline ::shadow::Argument* NetParam::add_arg() {
+  ::shadow::Argument* _add = _internal_add_arg();
+  // @@protoc_insertion_point(field_add:shadow.NetParam.arg)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::shadow::Argument >&
+NetParam::arg() const {
+  // @@protoc_insertion_point(field_list:shadow.NetParam.arg)
+  return _impl_.arg_;
+}
+
+// -------------------------------------------------------------------
+
+// MetaNetParam
+
+// optional string name = 1;
+inline bool MetaNetParam::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool MetaNetParam::has_name() const {
+  return _internal_has_name();
+}
+inline void MetaNetParam::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& MetaNetParam::name() const {
+  // @@protoc_insertion_point(field_get:shadow.MetaNetParam.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MetaNetParam::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:shadow.MetaNetParam.name)
+}
+inline std::string* MetaNetParam::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:shadow.MetaNetParam.name)
+  return _s;
+}
+inline const std::string& MetaNetParam::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void MetaNetParam::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MetaNetParam::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MetaNetParam::release_name() {
+  // @@protoc_insertion_point(field_release:shadow.MetaNetParam.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void MetaNetParam::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:shadow.MetaNetParam.name)
+}
+
+// repeated .shadow.NetParam network = 11;
+inline int MetaNetParam::_internal_network_size() const {
+  return _impl_.network_.size();
+}
+inline int MetaNetParam::network_size() const {
+  return _internal_network_size();
+}
+inline void MetaNetParam::clear_network() {
+  _impl_.network_.Clear();
+}
+inline ::shadow::NetParam* MetaNetParam::mutable_network(int index) {
+  // @@protoc_insertion_point(field_mutable:shadow.MetaNetParam.network)
+  return _impl_.network_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::shadow::NetParam >*
+MetaNetParam::mutable_network() {
+  // @@protoc_insertion_point(field_mutable_list:shadow.MetaNetParam.network)
+  return &_impl_.network_;
+}
+inline const ::shadow::NetParam& MetaNetParam::_internal_network(int index) const {
+  return _impl_.network_.Get(index);
+}
+inline const ::shadow::NetParam& MetaNetParam::network(int index) const {
+  // @@protoc_insertion_point(field_get:shadow.MetaNetParam.network)
+  return _internal_network(index);
+}
+inline ::shadow::NetParam* MetaNetParam::_internal_add_network() {
+  return _impl_.network_.Add();
+}
+inline ::shadow::NetParam* MetaNetParam::add_network() {
+  ::shadow::NetParam* _add = _internal_add_network();
+  // @@protoc_insertion_point(field_add:shadow.MetaNetParam.network)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::shadow::NetParam >&
+MetaNetParam::network() const {
+  // @@protoc_insertion_point(field_list:shadow.MetaNetParam.network)
+  return _impl_.network_;
+}
+
+// repeated .shadow.Argument arg = 12;
+inline int MetaNetParam::_internal_arg_size() const {
+  return _impl_.arg_.size();
+}
+inline int MetaNetParam::arg_size() const {
+  return _internal_arg_size();
+}
+inline void MetaNetParam::clear_arg() {
+  _impl_.arg_.Clear();
+}
+inline ::shadow::Argument* MetaNetParam::mutable_arg(int index) {
+  // @@protoc_insertion_point(field_mutable:shadow.MetaNetParam.arg)
+  return _impl_.arg_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::shadow::Argument >*
+MetaNetParam::mutable_arg() {
+  // @@protoc_insertion_point(field_mutable_list:shadow.MetaNetParam.arg)
+  return &_impl_.arg_;
+}
+inline const ::shadow::Argument& MetaNetParam::_internal_arg(int index) const {
+  return _impl_.arg_.Get(index);
+}
+inline const ::shadow::Argument& MetaNetParam::arg(int index) const {
+  // @@protoc_insertion_point(field_get:shadow.MetaNetParam.arg)
+  return _internal_arg(index);
+}
+inline ::shadow::Argument* MetaNetParam::_internal_add_arg() {
+  return _impl_.arg_.Add();
+}
+inline ::shadow::Argument* MetaNetParam::add_arg() {
+  ::shadow::Argument* _add = _internal_add_arg();
+  // @@protoc_insertion_point(field_add:shadow.MetaNetParam.arg)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::shadow::Argument >&
+MetaNetParam::arg() const {
+  // @@protoc_insertion_point(field_list:shadow.MetaNetParam.arg)
+  return _impl_.arg_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace shadow
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_shadow_2eproto
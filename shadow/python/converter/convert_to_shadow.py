@@ -14,6 +14,7 @@ def parse_args():
     parser.add_argument('--save_root', '-s', default='model_shadow', help='The root folder to save the shadow model.')
     parser.add_argument('--copy_params', '-p', action='store_true', help='Copy source model weights.')
     parser.add_argument('--merge_op', '-m', action='store_true', help='Merge operators.')
+    parser.add_argument('--mapped', '-a', action='store_true', help='Write weights to an aligned section which can be memory mapped.')
     parser.add_argument('--transform', '-t', action='store_true', help='Write model to cxx files.')
     arguments = parser.parse_args()
     return arguments
@@ -35,7 +36,10 @@ if __name__ == '__main__':
 
     if args.copy_params:
         save_path = save_name + ('_merged.shadowmodel' if args.merge_op else '.shadowmodel')
-        network.write_proto_to_binary(save_path)
+        if args.mapped:
+            network.write_proto_to_mapped_binary(save_path)
+        else:
+            network.write_proto_to_binary(save_path)
     else:
         save_path = save_name + ('_merged.shadowtxt' if args.merge_op else '.shadowtxt')
         network.clear_all_blobs()
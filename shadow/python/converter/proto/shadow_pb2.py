@@ -0,0 +1,37 @@
+# -*- coding: utf-8 -*-
+# Generated by the protocol buffer compiler.  DO NOT EDIT!
+# source: shadow.proto
+"""Generated protocol buffer code."""
+from google.protobuf.internal import builder as _builder
+from google.protobuf import descriptor as _descriptor
+from google.protobuf import descriptor_pool as _descriptor_pool
+from google.protobuf import symbol_database as _symbol_database
+# @@protoc_insertion_point(imports)
+
+_sym_db = _symbol_database.Default()
+
+
+
+
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x0cshadow.proto\x12\x06shadow\"i\n\x04\x42lob\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0c\n\x04type\x18\x02 \x01(\t\x12\r\n\x05shape\x18\x03 \x03(\x05\x12\x12\n\x06\x64\x61ta_f\x18\x04 \x03(\x02\x42\x02\x10\x01\x12\x12\n\x06\x64\x61ta_i\x18\x05 \x03(\x05\x42\x02\x10\x01\x12\x0e\n\x06\x64\x61ta_b\x18\x06 \x03(\x0c\"\x80\x01\n\x08\x41rgument\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0b\n\x03s_f\x18\x02 \x01(\x02\x12\x0b\n\x03s_i\x18\x03 \x01(\x05\x12\x0b\n\x03s_s\x18\x04 \x01(\t\x12\x0b\n\x03v_f\x18\x05 \x03(\x02\x12\x0b\n\x03v_i\x18\x06 \x03(\x05\x12\x0b\n\x03v_s\x18\x07 \x03(\t\x12\x0b\n\x03s_l\x18\x08 \x01(\x03\x12\x0b\n\x03v_l\x18\t \x03(\x03\"a\n\x07OpParam\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0c\n\x04type\x18\x02 \x01(\t\x12\x0e\n\x06\x62ottom\x18\x03 \x03(\t\x12\x0b\n\x03top\x18\x04 \x03(\t\x12\x1d\n\x03\x61rg\x18\x0b \x03(\x0b\x32\x10.shadow.Argument\"p\n\x08NetParam\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x1a\n\x04\x62lob\x18\x05 \x03(\x0b\x32\x0c.shadow.Blob\x12\x1b\n\x02op\x18\x0b \x03(\x0b\x32\x0f.shadow.OpParam\x12\x1d\n\x03\x61rg\x18\x0c \x03(\x0b\x32\x10.shadow.Argument\"^\n\x0cMetaNetParam\x12\x0c\n\x04name\x18\x01 \x01(\t\x12!\n\x07network\x18\x0b \x03(\x0b\x32\x10.shadow.NetParam\x12\x1d\n\x03\x61rg\x18\x0c \x03(\x0b\x32\x10.shadow.Argument')
+
+_builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, globals())
+_builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'shadow_pb2', globals())
+if _descriptor._USE_C_DESCRIPTORS == False:
+
+  DESCRIPTOR._options = None
+  _BLOB.fields_by_name['data_f']._options = None
+  _BLOB.fields_by_name['data_f']._serialized_options = b'\020\001'
+  _BLOB.fields_by_name['data_i']._options = None
+  _BLOB.fields_by_name['data_i']._serialized_options = b'\020\001'
+  _BLOB._serialized_start=24
+  _BLOB._serialized_end=129
+  _ARGUMENT._serialized_start=132
+  _ARGUMENT._serialized_end=260
+  _OPPARAM._serialized_start=262
+  _OPPARAM._serialized_end=359
+  _NETPARAM._serialized_start=361
+  _NETPARAM._serialized_end=473
+  _METANETPARAM._serialized_start=475
+  _METANETPARAM._serialized_end=569
+# @@protoc_insertion_point(module_scope)
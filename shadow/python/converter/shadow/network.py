@@ -1,6 +1,9 @@
 from google.protobuf import text_format
 from proto import MetaNetParam
 
+import array
+import struct
+
 
 class Network(object):
     def __init__(self, name):
@@ -610,3 +613,46 @@ class Network(object):
                 proto_file.write(self.get_net(net_index).SerializeToString())
             else:
                 proto_file.write(self.meta_net_param.SerializeToString())
+
+    def write_proto_to_mapped_binary(self, file_path, alignment=64):
+        def align(size):
+            return (size + alignment - 1) // alignment * alignment
+
+        # Element sizes of the blob types stored as raw bytes in data_b
+        byte_sizes = {'unsigned char': 1, 'signed char': 1, 'half': 2, 'bfloat16': 2}
+
+        meta_net_param = MetaNetParam()
+        meta_net_param.CopyFrom(self.meta_net_param)
+        weights, weight_size = [], 0
+        for net_param in meta_net_param.network:
+            for blob in net_param.blob:
+                blob_type = blob.type if blob.HasField('type') else 'float'
+                if blob_type == 'float':
+                    data = array.array('f', blob.data_f).tobytes()
+                elif blob_type == 'int':
+                    data = array.array('i', blob.data_i).tobytes()
+                elif blob_type in byte_sizes:
+                    data = blob.data_b[0] if len(blob.data_b) > 0 else b''
+                else:
+                    raise ValueError('Unknown blob type', blob_type)
+                count = 1
+                for dim in blob.shape:
+                    count *= dim
+                assert len(data) == count * byte_sizes.get(blob_type, 4), 'Blob {} has no weights'.format(blob.name)
+                weight_size = align(weight_size)
+                weights.append((weight_size, data))
+                weight_size += len(data)
+                blob.ClearField('data_f')
+                blob.ClearField('data_i')
+                blob.ClearField('data_b')
+
+        graph = meta_net_param.SerializeToString()
+        header_size = 64
+        weight_offset = align(header_size + len(graph))
+        with open(file_path, 'wb') as model_file:
+            model_file.write(struct.pack('<8sIIQQQQ16x', b'SHADOWMF', 1, header_size, header_size, len(graph), weight_offset, weight_size))
+            model_file.write(graph)
+            for offset, data in weights:
+                model_file.seek(weight_offset + offset)
+                model_file.write(data)
+            model_file.truncate(weight_offset + weight_size)
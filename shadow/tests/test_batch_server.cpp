@@ -0,0 +1,94 @@
+#include "test_util.hpp"
+
+#include "core/batch_server.hpp"
+
+#include <iostream>
+#include <thread>
+
+using namespace Shadow;
+
+// Convolutions with one output batched along the first axis, one along the
+// second axis after a Permute
+NetBuilder ConvPermute() {
+  NetBuilder builder;
+  builder.AddInput({{"data", {1, 4, 12, 10}}});
+  builder.AddConv("conv1", "data", "conv1", 4, 8, 3);
+  add_s_i(builder.AddOp("Activate", "relu1", {"conv1"}, {"conv1"}), "type", 1);
+  builder.AddConv("conv2", "conv1", "conv2", 8, 6, 3);
+  add_v_i(builder.AddOp("Permute", "permute", {"conv2"}, {"permute"}), "order",
+          std::vector<int>{1, 0, 2, 3});
+  builder.SetOutputs({"conv2", "permute"});
+  return builder;
+}
+
+Network Load(const NetBuilder &builder) {
+  ArgumentHelper arguments;
+  arguments.AddSingleArgument<std::string>("backend_type", "Native");
+  Network network;
+  network.Setup();
+  network.LoadXModel(builder.net_param(), arguments);
+  return network;
+}
+
+// Requests submitted concurrently are coalesced into batches, each request
+// must get the outputs of a forward of its own inputs alone
+int main() {
+  const auto &builder = ConvPermute();
+  auto network = Load(builder);
+  const auto in_shape = network.GetBlobShapeByName<float>("data");
+  int in_count = 1;
+  for (int dim : in_shape) in_count *= dim;
+
+  const int num_requests = 64;
+  std::vector<std::vector<float>> in_data(num_requests);
+  std::vector<std::vector<int>> in_shapes(num_requests, in_shape);
+  std::vector<std::map<std::string, std::vector<float>>> expected(
+      num_requests);
+  for (int n = 0; n < num_requests; ++n) {
+    in_shapes[n][0] = n % 3 == 2 ? 2 : 1;
+    in_data[n] = RandomData(in_count * in_shapes[n][0], n);
+    network.Forward({{"data", in_data[n].data()}}, {{"data", in_shapes[n]}});
+    expected[n] = GetOutputs(&network);
+  }
+
+  BatchServer server(Load(builder), 8, 2000, 2, 0, {{"permute", 1}});
+  std::vector<std::future<BatchServer::Result>> results(num_requests);
+  std::vector<std::thread> clients;
+  for (int c = 0; c < 4; ++c) {
+    clients.emplace_back([&, c]() {
+      for (int n = c; n < num_requests; n += 4) {
+        results[n] = server.Submit({{"data", in_data[n]}},
+                                   {{"data", in_shapes[n]}});
+      }
+    });
+  }
+  for (auto &client : clients) {
+    client.join();
+  }
+
+  int num_failed = 0;
+  for (int n = 0; n < num_requests; ++n) {
+    const auto &result = results[n].get();
+    for (const auto &out_it : expected[n]) {
+      if (!SameBits(out_it.second, result.data_map.at(out_it.first))) {
+        std::cerr << out_it.first << " differs in request " << n << std::endl;
+        num_failed++;
+      }
+    }
+  }
+
+  server.Stop();
+  try {
+    server.Submit({{"data", in_data[0]}}, {{"data", in_shapes[0]}}).get();
+    std::cerr << "Submit succeeded after Stop" << std::endl;
+    num_failed++;
+  } catch (const std::runtime_error &) {
+  }
+
+  if (num_failed > 0) {
+    std::cerr << num_failed << " checks failed" << std::endl;
+    return 1;
+  }
+  std::cout << "All requests match single forwards" << std::endl;
+  return 0;
+}
@@ -0,0 +1,136 @@
+#include "test_util.hpp"
+
+#include <iostream>
+
+using namespace Shadow;
+
+// Input -> Relu -> Reshape -> Tanh, the view must be bound before Tanh reads
+// it
+NetBuilder ViewChain() {
+  NetBuilder builder;
+  builder.AddInput({{"data", {1, 8, 60, 50}}});
+  add_s_i(builder.AddOp("Activate", "relu", {"data"}, {"relu"}), "type", 1);
+  add_v_i(builder.AddOp("Reshape", "reshape", {"relu"}, {"reshape"}), "shape",
+          std::vector<int>{0, -1});
+  add_s_i(builder.AddOp("Activate", "tanh", {"reshape"}, {"tanh"}), "type", 5);
+  add_s_i(builder.AddOp("Activate", "sigmoid", {"relu"}, {"sigmoid"}), "type",
+          3);
+  builder.SetOutputs({"tanh", "sigmoid"});
+  return builder;
+}
+
+// Two convolution branches concatenated in place and sliced back into views
+// along the channel axis, with in-place operators on the views
+NetBuilder ConcatSlice() {
+  NetBuilder builder;
+  builder.AddInput({{"data", {1, 8, 24, 24}}});
+  builder.AddConv("conv1", "data", "conv1", 8, 16, 3);
+  add_s_i(builder.AddOp("Activate", "relu1", {"conv1"}, {"conv1"}), "type", 1);
+  builder.AddConv("conv2a", "conv1", "conv2a", 16, 8, 1);
+  builder.AddConv("conv2b", "conv1", "conv2b", 16, 8, 3);
+  builder.AddConv("conv2c", "conv1", "conv2c", 16, 8, 3, 8);
+  add_s_i(builder.AddOp("Concat", "concat", {"conv2a", "conv2b", "conv2c"},
+                        {"concat"}),
+          "axis", 1);
+  add_v_i(builder.AddOp("Slice", "slice", {"concat"}, {"slice0", "slice1"}),
+          "slice_point", std::vector<int>{6});
+  add_s_i(builder.AddOp("Activate", "tanh", {"slice0"}, {"slice0"}), "type", 5);
+  builder.AddConv("conv3", "slice1", "conv3", 18, 8, 3);
+  add_s_i(builder.AddOp("Flatten", "flatten", {"slice0"}, {"flatten"}), "axis",
+          1);
+  add_s_i(builder.AddOp("Activate", "sigmoid", {"flatten"}, {"sigmoid"}),
+          "type", 3);
+  builder.SetOutputs({"sigmoid", "conv3"});
+  return builder;
+}
+
+// A Concat written in place by its producers, sliced into views which are
+// concatenated again together with the first Concat
+NetBuilder NestedConcat() {
+  NetBuilder builder;
+  builder.AddInput({{"x", {1, 8, 6, 5}}, {"y", {1, 8, 6, 5}}});
+  add_s_i(builder.AddOp("Activate", "relu", {"x"}, {"relu"}), "type", 1);
+  add_s_i(builder.AddOp("Activate", "sigmoid", {"y"}, {"sigmoid"}), "type", 3);
+  add_s_i(
+      builder.AddOp("Concat", "concat", {"relu", "sigmoid"}, {"concat"}),
+      "axis", 1);
+  add_v_i(builder.AddOp("Slice", "slice", {"concat"}, {"s0", "s1", "s2"}),
+          "slice_point", std::vector<int>{3, 7});
+  add_s_i(builder.AddOp("Activate", "tanh", {"s0"}, {"t0"}), "type", 5);
+  auto *op_param = builder.AddOp("Binary", "mul", {"s1"}, {"t1"});
+  add_s_i(op_param, "operation", 2);
+  add_s_f(op_param, "scalar", 3.f);
+  add_s_i(builder.AddOp("Concat", "concat2", {"t0", "t1", "s2", "concat"},
+                        {"concat2"}),
+          "axis", 1);
+  builder.SetOutputs({"concat2"});
+  return builder;
+}
+
+// Runs the network several times with varying inputs and batch sizes and
+// collects the outputs of every forward
+std::vector<std::map<std::string, std::vector<float>>> Run(
+    const NetBuilder &builder, int inter_op_threads) {
+  ArgumentHelper arguments;
+  arguments.AddSingleArgument<std::string>("backend_type", "Native");
+  arguments.AddSingleArgument<int>("num_threads", 3);
+  arguments.AddSingleArgument<int>("inter_op_threads", inter_op_threads);
+  Network network;
+  network.Setup();
+  network.LoadXModel(builder.net_param(), arguments);
+
+  std::vector<std::map<std::string, std::vector<float>>> outputs;
+  for (int n = 0; n < 16; ++n) {
+    std::map<std::string, std::vector<float>> in_data;
+    std::map<std::string, void *> data_map;
+    std::map<std::string, std::vector<int>> shape_map;
+    for (const auto &in_name : network.in_blob()) {
+      auto in_shape = network.GetBlobShapeByName<float>(in_name);
+      in_shape[0] = n % 4 == 3 ? 2 : 1;
+      int count = 1;
+      for (int dim : in_shape) count *= dim;
+      auto &data = in_data[in_name];
+      data = RandomData(count, static_cast<unsigned int>(n + in_data.size()));
+      data_map[in_name] = data.data();
+      shape_map[in_name] = in_shape;
+    }
+    network.Forward(data_map, shape_map);
+    outputs.push_back(GetOutputs(&network));
+  }
+  return outputs;
+}
+
+// The outputs under the inter-op scheduler must match sequential execution
+// bit for bit
+int main() {
+  const std::map<std::string, NetBuilder> cases{
+      {"view_chain", ViewChain()},
+      {"concat_slice", ConcatSlice()},
+      {"nested_concat", NestedConcat()}};
+  int num_failed = 0;
+  for (const auto &case_it : cases) {
+    const auto &expected = Run(case_it.second, 1);
+    for (int inter_op_threads : {2, 4}) {
+      for (int repeat = 0; repeat < 16; ++repeat) {
+        const auto &outputs = Run(case_it.second, inter_op_threads);
+        for (int n = 0; n < static_cast<int>(expected.size()); ++n) {
+          for (const auto &out_it : expected[n]) {
+            if (!SameBits(out_it.second, outputs[n].at(out_it.first))) {
+              std::cerr << case_it.first << ": " << out_it.first
+                        << " differs in forward " << n << " with "
+                        << inter_op_threads << " inter-op threads"
+                        << std::endl;
+              num_failed++;
+            }
+          }
+        }
+      }
+    }
+  }
+  if (num_failed > 0) {
+    std::cerr << num_failed << " outputs differ" << std::endl;
+    return 1;
+  }
+  std::cout << "All outputs match sequential execution" << std::endl;
+  return 0;
+}
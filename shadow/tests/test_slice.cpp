@@ -0,0 +1,135 @@
+#include "test_util.hpp"
+
+#include <iostream>
+
+using namespace Shadow;
+
+// Input -> Relu -> Slice with the given operators after the Slice, returns
+// the Slice to mark it as copying
+shadow::OpParam *SliceRelu(NetBuilder *builder) {
+  builder->AddInput({{"data", {1, 4, 3, 5}}});
+  add_s_i(builder->AddOp("Activate", "relu", {"data"}, {"relu"}), "type", 1);
+  auto *op_param = builder->AddOp("Slice", "slice", {"relu"}, {"s0", "s1"});
+  add_v_i(op_param, "slice_point", std::vector<int>{1});
+  return op_param;
+}
+
+// A top written in place while the bottom is still read by a Reduce
+NetBuilder ReadBottom(bool copy) {
+  NetBuilder builder;
+  auto *slice_param = SliceRelu(&builder);
+  if (copy) add_s_i(slice_param, "view", false);
+  add_s_i(builder.AddOp("Activate", "sigmoid", {"s0"}, {"s0"}), "type", 3);
+  auto *op_param = builder.AddOp("Reduce", "reduce", {"relu"}, {"reduce"});
+  add_s_i(op_param, "operation", 0);
+  add_v_i(op_param, "axes", std::vector<int>{1});
+  builder.SetOutputs({"s0", "s1", "reduce"});
+  return builder;
+}
+
+// A view of a top written in place while the bottom is an output
+NetBuilder WriteTopView(bool copy) {
+  NetBuilder builder;
+  auto *slice_param = SliceRelu(&builder);
+  if (copy) add_s_i(slice_param, "view", false);
+  add_s_i(builder.AddOp("Flatten", "flatten", {"s1"}, {"flatten"}), "axis", 1);
+  add_s_i(builder.AddOp("Activate", "tanh", {"flatten"}, {"flatten"}), "type",
+          5);
+  builder.SetOutputs({"relu", "s0", "flatten"});
+  return builder;
+}
+
+// Tops only read after the Slice, they may view the bottom
+NetBuilder ReadTops(bool copy) {
+  NetBuilder builder;
+  auto *slice_param = SliceRelu(&builder);
+  if (copy) add_s_i(slice_param, "view", false);
+  add_s_i(builder.AddOp("Activate", "tanh", {"s0"}, {"tanh"}), "type", 5);
+  add_s_i(builder.AddOp("Activate", "sigmoid", {"s1"}, {"sigmoid"}), "type",
+          3);
+  builder.SetOutputs({"tanh", "sigmoid"});
+  return builder;
+}
+
+// Runs the network with varying inputs and batch sizes and collects the
+// outputs of every forward, views tells whether the first top viewed the
+// bottom in the forwards of batch 1 repeating the shape of the last forward,
+// the memory plan of a new shape moves the bottom after the forward
+std::vector<std::map<std::string, std::vector<float>>> Run(
+    const NetBuilder &builder, bool memory_plan, bool graph_optimize,
+    bool *views) {
+  ArgumentHelper arguments;
+  arguments.AddSingleArgument<std::string>("backend_type", "Native");
+  arguments.AddSingleArgument<bool>("memory_plan", memory_plan);
+  arguments.AddSingleArgument<bool>("graph_optimize", graph_optimize);
+  Network network;
+  network.Setup();
+  network.LoadXModel(builder.net_param(), arguments);
+
+  std::vector<std::map<std::string, std::vector<float>>> outputs;
+  *views = true;
+  for (int n = 0; n < 6; ++n) {
+    auto in_shape = network.GetBlobShapeByName<float>("data");
+    in_shape[0] = n % 3 == 2 ? 2 : 1;
+    int count = 1;
+    for (int dim : in_shape) count *= dim;
+    auto data = RandomData(count, static_cast<unsigned int>(n));
+    network.Forward({{"data", data.data()}}, {{"data", in_shape}});
+    outputs.push_back(GetOutputs(&network));
+    if (n % 3 == 1) {
+      *views &= network.GetBlobDataByName<float>("s0") ==
+                network.GetBlobDataByName<float>("relu");
+    }
+  }
+  return outputs;
+}
+
+// Slices of the outermost axis view their bottom only where nothing can tell
+// the difference, the outputs must match a copying Slice bit for bit
+int main() {
+  struct Case {
+    NetBuilder (*build)(bool copy);
+    bool views;
+  };
+  const std::map<std::string, Case> cases{{"read_bottom", {ReadBottom, false}},
+                                          {"write_top_view", {WriteTopView,
+                                                              false}},
+                                          {"read_tops", {ReadTops, true}}};
+  int num_failed = 0;
+  for (const auto &case_it : cases) {
+    for (bool memory_plan : {true, false}) {
+      for (bool graph_optimize : {true, false}) {
+        bool copy_views = false, views = false;
+        const auto &expected = Run(case_it.second.build(true), memory_plan,
+                                   graph_optimize, &copy_views);
+        const auto &outputs = Run(case_it.second.build(false), memory_plan,
+                                  graph_optimize, &views);
+        std::string config = case_it.first + " with memory_plan " +
+                             std::to_string(memory_plan) +
+                             ", graph_optimize " +
+                             std::to_string(graph_optimize);
+        if (copy_views || views != case_it.second.views) {
+          std::cerr << config << ": the Slice "
+                    << (views ? "views" : "copies") << " its bottom"
+                    << std::endl;
+          num_failed++;
+        }
+        for (int n = 0; n < static_cast<int>(expected.size()); ++n) {
+          for (const auto &out_it : expected[n]) {
+            if (!SameBits(out_it.second, outputs[n].at(out_it.first))) {
+              std::cerr << config << ": " << out_it.first
+                        << " differs in forward " << n << std::endl;
+              num_failed++;
+            }
+          }
+        }
+      }
+    }
+  }
+  if (num_failed > 0) {
+    std::cerr << num_failed << " checks failed" << std::endl;
+    return 1;
+  }
+  std::cout << "All outputs match a copying Slice" << std::endl;
+  return 0;
+}
@@ -0,0 +1,111 @@
+#ifndef SHADOW_TESTS_TEST_UTIL_HPP
+#define SHADOW_TESTS_TEST_UTIL_HPP
+
+#include "core/helper.hpp"
+#include "core/network.hpp"
+
+#include "util/log.hpp"
+
+#include <cstring>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace Shadow {
+
+// Builds small networks in memory with random weights
+class NetBuilder {
+ public:
+  explicit NetBuilder(unsigned int seed = 1234) : rng_(seed) {}
+
+  shadow::OpParam *AddOp(const std::string &type, const std::string &name,
+                         const std::vector<std::string> &bottoms,
+                         const std::vector<std::string> &tops) {
+    auto *op_param = net_param_.add_op();
+    op_param->set_type(type);
+    op_param->set_name(name);
+    for (const auto &bottom : bottoms) op_param->add_bottom(bottom);
+    for (const auto &top : tops) op_param->add_top(top);
+    return op_param;
+  }
+
+  void AddInput(const std::map<std::string, std::vector<int>> &shapes) {
+    auto *op_param = AddOp("Input", "input", {}, {});
+    for (const auto &shape_it : shapes) {
+      op_param->add_top(shape_it.first);
+      add_v_i(op_param, shape_it.first, shape_it.second);
+    }
+  }
+
+  void AddWeight(const std::string &name, const std::vector<int> &shape) {
+    auto *blob = net_param_.add_blob();
+    blob->set_name(name);
+    int count = 1;
+    for (int dim : shape) {
+      blob->add_shape(dim);
+      count *= dim;
+    }
+    std::uniform_real_distribution<float> dist(-0.5f, 0.5f);
+    for (int n = 0; n < count; ++n) {
+      blob->add_data_f(dist(rng_));
+    }
+  }
+
+  shadow::OpParam *AddConv(const std::string &name, const std::string &bottom,
+                           const std::string &top, int in_c, int num_output,
+                           int kernel_size, int group = 1) {
+    AddWeight(name + "_w", {num_output, in_c / group, kernel_size,
+                            kernel_size});
+    AddWeight(name + "_b", {num_output});
+    auto *op_param =
+        AddOp("Conv", name, {bottom, name + "_w", name + "_b"}, {top});
+    add_s_i(op_param, "num_output", num_output);
+    add_s_i(op_param, "kernel_size", kernel_size);
+    add_s_i(op_param, "pad", kernel_size / 2);
+    add_s_i(op_param, "group", group);
+    return op_param;
+  }
+
+  void SetOutputs(const std::vector<std::string> &outputs) {
+    add_v_s(&net_param_, "out_blob", outputs);
+  }
+
+  const shadow::NetParam &net_param() const { return net_param_; }
+
+ private:
+  shadow::NetParam net_param_;
+  std::mt19937 rng_;
+};
+
+inline std::vector<float> RandomData(int count, unsigned int seed) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> dist(-1.f, 1.f);
+  std::vector<float> data(count);
+  for (auto &value : data) value = dist(rng);
+  return data;
+}
+
+// Copies the outputs of the network after a forward
+inline std::map<std::string, std::vector<float>> GetOutputs(
+    Network *network) {
+  std::map<std::string, std::vector<float>> outputs;
+  for (const auto &blob_name : network->out_blob()) {
+    const auto &shape = network->GetBlobShapeByName<float>(blob_name);
+    int count = 1;
+    for (int dim : shape) count *= dim;
+    const auto *data = network->GetBlobDataByName<float>(blob_name);
+    outputs[blob_name].assign(data, data + count);
+  }
+  return outputs;
+}
+
+// Whether the two outputs hold exactly the same bits
+inline bool SameBits(const std::vector<float> &a, const std::vector<float> &b) {
+  return a.size() == b.size() &&
+         std::memcmp(a.data(), b.data(), a.size() * sizeof(float)) == 0;
+}
+
+}  // namespace Shadow
+
+#endif  // SHADOW_TESTS_TEST_UTIL_HPP
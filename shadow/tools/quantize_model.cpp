@@ -0,0 +1,139 @@
+#include "core/backend.hpp"
+#include "core/workspace.hpp"
+
+#include "util/log.hpp"
+#include "util/util.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace Shadow;
+
+// Calibrates a float model by the samples, saves the int8 engine and reports
+// how far the outputs of the int8 engine are from the float model
+int main(int argc, char const *argv[]) {
+  if (argc < 5) {
+    std::cerr << "Usage: " << argv[0]
+              << " <model> <input_shape, e.g. 1,3,224,224> <samples, raw "
+                 "float32> <out_engine> [num_samples]"
+              << std::endl;
+    return 1;
+  }
+  const std::string model_file(argv[1]), samples_file(argv[3]),
+      out_engine(argv[4]);
+  std::vector<int> in_shape;
+  int in_count = 1;
+  for (const auto &dim : Util::tokenize(argv[2], ",")) {
+    in_shape.push_back(std::stoi(dim));
+    in_count *= in_shape.back();
+  }
+  CHECK_GT(in_count, 0);
+
+  std::ifstream file(samples_file, std::ios::in | std::ios::binary);
+  CHECK(file.is_open()) << "Failed to open file: " << samples_file;
+  std::vector<char> samples_data((std::istreambuf_iterator<char>(file)),
+                                 std::istreambuf_iterator<char>());
+  int num_samples =
+      static_cast<int>(samples_data.size() / (in_count * sizeof(float)));
+  if (argc > 5) {
+    num_samples = std::min(num_samples, std::stoi(argv[5]));
+  }
+  CHECK_GT(num_samples, 0) << "Samples file holds no whole sample";
+  const auto *samples = reinterpret_cast<const float *>(samples_data.data());
+
+  ArgumentHelper arguments;
+  arguments.AddSingleArgument<std::string>("backend_type", "Native");
+  arguments.AddSingleArgument<bool>("calibrate", true);
+  Workspace float_ws(arguments);
+  std::shared_ptr<Backend> float_backend(CreateBackend(arguments, &float_ws));
+  float_backend->LoadModel(model_file, 0);
+  CHECK_EQ(float_backend->in_blob().size(), 1)
+      << "Only networks with one input are supported";
+  const auto in_name = float_backend->in_blob()[0];
+  const auto out_names = float_backend->out_blob();
+
+  using Outputs = std::map<std::string, std::vector<float>>;
+  auto forward = [&](Backend *backend, Workspace *ws, int n) {
+    auto *in_data = const_cast<float *>(samples + n * in_count);
+    backend->Forward({{in_name, in_data}}, {{in_name, in_shape}});
+    Outputs outputs;
+    for (const auto &name : out_names) {
+      auto blob = ws->GetBlob(name);
+      const auto *data = blob->cpu_data<float>();
+      outputs[name].assign(data, data + blob->count());
+    }
+    return outputs;
+  };
+
+  std::vector<Outputs> float_outputs;
+  for (int n = 0; n < num_samples; ++n) {
+    float_outputs.push_back(forward(float_backend.get(), &float_ws, n));
+  }
+  float_backend->SaveEngine(out_engine, nullptr);
+  LOG(INFO) << "Calibrated by " << num_samples << " samples, saved to "
+            << out_engine;
+
+  ArgumentHelper int8_arguments;
+  int8_arguments.AddSingleArgument<std::string>("backend_type", "Native");
+  Workspace int8_ws(int8_arguments);
+  std::shared_ptr<Backend> int8_backend(
+      CreateBackend(int8_arguments, &int8_ws));
+  int8_backend->LoadModel(out_engine, 0);
+
+  struct Stat {
+    double max_diff = 0, sum_diff = 0, dot = 0, norm_a = 0, norm_b = 0;
+    int count = 0, rows = 0, top1_match = 0;
+  };
+  std::map<std::string, Stat> stats;
+  for (int n = 0; n < num_samples; ++n) {
+    const auto &int8_outputs = forward(int8_backend.get(), &int8_ws, n);
+    for (const auto &name : out_names) {
+      const auto &a = float_outputs[n].at(name);
+      const auto &b = int8_outputs.at(name);
+      CHECK_EQ(a.size(), b.size());
+      auto &stat = stats[name];
+      for (int i = 0; i < static_cast<int>(a.size()); ++i) {
+        double diff = std::abs(a[i] - b[i]);
+        stat.max_diff = std::max(stat.max_diff, diff);
+        stat.sum_diff += diff;
+        stat.dot += a[i] * b[i];
+        stat.norm_a += a[i] * a[i], stat.norm_b += b[i] * b[i];
+      }
+      stat.count += static_cast<int>(a.size());
+      // Outputs of batch x classes also compare the top 1 class of each row
+      const auto &shape = int8_ws.GetBlobShape(name);
+      if (shape.size() == 2 && shape[1] > 1) {
+        int classes = shape[1];
+        for (int r = 0; r < shape[0]; ++r) {
+          auto a_row = a.begin() + r * classes, b_row = b.begin() + r * classes;
+          stat.top1_match +=
+              std::max_element(a_row, a_row + classes) - a_row ==
+              std::max_element(b_row, b_row + classes) - b_row;
+          stat.rows++;
+        }
+      }
+    }
+  }
+
+  for (const auto &name : out_names) {
+    const auto &stat = stats.at(name);
+    double cosine =
+        stat.dot / std::max(std::sqrt(stat.norm_a * stat.norm_b), 1e-12);
+    std::cout << name << ": max abs diff " << stat.max_diff
+              << ", mean abs diff " << stat.sum_diff / std::max(stat.count, 1)
+              << ", cosine similarity " << cosine;
+    if (stat.rows > 0) {
+      std::cout << ", top 1 agreement "
+                << static_cast<double>(stat.top1_match) / stat.rows;
+    }
+    std::cout << std::endl;
+  }
+
+  return 0;
+}
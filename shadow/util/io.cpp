@@ -1,6 +1,15 @@
 #include "io.hpp"
 #include "log.hpp"
 
+#if defined(__linux__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#endif
+
 #if defined(USE_Protobuf)
 #if defined(__linux__) || defined(__APPLE__)
 #include <unistd.h>
@@ -27,6 +36,42 @@ namespace Shadow {
 
 namespace IO {
 
+#if defined(__linux__) || defined(__APPLE__)
+MappedFile::MappedFile(const std::string& file_path) {
+  int fd = open(file_path.c_str(), O_RDONLY);
+  CHECK_NE(fd, -1) << "File not found: " << file_path;
+  struct stat file_stat {};
+  CHECK_EQ(fstat(fd, &file_stat), 0) << "Failed to stat file: " << file_path;
+  size_ = static_cast<size_t>(file_stat.st_size);
+  if (size_ > 0) {
+    // Read only, the weights used in place must never be written
+    data_ = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    CHECK(data_ != MAP_FAILED) << "Failed to map file: " << file_path;
+  }
+  close(fd);
+}
+
+MappedFile::~MappedFile() {
+  if (data_ != nullptr) {
+    munmap(data_, size_);
+  }
+}
+
+#else
+MappedFile::MappedFile(const std::string& file_path) {
+  std::ifstream file(file_path, std::ios::in | std::ios::binary);
+  CHECK(file.is_open()) << "File not found: " << file_path;
+  file.seekg(0, std::ios::end);
+  size_ = static_cast<size_t>(file.tellg());
+  file.seekg(0, std::ios::beg);
+  buffer_.resize(size_);
+  file.read(buffer_.data(), size_);
+  data_ = buffer_.data();
+}
+
+MappedFile::~MappedFile() = default;
+#endif
+
 #if defined(USE_Protobuf)
 using google::protobuf::TextFormat;
 using google::protobuf::io::ArrayInputStream;
@@ -60,7 +105,11 @@ bool ReadProtoFromBinaryFile(const std::string& proto_file, Message* proto) {
   CHECK_NE(fd, -1) << "File not found: " << proto_file;
   auto* file_input = new FileInputStream(fd);
   auto* coded_input = new CodedInputStream(file_input);
+#if GOOGLE_PROTOBUF_VERSION >= 3006000
+  coded_input->SetTotalBytesLimit(INT_MAX);
+#else
   coded_input->SetTotalBytesLimit(INT_MAX, 1073741824);
+#endif
   bool success = proto->ParseFromCodedStream(coded_input) &&
                  coded_input->ConsumedEntireMessage();
   delete coded_input;
@@ -73,7 +122,11 @@ bool ReadProtoFromArray(const void* proto_data, int proto_size,
                         Message* proto) {
   auto* array_input = new ArrayInputStream(proto_data, proto_size);
   auto* coded_input = new CodedInputStream(array_input);
+#if GOOGLE_PROTOBUF_VERSION >= 3006000
+  coded_input->SetTotalBytesLimit(INT_MAX);
+#else
   coded_input->SetTotalBytesLimit(INT_MAX, 1073741824);
+#endif
   bool success = proto->ParseFromCodedStream(coded_input) &&
                  coded_input->ConsumedEntireMessage();
   delete coded_input;
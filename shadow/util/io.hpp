@@ -12,10 +12,34 @@
 #include "core/params.hpp"
 #endif
 
+#include "core/common.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
 namespace Shadow {
 
 namespace IO {
 
+// Maps a whole file into memory read only, pages are shared with other
+// processes mapping the same file until they are written
+class MappedFile {
+ public:
+  explicit MappedFile(const std::string& file_path);
+  ~MappedFile();
+
+  const void* data() const { return data_; }
+  size_t size() const { return size_; }
+
+ private:
+  void* data_ = nullptr;
+  size_t size_ = 0;
+  std::vector<char> buffer_;
+
+  DISABLE_COPY_AND_ASSIGN(MappedFile);
+};
+
 #if defined(USE_Protobuf)
 using google::protobuf::Message;
 
@@ -158,6 +158,10 @@ inline void json_encode(std::stringstream& out, const shadow::OpParam& t) {
       json_encode_iterable(out, arg.v_i());
     } else if (arg.v_s_size() > 0) {
       json_encode_iterable(out, arg.v_s());
+    } else if (arg.has_s_l()) {
+      json_encode(out, arg.s_l());
+    } else if (arg.v_l_size() > 0) {
+      json_encode_iterable(out, arg.v_l());
     }
     if (n < t.arg_size() - 1) {
       out << ",";
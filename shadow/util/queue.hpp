@@ -2,6 +2,7 @@
 #define SHADOW_UTIL_QUEUE_HPP
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <limits>
 #include <mutex>
@@ -40,6 +41,21 @@ class Queue {
     return item;
   }
 
+  // Returns false if no item arrives before deadline or pops are canceled
+  bool pop_until(T* item,
+                 const std::chrono::steady_clock::time_point& deadline) {
+    std::unique_lock<std::mutex> lock{lock_};
+    if (!cond_.wait_until(lock, deadline,
+                          [&]() { return !queue_.empty() || interrupt_; }) ||
+        interrupt_) {
+      return false;
+    }
+    *item = std::move(queue_.front());
+    queue_.pop();
+    cond_full_.notify_one();
+    return true;
+  }
+
   const T& peek() {
     static auto int_return = T{};
     std::unique_lock<std::mutex> lock{lock_};